@@ -0,0 +1,208 @@
+#ifndef AssetBank_h
+#define AssetBank_h
+
+#include <avr/pgmspace.h>
+#include "SpiPump.h"
+
+// Banco de assets en flash "lejana".
+//
+// En el ATmega2560 pgm_read_word solo llega a los primeros 64 KB de flash;
+// un arreglo PROGMEM que quede mas arriba se lee como basura sin ningun
+// aviso. Los assets marcados con ASSET_FAR van a la seccion .fini7, que el
+// linker pone despues de todo el codigo, y se leen con direcciones de 24
+// bits (uint_farptr_t) usando ELPM. tools/check_flash_layout.py revisa al
+// linkear que el PROGMEM normal no pase de 64 KB y cuanto ocupa el banco.
+//
+// .fini7 forma parte del codigo de salida de exit(); el juego nunca sale
+// de main(), asi que nunca se ejecuta.
+//
+// En micros sin ELPM (ATmega328P) todo cabe en 64 KB: ASSET_FAR es PROGMEM
+// normal y las lecturas son LPM.
+//
+// Con ASSET_RLE (env:uno) los assets van comprimidos (AssetsRle.h, generado
+// por tools/gen_rle.py) y AssetStream los descomprime al leerlos.
+
+#if defined(__AVR_HAVE_ELPM__)
+#define ASSET_FAR __attribute__((__used__, __section__(".fini7")))
+#define ASSET_ADDR(asset) pgm_get_far_address(asset)
+#else
+#define ASSET_FAR PROGMEM
+#define ASSET_ADDR(asset) ((uint_farptr_t)(uintptr_t)&(asset))
+#endif
+
+// Lee palabras seguidas de un asset del banco. Con ELPM Z+ el puntero de 24
+// bits (RAMPZ:Z) avanza solo, asi que cada lectura cuesta lo mismo que un
+// pgm_read_word normal mas el OUT/IN de RAMPZ.
+class FarStream {
+private:
+#if defined(__AVR_HAVE_ELPM__)
+    uint16_t z;
+    uint8_t page;
+#else
+    const uint16_t* p;
+#endif
+
+public:
+    explicit FarStream(uint_farptr_t addr) {
+        seek(addr);
+    }
+
+    void seek(uint_farptr_t addr) {
+#if defined(__AVR_HAVE_ELPM__)
+        z = (uint16_t)addr;
+        page = (uint8_t)(addr >> 16);
+#else
+        p = (const uint16_t*)(uintptr_t)addr;
+#endif
+    }
+
+    // salta n palabras sin leerlas
+    void skip(uint16_t n) {
+#if defined(__AVR_HAVE_ELPM__)
+        uint32_t addr = (((uint32_t)page << 16) | z) + 2 * (uint32_t)n;
+        z = (uint16_t)addr;
+        page = (uint8_t)(addr >> 16);
+#else
+        p += n;
+#endif
+    }
+
+    uint_farptr_t position() const {
+#if defined(__AVR_HAVE_ELPM__)
+        return ((uint_farptr_t)page << 16) | z;
+#else
+        return (uint_farptr_t)(uintptr_t)p;
+#endif
+    }
+
+    // manda las n palabras que siguen derecho al SPI (SpiPump.h) y avanza
+    void pump(uint16_t n) {
+        spiPumpStream(position(), n);
+        skip(n);
+    }
+
+    inline uint16_t next() {
+#if defined(__AVR_HAVE_ELPM__)
+        uint16_t w;
+        asm volatile(
+            "out %[rampz], %[page]" "\n\t"
+            "elpm %A[w], Z+"        "\n\t"
+            "elpm %B[w], Z+"        "\n\t"
+            "in %[page], %[rampz]"  "\n\t"
+            "out %[rampz], __zero_reg__"
+            : [w] "=&r" (w), [z] "+z" (z), [page] "+r" (page)
+            : [rampz] "I" (_SFR_IO_ADDR(RAMPZ)));
+        return w;
+#else
+        return pgm_read_word(p++);
+#endif
+    }
+};
+
+// Lee un asset comprimido con RLE por palabras. Cada paquete empieza con una
+// palabra: con el bit 15 en 1 es una racha de (h & 0x7FFF) pixeles iguales y
+// la palabra que sigue es el color; si no, siguen h pixeles tal cual.
+// No se puede saltar a una posicion, solo avanzar, asi que quien recorta
+// salta pixeles con skip() en vez de seek().
+class RleStream {
+private:
+    FarStream src;
+    uint16_t left;  // pixeles que quedan del paquete actual
+    uint16_t color; // color de la racha
+    bool run;
+
+    void nextPacket() {
+        uint16_t h = src.next();
+        run = (h & 0x8000) != 0;
+        left = h & 0x7FFF;
+        if (run) {
+            color = src.next();
+        }
+    }
+
+public:
+    explicit RleStream(uint_farptr_t addr) : src(addr), left(0), color(0), run(false) {}
+
+    inline uint16_t next() {
+        if (left == 0) {
+            nextPacket();
+        }
+        left--;
+        return run ? color : src.next();
+    }
+
+    void skip(uint16_t n) {
+        while (n > 0) {
+            if (left == 0) {
+                nextPacket();
+            }
+            uint16_t k = n < left ? n : left;
+            if (!run) {
+                src.skip(k);
+            }
+            left -= k;
+            n -= k;
+        }
+    }
+
+    // como FarStream::pump: las rachas salen con spiPumpFill y los
+    // literales con spiPumpStream
+    void pump(uint16_t n) {
+        while (n > 0) {
+            if (left == 0) {
+                nextPacket();
+            }
+            uint16_t k = n < left ? n : left;
+            if (run) {
+                spiPumpFill(color, k);
+            } else {
+                src.pump(k);
+            }
+            left -= k;
+            n -= k;
+        }
+    }
+};
+
+// lo que usa Display para leer cualquier asset, comprimido o no
+#ifdef ASSET_RLE
+typedef RleStream AssetStream;
+#else
+typedef FarStream AssetStream;
+#endif
+
+// Animacion guardada como keyframe + un rectangulo por cuadro con lo que
+// cambia (SpriteAnim.h, generado por tools/gen_anim_delta.py). El keyframe
+// se lee con AssetStream; los deltas son chicos y van siempre sin comprimir.
+struct AnimDelta {
+    uint8_t x, y, w, h;      // rectangulo dentro del sprite (w = 0: igual al keyframe)
+    const uint16_t* pixels;  // w * h pixeles en PROGMEM
+};
+
+struct SpriteAnim {
+    const uint16_t* key;     // keyframe en PROGMEM
+    uint8_t w, h;
+    uint8_t frames;
+    const AnimDelta* deltas; // uno por cuadro, en PROGMEM
+};
+
+// lo que cambia (en coordenadas del sprite) al pasar del cuadro `from` al
+// `to`: la union de sus deltas. false si los dos cuadros son el keyframe
+inline bool animChangeRect(const SpriteAnim& anim, uint8_t from, uint8_t to,
+                           int& x, int& y, int& w, int& h) {
+    AnimDelta a, b;
+    memcpy_P(&a, &anim.deltas[from], sizeof(a));
+    memcpy_P(&b, &anim.deltas[to], sizeof(b));
+    if (a.w == 0) { a = b; }
+    if (b.w == 0) { b = a; }
+    if (a.w == 0) {
+        return false;
+    }
+    x = min(a.x, b.x);
+    y = min(a.y, b.y);
+    w = max(a.x + a.w, b.x + b.w) - x;
+    h = max(a.y + a.h, b.y + b.h) - y;
+    return true;
+}
+
+#endif
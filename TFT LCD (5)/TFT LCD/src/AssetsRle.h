@@ -0,0 +1,221 @@
+#ifndef AssetsRle_h
+#define AssetsRle_h
+
+#include "AssetBank.h"
+
+// Generado por tools/gen_rle.py, no editar a mano.
+// Assets comprimidos con RLE para ASSET_RLE (env:uno); se leen con AssetStream.
+
+const uint16_t dinoKey[300] PROGMEM = {
+	// dinoKey de SpriteAnim.h, 32x32px (2048 bytes sin comprimir)
+	0x8075, 0x0000, 0x800a, 0xffff, 0x8015, 0x0000, 0x0002, 0xffff, 0xffff, 0x8008, 0x4468, 0x0002, 0xffff, 0xffff, 0x8014, 0x0000,
+	0x0004, 0xffff, 0x4468, 0x4468, 0xffff, 0x8007, 0x4468, 0x0001, 0xffff, 0x8014, 0x0000, 0x0001, 0xffff, 0x800a, 0x4468, 0x0001,
+	0xffff, 0x8014, 0x0000, 0x0001, 0xffff, 0x800a, 0x4468, 0x0001, 0xffff, 0x8014, 0x0000, 0x0001, 0xffff, 0x8004, 0x4468, 0x8009,
+	0xffff, 0x8012, 0x0000, 0x0001, 0xffff, 0x8004, 0x4468, 0x0001, 0xffff, 0x8006, 0x0000, 0x0002, 0x4468, 0xffff, 0x8010, 0x0000,
+	0x8003, 0xffff, 0x8003, 0x4468, 0x8006, 0xffff, 0x0004, 0x0000, 0x0000, 0x4468, 0xffff, 0x8010, 0x0000, 0x0001, 0xffff, 0x8005,
+	0x4468, 0x0001, 0xffff, 0x8007, 0x0000, 0x0001, 0x4468, 0x8003, 0xffff, 0x800a, 0x0000, 0x8005, 0xffff, 0x8005, 0x4468, 0x0001,
+	0xffff, 0x8007, 0x0000, 0x8003, 0x4468, 0x0001, 0xffff, 0x800a, 0x0000, 0x0001, 0xffff, 0x8009, 0x4468, 0x0001, 0xffff, 0x8007,
+	0x0000, 0x8003, 0x4468, 0x8003, 0xffff, 0x8004, 0x0000, 0x8005, 0xffff, 0x8009, 0x4468, 0x8004, 0xffff, 0x8004, 0x0000, 0x0001,
+	0xffff, 0x8004, 0x4468, 0x0001, 0xffff, 0x8004, 0x0000, 0x0002, 0xffff, 0x19a3, 0x800c, 0x4468, 0x0004, 0xffff, 0x0000, 0x0000,
+	0xffff, 0x8004, 0x0000, 0x0001, 0xffff, 0x8004, 0x4468, 0x8006, 0xffff, 0x800d, 0x4468, 0x0001, 0xffff, 0x8007, 0x0000, 0x0001,
+	0xffff, 0x8017, 0x4468, 0x0001, 0xffff, 0x8007, 0x0000, 0x0002, 0xffff, 0xffff, 0x8015, 0x4468, 0x0002, 0xffff, 0xffff, 0x8008,
+	0x0000, 0x8003, 0xffff, 0x8013, 0x4468, 0x0001, 0xffff, 0x800b, 0x0000, 0x0001, 0xffff, 0x8012, 0x4468, 0x0002, 0xffff, 0xffff,
+	0x800b, 0x0000, 0x8003, 0xffff, 0x800e, 0x4468, 0x8003, 0xffff, 0x800e, 0x0000, 0x8003, 0xffff, 0x800c, 0x4468, 0x0002, 0xffff,
+	0xffff, 0x800f, 0x0000, 0x8003, 0xffff, 0x800c, 0x4468, 0x0002, 0xffff, 0xffff, 0x8011, 0x0000, 0x8003, 0xffff, 0x8009, 0x4468,
+	0x0002, 0xffff, 0xffff, 0x8014, 0x0000, 0x0001, 0xffff, 0x8005, 0x4468, 0x0001, 0xffff, 0x8003, 0x4468, 0x0001, 0xffff, 0x8015,
+	0x0000, 0x8003, 0xffff, 0x0008, 0x4468, 0x4468, 0xffff, 0x0000, 0xffff, 0x4468, 0x4468, 0xffff, 0x8017, 0x0000, 0x0003, 0xffff,
+	0x4468, 0xffff, 0x8003, 0x0000, 0x8003, 0xffff, 0x8017, 0x0000, 0x0002, 0xffff, 0xffff, 0x8005, 0x0000, 0x0002, 0xffff, 0xffff,
+	0x8017, 0x0000, 0x0002, 0xffff, 0xffff, 0x8005, 0x0000, 0x0002, 0xffff, 0xffff, 0x8017, 0x0000, 0x8004, 0xffff, 0x8003, 0x0000,
+	0x8004, 0xffff, 0x8015, 0x0000, 0x8004, 0xffff, 0x8003, 0x0000, 0x8004, 0xffff, 0x800a, 0x0000,
+};
+
+const uint16_t spriteCactus[478] ASSET_FAR = {
+	// spriteCactus de Cactus.h, 32x32px (2048 bytes sin comprimir)
+	0x802c, 0x0000, 0x0005, 0x4306, 0x4306, 0x4305, 0x4306, 0x5369, 0x8019, 0x0000, 0x0008, 0x6bcd, 0x5bc8, 0x6c69, 0x5c28, 0x6468,
+	0x6469, 0x850b, 0x5369, 0x8017, 0x0000, 0x000a, 0x744e, 0x6429, 0x6caa, 0x95cd, 0x8d8c, 0x8dac, 0x7d4b, 0x7d2a, 0x5c28, 0x5ba9,
+	0x8016, 0x0000, 0x000b, 0x63ca, 0x6c89, 0x7d2b, 0x95cd, 0x8dad, 0x8dac, 0x7d4b, 0x7d4b, 0x7d0a, 0x748a, 0x632c, 0x8015, 0x0000,
+	0x000b, 0x5bc8, 0x8d6c, 0x8d8d, 0x95ed, 0x8d6c, 0x858c, 0x856c, 0x8d8c, 0x7d4b, 0x6c89, 0x4327, 0x8015, 0x0000, 0x000b, 0x53a7,
+	0x74ea, 0x95cd, 0x95ee, 0x95ce, 0x95cd, 0x95ad, 0x95cc, 0x74ea, 0x5c27, 0x5327, 0x8015, 0x0000, 0x000b, 0x53a6, 0x74ea, 0xa62f,
+	0x95cd, 0x95ad, 0x8dad, 0x74ea, 0x858b, 0x6cc9, 0x5c27, 0x5327, 0x8015, 0x0000, 0x000f, 0x5bc8, 0x8d6c, 0x95cd, 0x8d8c, 0x95cd,
+	0x8dcd, 0x6ca9, 0x8d8b, 0x7d0a, 0x6449, 0x4b08, 0x63ac, 0x5367, 0x6428, 0x746c, 0x8011, 0x0000, 0x0010, 0x53a7, 0x74ea, 0x9e0f,
+	0x95ad, 0xa62f, 0x95ed, 0x6cc9, 0x7d2a, 0x74ea, 0x6c89, 0x4b07, 0x5368, 0x53c7, 0x7d2a, 0x6409, 0x538a, 0x8010, 0x0000, 0x0010,
+	0x53a7, 0x74ea, 0x95ce, 0x8d8d, 0x9dee, 0x9e0e, 0x7d0a, 0x7529, 0x6ca8, 0x5c27, 0x5b89, 0x5be8, 0x6448, 0x6488, 0x4346, 0x5368,
+	0x8010, 0x0000, 0x0010, 0x5bc8, 0x8d6c, 0x95ee, 0x8d8c, 0x95cd, 0x9e0e, 0x7d0a, 0x7509, 0x6ca8, 0x74e9, 0x850b, 0x854c, 0x7d4b,
+	0x6468, 0x4325, 0x5367, 0x8010, 0x0000, 0x0010, 0x53a7, 0x74ea, 0x9e0e, 0x8d8d, 0x95ee, 0x95ed, 0x7d2b, 0x8dac, 0x6cc9, 0x750a,
+	0x7d2b, 0x8d8c, 0x74ea, 0x4ba6, 0x4b46, 0x5b89, 0x8010, 0x0000, 0x0010, 0x4b86, 0x6cc9, 0x8dad, 0x8d8d, 0xa62f, 0x95ed, 0x7d2b,
+	0x856b, 0x6ce9, 0x7d2a, 0x95cd, 0x74ea, 0x4ba6, 0x4386, 0x4346, 0x001f, 0x8010, 0x0000, 0x000f, 0x53a7, 0x7d2b, 0x95ee, 0x8d8c,
+	0x95cd, 0x95ed, 0x7d2b, 0x7d4a, 0x7529, 0x6488, 0x6c69, 0x53c7, 0x53c7, 0x4b87, 0x5367, 0x8011, 0x0000, 0x000f, 0x5bc7, 0x854b,
+	0x9e0e, 0x8d8d, 0x95ee, 0x95ed, 0x7d2b, 0x7d4a, 0x6488, 0x4ba6, 0x53c7, 0x4b66, 0x4b66, 0x4b47, 0xffff, 0x8011, 0x0000, 0x000d,
+	0x4b87, 0x6cc9, 0x8dad, 0x8d8d, 0xa62f, 0x9e0e, 0x856c, 0x858b, 0x6468, 0x4ba6, 0x4346, 0x4b48, 0x538a, 0x8013, 0x0000, 0x000b,
+	0x4b87, 0x6cc9, 0x8d8c, 0x8dcd, 0x8d8c, 0x8dcc, 0x74ea, 0x750a, 0x6cca, 0x53c6, 0x4345, 0x8015, 0x0000, 0x000b, 0x53a7, 0x74ea,
+	0x95ed, 0x8dcc, 0x854c, 0x8dcc, 0x74ea, 0x74e9, 0x5c28, 0x5c07, 0x4346, 0x8015, 0x0000, 0x000b, 0x6409, 0x850b, 0x854b, 0x8d8c,
+	0x8d8c, 0x95cc, 0x750a, 0x854b, 0x53e7, 0x4b86, 0x4b47, 0x8015, 0x0000, 0x000b, 0x5b6b, 0x5c08, 0x6cc9, 0x95cd, 0x854b, 0x7d4b,
+	0x6cc9, 0x6448, 0x4366, 0x4b46, 0x53aa, 0x8012, 0x0000, 0x0013, 0x5104, 0x58c2, 0x58e2, 0x58e2, 0x5163, 0x5a24, 0x72c6, 0x6a86,
+	0x6285, 0x5a24, 0x49c3, 0x49a3, 0x5143, 0x58c2, 0x50c2, 0x50c2, 0x50c1, 0x50e2, 0x5965, 0x800d, 0x0000, 0x0008, 0x50e3, 0x7942,
+	0x89a3, 0x89a3, 0x8983, 0x8983, 0x8183, 0x8183, 0x8004, 0x8983, 0x0007, 0x8183, 0x8182, 0x7942, 0x7942, 0x7921, 0x6902, 0x5104,
+	0x800d, 0x0000, 0x0006, 0x48e3, 0x8162, 0x91a3, 0x91c3, 0x91c3, 0x89a3, 0x8008, 0x8982, 0x0005, 0x8162, 0x8162, 0x7941, 0x6902,
+	0x5103, 0x800d, 0x0000, 0x0005, 0x48e3, 0x7142, 0x7962, 0x89a3, 0x91a3, 0x8008, 0x8982, 0x0006, 0x8962, 0x8162, 0x7942, 0x6901,
+	0x60e2, 0x4924, 0x800d, 0x0000, 0x0006, 0x38e3, 0x50c1, 0x6902, 0x8183, 0x8983, 0x8962, 0x8008, 0x8982, 0x0005, 0x8142, 0x7101,
+	0x58c1, 0x48a2, 0x3186, 0x800d, 0x0000, 0x0006, 0x28a2, 0x60c1, 0x91e4, 0x9ac7, 0x89a3, 0x8962, 0x8007, 0x8982, 0x0005, 0x8962,
+	0x8142, 0x7941, 0x7121, 0x50c2, 0x800e, 0x0000, 0x0005, 0x2104, 0x5902, 0x8983, 0x9225, 0x91a3, 0x8007, 0x8982, 0x0006, 0x8962,
+	0x8142, 0x8142, 0x7941, 0x6901, 0x48e2, 0x800f, 0x0000, 0x0003, 0x5965, 0x6922, 0x8962, 0x8007, 0x8982, 0x0007, 0x8962, 0x8142,
+	0x7942, 0x7941, 0x7101, 0x5922, 0x5a07, 0x8010, 0x0000, 0x0002, 0x5965, 0x6923, 0x8006, 0x7122, 0x0007, 0x6902, 0x6901, 0x6101,
+	0x6101, 0x60e1, 0x5903, 0x5186, 0x8012, 0x0000, 0x0001, 0x4882, 0x800b, 0x40a2, 0x0001, 0x4145, 0x802a, 0x0000,
+};
+
+const uint16_t spriteMoneda[370] ASSET_FAR = {
+	// spriteMoneda de Moneda.h, 32x32px (2048 bytes sin comprimir)
+	0x80ad, 0x0000, 0x0006, 0x6410, 0x6390, 0x632e, 0x63ae, 0x6390, 0x6410, 0x8018, 0x0000, 0x000a, 0x2208, 0x29a8, 0x59e6, 0x59c5,
+	0x59c5, 0x59c4, 0x59c5, 0x59e5, 0x2169, 0x2208, 0x8015, 0x0000, 0x000c, 0x318c, 0x5a05, 0x6a03, 0xbb62, 0xe421, 0xe421, 0xdc21,
+	0xe421, 0xbb62, 0x6a03, 0x5a05, 0x2aaa, 0x8013, 0x0000, 0x0005, 0x3166, 0x4164, 0xab23, 0xec82, 0xf502, 0x8004, 0xfd22, 0x0005,
+	0xf502, 0xec81, 0xab42, 0x4164, 0x2945, 0x8010, 0x0000, 0x0007, 0xffff, 0x5a46, 0x92a3, 0xbb82, 0xf4c2, 0xfd22, 0xec41, 0x8004,
+	0xe3c0, 0x0007, 0xec21, 0xfd22, 0xf4c2, 0xbb82, 0x8ae4, 0x5267, 0xffff, 0x800e, 0x0000, 0x0007, 0x10c6, 0x6a24, 0xe462, 0xfd22,
+	0xfd22, 0xec41, 0xec00, 0x8004, 0xf440, 0x0007, 0xec00, 0xec41, 0xf522, 0xfd22, 0xeda8, 0x7349, 0x0843, 0x800d, 0x0000, 0x0008,
+	0x02aa, 0x5205, 0xa323, 0xf4e2, 0xf522, 0xec21, 0xec20, 0xfd02, 0x8004, 0xfd22, 0x0008, 0xfd02, 0xec20, 0xec21, 0xf522, 0xf5c6,
+	0xacaa, 0x5268, 0x000a, 0x800c, 0x0000, 0x0007, 0x3164, 0xa302, 0xf4e2, 0xfd22, 0xec21, 0xec00, 0xfd02, 0x8006, 0xfd42, 0x0007,
+	0xfd02, 0xed26, 0xeca3, 0xf522, 0xf5c7, 0xacca, 0x31a6, 0x800c, 0x0000, 0x0006, 0x3123, 0xc3a1, 0xfd42, 0xec41, 0xebe0, 0xfce2,
+	0x8007, 0xfd42, 0x0007, 0xfd22, 0xf525, 0xed69, 0xec61, 0xfd84, 0xcdac, 0x3185, 0x800c, 0x0000, 0x0006, 0x3123, 0xc381, 0xfd22,
+	0xec20, 0xebe0, 0xfd22, 0x8006, 0xfd42, 0x0008, 0xfd22, 0xf481, 0xf4a3, 0xedca, 0xe421, 0xfd84, 0xcd8c, 0x3185, 0x800c, 0x0000,
+	0x0006, 0x3123, 0xc381, 0xfd22, 0xec20, 0xebe0, 0xfd22, 0x8005, 0xfd42, 0x0009, 0xfd02, 0xf481, 0xf420, 0xf4a3, 0xedca, 0xec21,
+	0xfd84, 0xcd8c, 0x3185, 0x800c, 0x0000, 0x0006, 0x3123, 0xc381, 0xfd22, 0xec00, 0xec00, 0xfd22, 0x8004, 0xfd42, 0x000a, 0xfd22,
+	0xf481, 0xf420, 0xf420, 0xf4a3, 0xedca, 0xe421, 0xfd84, 0xcd8c, 0x3185, 0x800c, 0x0000, 0x0006, 0x3123, 0xc3a1, 0xfd42, 0xec61,
+	0xebe0, 0xfce1, 0x8003, 0xfd42, 0x0002, 0xfd22, 0xf481, 0x8003, 0xf420, 0x0006, 0xf505, 0xed48, 0xec81, 0xfd84, 0xcdac, 0x3165,
+	0x800c, 0x0000, 0x000a, 0x3144, 0x9ae2, 0xeca2, 0xfd22, 0xec41, 0xebe0, 0xfce1, 0xfd42, 0xfd22, 0xf481, 0x8003, 0xf420, 0x0007,
+	0xf505, 0xed48, 0xeca2, 0xfd22, 0xed65, 0x9429, 0x3185, 0x800c, 0x0000, 0x0013, 0x001f, 0x3964, 0x92c2, 0xf4e1, 0xfd22, 0xec61,
+	0xec41, 0xf543, 0xf4e3, 0xf483, 0xf483, 0xf482, 0xf505, 0xed47, 0xec82, 0xf522, 0xfd63, 0x5a44, 0x2985, 0x800e, 0x0000, 0x0012,
+	0x0064, 0x6a03, 0xdc22, 0xfd22, 0xfd22, 0xec81, 0xed48, 0xf5eb, 0xf5ca, 0xedca, 0xedea, 0xed48, 0xec82, 0xfd22, 0xfdc6, 0xdd27,
+	0x2103, 0x2965, 0x800f, 0x0000, 0x0006, 0x5248, 0x8283, 0xab43, 0xed86, 0xfd42, 0xec82, 0x8004, 0xec21, 0x0006, 0xec82, 0xfd42,
+	0xeda7, 0xacca, 0x83ca, 0x4a08, 0x8011, 0x0000, 0x0005, 0x2104, 0x3185, 0x9c6a, 0xe60a, 0xf5a6, 0x8004, 0xfd83, 0x0005, 0xf5a6,
+	0xe60a, 0x9c6a, 0x31a6, 0x20c4, 0x8014, 0x0000, 0x000a, 0x4a06, 0x5aa8, 0xaccb, 0xd5ac, 0xcdac, 0xcdac, 0xd5ac, 0xacca, 0x5a88,
+	0x4a47, 0x8017, 0x0000, 0x0008, 0x2947, 0x39e7, 0x31a6, 0x39c6, 0x39a6, 0x39a6, 0x41e7, 0x2947, 0x8019, 0x0000, 0x8005, 0x07ff,
+	0x80ce, 0x0000,
+};
+
+const uint16_t splashFondo[1352] ASSET_FAR = {
+	// splashFondo de SplashArt.h, 32x57px (3648 bytes sin comprimir)
+	0x8081, 0xffff, 0x001b, 0xf7de, 0xffdf, 0xbdf7, 0x8410, 0xe73c, 0xf7de, 0xffdf, 0xffff, 0xffff, 0xa534, 0xef7d, 0xffdf, 0xdefb,
+	0xbdd7, 0xffff, 0xf7de, 0xffff, 0xf7de, 0xa514, 0xdefb, 0x94d2, 0x6b8d, 0xdf1b, 0xffdf, 0xffff, 0xef7d, 0xad95, 0x8004, 0xffff,
+	0x001c, 0xf7de, 0xffff, 0xf7be, 0x8c71, 0x9cd3, 0x4248, 0xef5d, 0xf7de, 0xffdf, 0xf7de, 0x39e7, 0xb5d6, 0xf7de, 0xe73c, 0x738e,
+	0xf7de, 0xffff, 0xffdf, 0xffdf, 0x5aeb, 0xf7be, 0x738e, 0xc658, 0x4a69, 0xf7be, 0xffff, 0xdf1b, 0x7bcf, 0x8004, 0xffff, 0x001c,
+	0xffdf, 0xf7be, 0xffff, 0x8430, 0xb596, 0x4a69, 0xef7d, 0xf7de, 0xf7de, 0xef5d, 0x4a69, 0x73ae, 0xffdf, 0xffdf, 0x528a, 0xf7de,
+	0xf7de, 0xffdf, 0xffdf, 0x528a, 0xf7de, 0x6b6d, 0xad55, 0x528a, 0xffdf, 0xf7de, 0xd6ba, 0x7c0f, 0x8005, 0xffff, 0x001b, 0xffdf,
+	0xf7de, 0x9492, 0x2945, 0xdf1b, 0xf7be, 0xffdf, 0xf7de, 0xad55, 0x9d13, 0x4a69, 0xffdf, 0xf7de, 0x528a, 0xf7de, 0xdefb, 0xf7be,
+	0xdedb, 0x73ae, 0xffff, 0x6b4d, 0x39e7, 0xf7be, 0xf7de, 0xf7be, 0xd6ba, 0x7c0f, 0x8005, 0xffff, 0x001b, 0xffdf, 0xf7de, 0x8430,
+	0x5b0b, 0xad55, 0xffff, 0xffdf, 0xf7be, 0x73ae, 0x4a49, 0x2124, 0xdf3b, 0xf7de, 0x6b8d, 0xe75c, 0x2965, 0xb5b6, 0xa534, 0xa534,
+	0xf7df, 0x6b6d, 0x7bcf, 0xb596, 0xf7de, 0xffff, 0xce79, 0x8450, 0x8004, 0xffff, 0x001c, 0xffdf, 0xffff, 0xffdf, 0x8410, 0xce79,
+	0x4a69, 0xdefb, 0xf7de, 0xf7de, 0x4a69, 0xf7be, 0xad55, 0x94d2, 0xf7de, 0x8cb1, 0x7c0f, 0x8c91, 0x528a, 0x6b8e, 0xe71c, 0xffdf,
+	0x630c, 0xf79e, 0x4a69, 0xdf1b, 0xf7de, 0xc618, 0x8450, 0x8004, 0xffff, 0x001c, 0xf7de, 0xffdf, 0xf7de, 0x7bef, 0xd6da, 0xe73c,
+	0x528a, 0xf7be, 0xef9d, 0x630c, 0xf7de, 0xef7d, 0x630c, 0xf7de, 0xbe38, 0x18e3, 0xef9d, 0x9492, 0x31a7, 0xf7be, 0xf7df, 0x6b4d,
+	0xf79e, 0xdf1b, 0x4a69, 0xf7de, 0xdf1b, 0xce79, 0x8004, 0xffff, 0x001c, 0xf7de, 0xffdf, 0xffff, 0x94b2, 0xdf1b, 0xf7be, 0xb596,
+	0xc638, 0xc638, 0xa534, 0xf7de, 0xf7de, 0x6b8e, 0xf7de, 0xef7e, 0x9cd3, 0xf7be, 0xf79e, 0x8c72, 0xffdf, 0xffdf, 0x94b2, 0xffde,
+	0xffdf, 0xbdf7, 0xdedb, 0xe71c, 0xce79, 0x8010, 0xffff, 0x0008, 0xf7be, 0xffff, 0xffdf, 0xf7de, 0xffdf, 0xffdf, 0xffde, 0xffdf,
+	0x8018, 0xffff, 0x0004, 0xffdf, 0xf7de, 0xffde, 0xffff, 0x8003, 0xffde, 0x0001, 0xf7de, 0x8018, 0xffff, 0x0009, 0xf7de, 0xd699,
+	0xbdd5, 0xf7bd, 0xffdd, 0xef7c, 0x842f, 0xad74, 0xfffe, 0x8016, 0xffff, 0x000d, 0xfffe, 0xded9, 0x7bcc, 0xb572, 0x83ec, 0xef5b,
+	0x738b, 0xded8, 0x7bcc, 0xffde, 0xfffe, 0xffff, 0xffdf, 0x800c, 0xffff, 0x0014, 0xf7de, 0xffdf, 0xffdf, 0xffff, 0xf7df, 0xffdf,
+	0xf7be, 0xfffd, 0x83cb, 0xeef5, 0xe6b3, 0xde51, 0x62c6, 0xeeb4, 0xf6d2, 0xaccd, 0xd679, 0xf7be, 0xce57, 0xef5c, 0x800c, 0xffff,
+	0x0014, 0xf7de, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xef7d, 0x94d1, 0x52c8, 0x8c6e, 0xbdd2, 0xad4e, 0xad4e, 0xc632, 0xe6d4, 0xeed3,
+	0xce31, 0x7329, 0x840b, 0xad50, 0x7b8e, 0x800d, 0xffff, 0x8003, 0xf7de, 0x0010, 0xc677, 0x5b6a, 0x8d31, 0x84cf, 0x5b6a, 0x7c4d,
+	0x8cce, 0x8cee, 0x7c4b, 0x5b68, 0x846a, 0xded3, 0xeed3, 0xf732, 0xef15, 0x83af, 0x800c, 0xffff, 0x8003, 0xf7de, 0x0005, 0xb5b6,
+	0x63cb, 0xa5f3, 0x9dd2, 0x9df2, 0x8003, 0x9df3, 0x0009, 0x9dd2, 0x9dd1, 0x9e13, 0x9590, 0x6367, 0xd672, 0xf6b0, 0xcdee, 0xb553,
+	0x8008, 0xffff, 0x0019, 0xffdf, 0xf7df, 0xffdf, 0xffdf, 0xf7de, 0xf7de, 0xd6ba, 0x636b, 0xa5f3, 0x9df2, 0x9df2, 0x9612, 0x9611,
+	0x9611, 0x9612, 0x9611, 0x95f2, 0x9613, 0x9612, 0xa5d2, 0x6ae8, 0xeed3, 0xe690, 0x942b, 0x7bee, 0x8003, 0xf7de, 0x8004, 0xffff,
+	0x001c, 0xffdf, 0xffff, 0xffdf, 0xffff, 0xf7de, 0xa5b4, 0x3226, 0x84f0, 0x9df2, 0x95f2, 0x9e12, 0x9611, 0x9611, 0x8df0, 0x9e31,
+	0x9612, 0x9e13, 0x9612, 0x9631, 0x9dd3, 0x9d33, 0x8c2b, 0xef13, 0xeef5, 0x7bee, 0xef5d, 0xf7de, 0xffdf, 0x8004, 0xffff, 0x001c,
+	0xffdf, 0xffdf, 0xf7de, 0xf7de, 0x8cd1, 0x7c6f, 0x5bab, 0x744d, 0x9df2, 0x9e12, 0x9611, 0x9611, 0x95f1, 0x9df2, 0xa613, 0x8d51,
+	0x748e, 0x9e12, 0x9e11, 0x95f2, 0x9df4, 0x5b68, 0xe714, 0x8baa, 0xc617, 0xf7be, 0xffff, 0xffdf, 0x8005, 0xffff, 0x001b, 0xffdf,
+	0xf7de, 0xbe16, 0x6c0d, 0x9db2, 0x00e0, 0x8d70, 0x9dd1, 0x9e12, 0x9e11, 0x9e12, 0x6c8d, 0x7ccf, 0x4b09, 0x63cc, 0x9db2, 0x9dd2,
+	0x9e10, 0x9611, 0x9612, 0x7ced, 0xb56f, 0x9bed, 0x9471, 0xe73c, 0xf7de, 0xf7de, 0x8004, 0xffff, 0x001c, 0xffdf, 0xffde, 0xffde,
+	0x636a, 0xa613, 0x95f2, 0x9612, 0x9dd2, 0xa5d2, 0x9e12, 0x9e31, 0x95f1, 0x9df2, 0x1983, 0x6c4d, 0x9dd3, 0x9df2, 0x9df2, 0x9e12,
+	0x9e12, 0x95d2, 0xa5b1, 0x8c2a, 0xeef5, 0xe6d8, 0x7b8c, 0xffdf, 0xffdf, 0x8004, 0xffff, 0x0010, 0xf7df, 0xf7df, 0xd6da, 0x73ed,
+	0xa5b3, 0xadd3, 0xa5d3, 0x9d92, 0x31e6, 0x3205, 0x8550, 0x9612, 0x9df3, 0x2184, 0x534a, 0x9df3, 0x8004, 0x9e12, 0x0008, 0x9df3,
+	0xadf2, 0x7388, 0xe6b4, 0x7b8a, 0xd698, 0xf7de, 0xf7be, 0x8004, 0xffff, 0x0010, 0xffdf, 0xf7df, 0xa5b5, 0x8cd1, 0xc616, 0xd678,
+	0xbe36, 0x6bec, 0x0000, 0x0800, 0x10c2, 0x95b2, 0x9dd3, 0xad93, 0xb5d4, 0x95d2, 0x8003, 0x9e12, 0x0009, 0x9612, 0x95f2, 0xae33,
+	0x6b88, 0xbd8f, 0xb572, 0xf7dd, 0xf7be, 0xf7df, 0x8004, 0xffff, 0x001c, 0xf7de, 0xf7ff, 0xa5b5, 0x8cf1, 0xadb4, 0xb5d4, 0xadd4,
+	0x6c0c, 0x0020, 0x1000, 0x28a1, 0x63cb, 0x9dd3, 0xce16, 0xde77, 0xbe34, 0x9df2, 0x9e12, 0x9e11, 0x9612, 0x95f2, 0xa612, 0x73a9,
+	0xef36, 0x83ed, 0xef5c, 0xffdf, 0xffdf, 0x8004, 0xffff, 0x001c, 0xf7fe, 0xf7de, 0xce98, 0x7c2e, 0x9dd3, 0x95f2, 0x9e12, 0x8d50,
+	0x10c1, 0xbc0e, 0xecf2, 0x6ae8, 0x9e33, 0xa5d3, 0xbe15, 0xadd3, 0x9df2, 0x9e12, 0x9e11, 0x9612, 0x9612, 0x9dd2, 0x7c0a, 0xce12,
+	0x7bad, 0xf7de, 0xffdf, 0xffdf, 0x8004, 0xffff, 0x001c, 0xf7fe, 0xfffe, 0xffde, 0x5b2a, 0x9e14, 0x9632, 0x9611, 0xa612, 0x7389,
+	0xab8b, 0xe511, 0x62c6, 0x9e33, 0x8df3, 0x9dd3, 0x9df3, 0x9df2, 0x9df2, 0x9e11, 0x9e12, 0x95d1, 0x8d2f, 0xa52f, 0x7b88, 0xf7bd,
+	0xffde, 0xf7de, 0xf7de, 0x8004, 0xffff, 0x001c, 0xffdf, 0xffde, 0xffde, 0xadb5, 0x746e, 0x9df3, 0x95f1, 0x9611, 0x9613, 0x84cd,
+	0x5b48, 0x8d2e, 0x9dd2, 0x9dd2, 0xa5b2, 0xadb2, 0x9df3, 0x9df2, 0x9df2, 0x9e12, 0x9df2, 0x6bea, 0xdeb5, 0x9c6c, 0xd6d9, 0xef9e,
+	0xffdf, 0xffdf, 0x8004, 0xffff, 0x0011, 0xffbf, 0xffdf, 0xefdf, 0xf7fe, 0x8c90, 0x7c2e, 0xae13, 0x9df2, 0xa5d4, 0x9dd3, 0x9e12,
+	0x95f2, 0x9df2, 0x9e13, 0x9632, 0x8e31, 0x95f3, 0x8003, 0x9df2, 0x0008, 0xa5f2, 0x6388, 0xef16, 0x942b, 0xd6ba, 0xf7df, 0xf7df,
+	0xf7be, 0x8004, 0xffff, 0x0018, 0xf7de, 0xf7be, 0xdefb, 0x8cb1, 0x8c91, 0x9512, 0x5bab, 0x84ef, 0x9df2, 0x95f1, 0x95f2, 0x9dd2,
+	0x8d51, 0x538a, 0x4b68, 0x7d2f, 0x9e13, 0x9df1, 0x9df2, 0x9df2, 0x7c6b, 0xbdb0, 0x7b69, 0xc637, 0x8008, 0xffff, 0x0018, 0xffdf,
+	0xe73c, 0x4248, 0xad74, 0xa594, 0x63cc, 0x5b8b, 0x8d50, 0x9611, 0x95f1, 0x95f1, 0x8530, 0x32a6, 0x9dd3, 0xa613, 0x53ca, 0x74ef,
+	0x9dd1, 0xa612, 0x9e12, 0x6388, 0xeef5, 0x83ab, 0xf7de, 0x8008, 0xffff, 0x0018, 0xf7be, 0xd6da, 0x4248, 0x5b0b, 0x6bed, 0x84d0,
+	0x6c6d, 0x95f2, 0x9611, 0x9611, 0x9e12, 0x5bca, 0x5369, 0x74ae, 0x95b2, 0xa614, 0x4328, 0x9e12, 0x9df2, 0x84ee, 0xa52e, 0xe6b4,
+	0xc5d3, 0xad75, 0x8008, 0xffff, 0x0018, 0xf7de, 0xffdf, 0xce79, 0xd6fa, 0xc698, 0x3246, 0x9e12, 0x9e12, 0x95f1, 0x95f1, 0x9e12,
+	0x9dd2, 0x748d, 0x746d, 0x642c, 0x9dd2, 0x6c6d, 0x8d30, 0x9dd2, 0x63a9, 0xded4, 0xd653, 0x7349, 0xef7c, 0x8008, 0xffff, 0x0001,
+	0xffdf, 0x8003, 0xf7de, 0x0014, 0xb5f5, 0x7caf, 0x9dd2, 0x9df2, 0x9e12, 0x9df2, 0x9df1, 0x9df2, 0x9dd2, 0x8d70, 0x640b, 0x9df3,
+	0x9db1, 0x4348, 0xa613, 0x6388, 0xeef5, 0x83a9, 0xffbc, 0xf7de, 0x8008, 0xffff, 0x000a, 0xffdf, 0xffdf, 0xffff, 0xf7de, 0x7c2e,
+	0x9531, 0x7ccf, 0x9591, 0xa613, 0x95d2, 0x8004, 0x9df2, 0x000a, 0x53a9, 0x8d50, 0x9dd1, 0x9e33, 0x9df3, 0x7be9, 0xf715, 0x8beb,
+	0xd6b8, 0xf7be, 0x8008, 0xffff, 0x8004, 0xffdf, 0x0014, 0x4248, 0x9512, 0xae15, 0x8d11, 0x538a, 0x9592, 0x95d2, 0x9df2, 0x95d1,
+	0x9e12, 0x9e12, 0xa5f2, 0x9df1, 0x8df2, 0x9df2, 0x8429, 0xeef4, 0xde96, 0x94d2, 0xf7de, 0x8008, 0xffff, 0x8003, 0xffdf, 0x0015,
+	0xc618, 0xad95, 0xe77c, 0xefdd, 0xe7dc, 0xdf9b, 0x5beb, 0x9591, 0x95d2, 0x9e12, 0x9e11, 0x9df1, 0x9df1, 0x9dd0, 0x9633, 0x95f2,
+	0x8408, 0xde72, 0x7b8a, 0xefbd, 0xf7df, 0x800a, 0xffff, 0x000a, 0xffdf, 0x94f2, 0xe77c, 0xe7dc, 0xdfdb, 0xe7dc, 0xe7dc, 0xdfdb,
+	0x5b8a, 0xa5f3, 0x8003, 0x9df2, 0x0009, 0x95f1, 0x95f1, 0x95f2, 0x9e33, 0x6ba8, 0xe6b3, 0x8ba9, 0xded9, 0xf7ff, 0x8009, 0xffff,
+	0x0017, 0xffdf, 0xffff, 0x94d2, 0xe79c, 0xe7dd, 0xe7fc, 0xdffb, 0xe7dc, 0xe7dc, 0xbe96, 0x6c2c, 0x9dd2, 0x9df2, 0x9df2, 0x95f1,
+	0x95f1, 0x9e12, 0x9e12, 0x6368, 0xe6f5, 0xf6f6, 0x7b8b, 0xf7df, 0x8008, 0xffff, 0x0006, 0xf7df, 0xffff, 0xffff, 0xa534, 0xd6fa,
+	0xefdd, 0x8005, 0xe7dc, 0x000c, 0x63cb, 0xa613, 0x9dd2, 0x9e12, 0x9611, 0x9e12, 0x95f2, 0x9df2, 0x6c0a, 0xd653, 0xd633, 0x8c0d,
+	0x800a, 0xffff, 0x0005, 0xf7de, 0xf7be, 0xce99, 0xa574, 0xe7bc, 0x8005, 0xe7dc, 0x000d, 0x9531, 0x8d30, 0x9df2, 0x9e12, 0x95f1,
+	0x95f1, 0x9612, 0x9df2, 0x9d90, 0x8c4b, 0x83ca, 0xad11, 0xef7c, 0x800c, 0xffff, 0x0003, 0x7c0f, 0xefbc, 0xefdd, 0x8004, 0xe7dc,
+	0x0005, 0xbeb7, 0x746d, 0x9df2, 0x9e12, 0x9e11, 0x8003, 0x9e12, 0x0009, 0xa612, 0x6368, 0xded6, 0xd635, 0x83ac, 0xf7de, 0xf7de,
+	0xffdf, 0xffdf, 0x8008, 0xffff, 0x0003, 0xad95, 0xbe17, 0xe7bc, 0x8004, 0xe7dc, 0x0005, 0xdf9b, 0x63eb, 0x95b2, 0x95f2, 0x9e32,
+	0x8003, 0x9e12, 0x0007, 0x9df2, 0x9d91, 0x73ea, 0xef17, 0x8beb, 0xf7dd, 0xf7de, 0x800a, 0xffff, 0x0004, 0xf7de, 0x7c0f, 0xdf3b,
+	0xe7bc, 0x8004, 0xe7dc, 0x0010, 0x5b8b, 0x9e13, 0x95d1, 0x9611, 0x9df2, 0x9e12, 0x9e12, 0x95f2, 0x9df2, 0x7c6c, 0xa550, 0x8bea,
+	0xce77, 0xce98, 0xfffe, 0xffdf, 0x8008, 0xffff, 0x0004, 0xf7de, 0xf7be, 0x6bcd, 0xd71a, 0x8004, 0xe7dc, 0x0003, 0x5b8b, 0x642c,
+	0x8d90, 0x8003, 0x9e12, 0x000a, 0x9612, 0x9632, 0x9612, 0x9dd2, 0x73ea, 0xa4ee, 0xad51, 0x73ac, 0xf7dd, 0xf7de, 0x8008, 0xffff,
+	0x001c, 0xf7de, 0xffdf, 0xf7be, 0x7c0f, 0xadd5, 0xefdd, 0xe7dc, 0xe7bd, 0x63cc, 0x5369, 0xa613, 0x95f1, 0x9df1, 0x9df2, 0x9df1,
+	0x9df2, 0x9df1, 0x9df2, 0x9df2, 0x6c2b, 0x844c, 0x946d, 0xce56, 0xb574, 0xf79d, 0xffdf, 0xf7df, 0xf7df, 0x8004, 0xffff, 0x0019,
+	0xf7de, 0xffdf, 0xf7be, 0xf7be, 0xbdf6, 0x740e, 0xb636, 0xe7bc, 0x63cc, 0x5b6a, 0x9db2, 0x9df2, 0x7d0e, 0x854f, 0x9e12, 0x95d1,
+	0x9df1, 0x9e12, 0x95d1, 0x9e12, 0x8d0f, 0x5327, 0x846d, 0xbdf4, 0x9490, 0x8003, 0xf7de, 0x8004, 0xffff, 0x000f, 0xffdf, 0xffdf,
+	0xf7de, 0xf7be, 0xdf1b, 0x638c, 0x742f, 0x5b6b, 0x3206, 0x6bcc, 0x744d, 0x95d2, 0xa613, 0x4b68, 0x9e12, 0x8004, 0x9df2, 0x0009,
+	0x95d2, 0x9df1, 0x9df2, 0x6c2c, 0x6bab, 0x5b0a, 0xf7bd, 0xf7de, 0xf7de, 0x8004, 0xffff, 0x8004, 0xf7de, 0x0018, 0x8c70, 0x6bad,
+	0x740e, 0x5b6c, 0xadd5, 0x52e9, 0xa5b3, 0xae14, 0xadf4, 0x3a86, 0x63cb, 0x63ab, 0x63cc, 0x6bec, 0x6c0d, 0x6c2d, 0x6c4c, 0x6c4d,
+	0x6c0d, 0x740d, 0x52a9, 0x2964, 0xe71b, 0xffdf, 0x8008, 0xffff, 0x000f, 0xffde, 0xe73c, 0xceda, 0xefbd, 0xce79, 0x6bad, 0x638c,
+	0x6bcc, 0x6bad, 0xce99, 0xf7de, 0xf7de, 0xef7c, 0xe73b, 0xd6fa, 0x8004, 0xd6da, 0x0003, 0xdefb, 0xe75c, 0xf7be, 0x800c, 0xffff,
+	0x0008, 0xf7ff, 0xffff, 0xf7be, 0xf7de, 0xf7fe, 0xf7de, 0xffdf, 0xf7de, 0x800c, 0xffdf, 0x800a, 0xffff, 0x0009, 0xffdf, 0xffff,
+	0xf7df, 0xffff, 0xffdf, 0xffdf, 0xffde, 0xf7de, 0xf7de, 0x8009, 0xffdf, 0x800f, 0xffff, 0x000a, 0xffdf, 0xffff, 0xf7df, 0xffdf,
+	0xffdf, 0xffff, 0xffff, 0xf7de, 0xffff, 0xf7de, 0x802d, 0xffff,
+};
+
+const uint16_t splashGameover[283] ASSET_FAR = {
+	// splashGameover de SplashArt.h, 32x57px (3648 bytes sin comprimir)
+	0x8250, 0x0000, 0x0006, 0x0040, 0x0860, 0x0000, 0x0000, 0x0860, 0x2982, 0x8019, 0x0000, 0x000a, 0x0880, 0x8ce6, 0x84c6, 0x6be5,
+	0x84a5, 0x7445, 0x7c86, 0x3a23, 0x1901, 0x0020, 0x8015, 0x0000, 0x000b, 0x0020, 0x5b85, 0x9dc7, 0x5ba5, 0x9566, 0xa627, 0x8d46,
+	0xa607, 0xae26, 0xae06, 0x63a4, 0x8015, 0x0000, 0x000c, 0x3243, 0x8d67, 0x8d27, 0x29e5, 0x8d66, 0xa627, 0xa627, 0x8d06, 0x9e07,
+	0x95c6, 0x84e6, 0x10e1, 0x8014, 0x0000, 0x0008, 0x6425, 0x95a7, 0x9e06, 0x9566, 0xa607, 0xa627, 0xa627, 0x9dc6, 0x8003, 0x9e07,
+	0x0001, 0x2182, 0x8013, 0x0000, 0x0004, 0x0020, 0x6c66, 0x9de7, 0xa626, 0x8007, 0xa627, 0x0002, 0x9e07, 0x1941, 0x8014, 0x0000,
+	0x0004, 0x6405, 0xa607, 0x7cc6, 0x8d26, 0x8006, 0xa627, 0x0002, 0x8506, 0x0860, 0x8014, 0x0000, 0x000b, 0x29e2, 0x9de7, 0x95a6,
+	0x7465, 0x6c45, 0x7466, 0x6c26, 0x6c45, 0x6c45, 0x63c5, 0x1922, 0x8015, 0x0000, 0x000b, 0x0040, 0x7ce6, 0x8d67, 0x8d67, 0x95a7,
+	0x95a7, 0x7467, 0x9de7, 0xa607, 0x8526, 0x08a1, 0x8015, 0x0000, 0x000a, 0x1101, 0x7cc6, 0x9dc6, 0x5ba5, 0x5ba6, 0x5385, 0x4b44,
+	0x42c4, 0x29c3, 0x0880, 0x8015, 0x0000, 0x0009, 0x0880, 0x6c26, 0x9de7, 0x84e6, 0x63e7, 0x5ba7, 0x2162, 0x29a2, 0x1101, 0x8016,
+	0x0000, 0x000a, 0x0040, 0x6c25, 0x9de7, 0x7445, 0x7466, 0x5b87, 0x6c46, 0x4b45, 0x5ba5, 0x08a1, 0x8016, 0x0000, 0x000a, 0x4b04,
+	0x95c7, 0x8d46, 0x7ce6, 0x5385, 0x6c46, 0x8547, 0x4b45, 0x0880, 0x0020, 0x8015, 0x0000, 0x0009, 0x29e3, 0x95c7, 0xa607, 0x9dc6,
+	0x84e6, 0x9de7, 0xa607, 0x8d67, 0x3a84, 0x8012, 0x0000, 0x0006, 0x0020, 0x0881, 0x10a1, 0x1921, 0x42a3, 0x9586, 0x8005, 0xa627,
+	0x0004, 0x95c7, 0x7d07, 0x3a64, 0x0020, 0x8011, 0x0000, 0x000f, 0x0020, 0x63e5, 0x9587, 0x9de7, 0xa5e7, 0x9de7, 0x9de7, 0x9e07,
+	0x9de7, 0x7445, 0x8d87, 0x7d27, 0x5be5, 0x8506, 0x3a23, 0x8012, 0x0000, 0x000e, 0x08c1, 0x6426, 0x7d07, 0x74c7, 0x6c66, 0x7d07,
+	0x7d07, 0x9dc7, 0x9da6, 0x6426, 0x6406, 0x5be6, 0x95a7, 0x4b04, 0x8013, 0x0000, 0x000d, 0x0860, 0x3a64, 0x6406, 0x4b25, 0x74c7,
+	0x7d07, 0x8d87, 0xa607, 0x2a03, 0x4b45, 0x7d27, 0x8d46, 0x1901, 0x8015, 0x0000, 0x000b, 0x0020, 0x1942, 0x7d07, 0x7d07, 0x9dc7,
+	0x5b64, 0x0020, 0x1962, 0x7d07, 0x5be6, 0x1922, 0x8016, 0x0000, 0x0009, 0x1901, 0x7ce7, 0x7d07, 0x3a64, 0x0000, 0x0000, 0x0860,
+	0x1921, 0x0040, 0x8017, 0x0000, 0x0004, 0x0020, 0x2182, 0x21a2, 0x1942, 0x8251, 0x0000,
+};
+const uint16_t dinoDelta1[95] PROGMEM = {
+	// cuadro 1, 19x5px en (7, 27)
+	0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x4468, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
+	0xffff, 0xffff, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xffff, 0xffff, 0xffff, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+const AnimDelta dinoDeltas[2] PROGMEM = {
+    { 0, 0, 0, 0, 0 },
+    { 7, 27, 19, 5, dinoDelta1 },
+};
+
+const SpriteAnim dinoAnim = { dinoKey, 32, 32, 2, dinoDeltas };
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef Benchmark_h
+#define Benchmark_h
+
+#include <Arduino.h>
+#include "AssetBank.h"
+
+// Banco de pruebas del display (env:bench y env:bench_lib en platformio.ini).
+// Repite cada operacion de dibujo, la cronometra con micros() y manda por
+// Serial una linea por prueba:
+//   nombre  veces  us por vez  kpx/s  % del maximo del SPI
+// El maximo es el SPI por hardware a fck/2: 16 bits por pixel a F_CPU / 2.
+//
+// Es una plantilla para no depender del orden de las clases en main.cpp:
+// sirve con cualquier D que tenga los metodos de Display.
+
+const uint32_t BENCH_MAX_PX_PER_S = F_CPU / 2 / 16;
+
+inline void benchLine(Print& out, const __FlashStringHelper* name, uint16_t reps,
+                      uint32_t pixelsPerRep, uint32_t elapsedUs) {
+    uint32_t perRep = elapsedUs / reps;
+    uint32_t kpxPerS = elapsedUs ? pixelsPerRep * reps * 1000 / elapsedUs : 0; // px/ms = kpx/s
+    out.print(name);
+    out.print(F("\tx"));
+    out.print(reps);
+    out.print(F("\t"));
+    out.print(perRep);
+    out.print(F(" us\t"));
+    out.print(kpxPerS);
+    out.print(F(" kpx/s\t"));
+    out.print(kpxPerS * 100 / (BENCH_MAX_PX_PER_S / 1000));
+    out.println(F("%"));
+}
+
+// cronometra `reps` veces la expresion `op` (que dibuja `px` pixeles) en
+// el display `d`, hasta que termina de salir todo (con -DRENDER_QUEUE)
+#define BENCH(out, d, name, reps, px, op)                       \
+    do {                                                        \
+        uint32_t benchStart = micros();                         \
+        for (uint16_t benchRep = 0; benchRep < (reps); benchRep++) { \
+            op;                                                 \
+        }                                                       \
+        (d).fence();                                            \
+        benchLine(out, F(name), reps, px, micros() - benchStart); \
+    } while (0)
+
+// 16 rectangulos chicos como los de un cuadro del juego (piso, HUD, borrados)
+template <class D>
+void benchSmallRects(D& display, uint16_t color) {
+    for (uint8_t i = 0; i < 16; i++) {
+        display.fillRect(i * 15, 280, 8, 8, color);
+    }
+}
+
+template <class D, class A>
+void runDisplayBenchmarks(D& display, Print& out, const A& anim,
+                          uint_farptr_t sprite, uint_farptr_t splash) {
+    out.println(F("bench: prueba\tveces\tus/vez\tvelocidad\t% SPI"));
+    BENCH(out, display, "fillScreen", 4, 240UL * 320, display.fillScreen(benchRep & 1 ? 0xFFFF : 0x0000));
+    BENCH(out, display, "fillRect 32x32", 200, 32 * 32, display.fillRect(benchRep % 200, 100, 32, 32, benchRep));
+    BENCH(out, display, "fillRect 240x16", 100, 240 * 16, display.fillRect(0, 300, 240, 16, benchRep));
+    BENCH(out, display, "sprite 32x32", 200, 32 * 32, display.drawRGBBitmapFar(benchRep % 200, 150, sprite, 32, 32));
+    BENCH(out, display, "dino cuadro", 200, 32 * 32, display.drawAnimFrame(benchRep % 200, 200, anim, benchRep & 1));
+    BENCH(out, display, "dino delta", 200, 19 * 5, display.drawAnimDelta(100, 200, anim, benchRep & 1, (benchRep + 1) & 1));
+    BENCH(out, display, "splash x2", 10, 64 * 114, display.drawRGBBitmapScaled(88, 10, splash, 32, 57, 2));
+    // 16 rectangulos con una transaccion cada uno y con una sola para todo el cuadro
+    BENCH(out, display, "16 rect sueltos", 100, 16 * 8 * 8, benchSmallRects(display, benchRep));
+    BENCH(out, display, "16 rect en cuadro", 100, 16 * 8 * 8,
+          (display.beginFrame(), benchSmallRects(display, benchRep), display.endFrame()));
+    // un cuadro del dino y 2 ms de calculo: sin la cola se suman, con la
+    // cola el calculo corre mientras sale el cuadro (fence antes del siguiente)
+    BENCH(out, display, "dino + 2 ms", 50, 32 * 32,
+          (display.fence(), display.drawAnimFrame(100, 200, anim, benchRep & 1), delayMicroseconds(2000)));
+    BENCH(out, display, "texto", 50, 0, (display.setCursor(5, 250), display.print(F("Puntos: 80"))));
+    out.println(F("bench: fin"));
+}
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef BootProfile_h
+#define BootProfile_h
+
+#include <Arduino.h>
+
+// Tiempos del arranque: cuando queda lista la pantalla, cuando termina de
+// salir el titulo, cuando esta dibujado el nivel y cuando sale el primer
+// cuadro del juego. Se toman con micros(), que corre desde el reset (el
+// Timer0 lo arranca init() de Arduino antes de setup()), y se mandan por
+// Serial una sola vez, despues del primer cuadro:
+//   boot ms: pantalla=125 titulo=180 listo=3240 cuadro=3262 saltado
+// "saltado" es que se apreto el boton antes de que terminara el titulo.
+// tools/bench_simavr.py lee esta linea con un env del juego.
+
+enum BootMark : uint8_t {
+    BOOT_DISPLAY,     // display.init() termino
+    BOOT_TITLE,       // el titulo entero en la pantalla
+    BOOT_READY,       // el nivel dibujado, listo para jugar
+    BOOT_FIRST_FRAME, // termino el primer cuadro
+    BOOT_MARKS
+};
+
+class BootProfile {
+private:
+    uint32_t at[BOOT_MARKS]; // micros() de cada marca, 0 si todavia no paso
+    bool skipped;
+    bool reported;
+
+public:
+    BootProfile() : skipped(false), reported(false) {
+        for (uint8_t i = 0; i < BOOT_MARKS; i++) {
+            at[i] = 0;
+        }
+    }
+
+    // solo cuenta la primera vez (una partida nueva no es un arranque)
+    void mark(BootMark m) {
+        if (!at[m]) {
+            at[m] = micros() | 1; // nunca 0
+        }
+    }
+
+    // se apreto el boton durante el titulo
+    void skip() {
+        if (!at[BOOT_READY]) {
+            skipped = true;
+        }
+    }
+
+    // la linea de arriba, la primera vez que ya estan todas las marcas.
+    // Cabe en el buffer de Serial, asi que no espera a que salga
+    void report(Print& out) {
+        if (reported || !at[BOOT_FIRST_FRAME]) {
+            return;
+        }
+        reported = true;
+        out.print(F("boot ms: pantalla="));
+        out.print(at[BOOT_DISPLAY] / 1000);
+        out.print(F(" titulo="));
+        out.print(at[BOOT_TITLE] / 1000); // 0 si se salto antes
+        out.print(F(" listo="));
+        out.print(at[BOOT_READY] / 1000);
+        out.print(F(" cuadro="));
+        out.print(at[BOOT_FIRST_FRAME] / 1000);
+        out.println(skipped ? F(" saltado") : F(""));
+    }
+};
+
+#endif
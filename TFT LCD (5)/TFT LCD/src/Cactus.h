@@ -1,12 +1,12 @@
 #ifndef Cactus_h
 #define Cactus_h
 
-#include <avr/pgmspace.h>
+#include "AssetBank.h"
 
 
 
 
-const uint16_t spriteCactus[1024] PROGMEM = {
+const uint16_t spriteCactus[1024] ASSET_FAR = {
 	// 'monedatreintados, 32x32px
 	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
 	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
@@ -0,0 +1,155 @@
+#ifndef Compositor_h
+#define Compositor_h
+
+#include <Arduino.h>
+#include "AssetBank.h"
+#include "Tilemap.h"
+
+// Compositor por tiras (-DSTRIP_COMPOSITOR).
+//
+// Dibujar capa por capa en la pantalla (fondo, cactus, moneda, dino) manda
+// varias veces los pixeles donde se cruzan y entre una y otra se ve el
+// parpadeo; ademas cada sprite tapa con su fondo negro lo que tenga debajo.
+// Aqui una region sucia se arma de a tiras de filas en un buffer en RAM: el
+// fondo (Tilemap.h) y encima las capas en orden, con el negro (0x0000) como
+// transparente. Display::composeRegion manda cada tira en la misma ventana,
+// asi que cada pixel cruza el SPI una sola vez y ya compuesto.
+//
+// Las capas las pone la escena (setScene): quien la llama con begin() solo
+// agrega lo que toca la region. La tira son STRIP_W x STRIP_ROWS pixeles
+// (3.8 KB); una region angosta usa el mismo buffer con mas filas.
+
+#define STRIP_W 240
+#define STRIP_ROWS 8
+#define STRIP_PIXELS (STRIP_W * STRIP_ROWS)
+#define STRIP_LAYERS 32 // la pantalla entera al empezar: los 24 cactus y monedas y el dino
+
+struct StripLayer {
+    int16_t x, y;
+    uint8_t w, h;
+    uint_farptr_t src;      // el sprite (o el keyframe) en el banco de assets
+    const AnimDelta* delta; // en PROGMEM, 0 si es un sprite sin animacion
+};
+
+class StripCompositor;
+typedef void (*StripScene)(StripCompositor& comp, void* ctx);
+
+class StripCompositor {
+private:
+    uint16_t strip[STRIP_PIXELS];
+    StripLayer layers[STRIP_LAYERS];
+    uint8_t count;
+    int16_t rx, ry, rw, rh; // la region que se esta armando
+    StripScene scene;
+    void* sceneCtx;
+
+    void add(int x, int y, uint8_t w, uint8_t h, uint_farptr_t src, const AnimDelta* delta) {
+        if (count == STRIP_LAYERS || x >= rx + rw || x + w <= rx || y >= ry + rh || y + h <= ry) {
+            return;
+        }
+        StripLayer& l = layers[count++];
+        l.x = x;
+        l.y = y;
+        l.w = w;
+        l.h = h;
+        l.src = src;
+        l.delta = delta;
+    }
+
+    // el fondo de las filas [y0, y0 + rows) de la region, cuadrito por cuadrito
+    void renderBackground(int y0, uint8_t rows) {
+        uint16_t* out = strip;
+        for (int py = y0; py < y0 + rows; py++) {
+            const uint8_t* mapRow = TILEMAP + (py / TILE_SIZE) * TILEMAP_COLS;
+            int row = py % TILE_SIZE;
+            for (int px = rx; px < rx + rw;) {
+                int n = min(rx + rw, (px / TILE_SIZE + 1) * TILE_SIZE) - px;
+                uint8_t tile = pgm_read_byte(mapRow + px / TILE_SIZE);
+                memcpy_P(out, &TILESET[tile][row * TILE_SIZE + px % TILE_SIZE], 2 * n);
+                out += n;
+                px += n;
+            }
+        }
+    }
+
+    // una capa encima de lo que ya hay; el negro no se copia
+    void renderLayer(const StripLayer& l, int stripY, uint8_t rows) {
+        int x0 = max((int)rx, (int)l.x), x1 = min(rx + rw, l.x + l.w);
+        int y0 = max(stripY, (int)l.y), y1 = min(stripY + rows, l.y + l.h);
+        if (y0 >= y1) {
+            return;
+        }
+        AnimDelta d;
+        d.w = 0;
+        if (l.delta) {
+            memcpy_P(&d, l.delta, sizeof(d));
+        }
+        AssetStream src(l.src);
+        src.skip((y0 - l.y) * l.w);
+        for (int py = y0; py < y1; py++) {
+            uint16_t* out = strip + (py - stripY) * rw + (x0 - rx);
+            int sy = py - l.y;
+            bool inDeltaRow = sy >= d.y && sy < d.y + d.h;
+            src.skip(x0 - l.x);
+            for (int px = x0; px < x1; px++, out++) {
+                uint16_t color = src.next();
+                int sx = px - l.x;
+                if (inDeltaRow && sx >= d.x && sx < d.x + d.w) {
+                    color = pgm_read_word(d.pixels + (sy - d.y) * d.w + (sx - d.x));
+                }
+                if (color) {
+                    *out = color;
+                }
+            }
+            src.skip(l.x + l.w - x1);
+        }
+    }
+
+public:
+    StripCompositor() : count(0), rx(0), ry(0), rw(0), rh(0), scene(0), sceneCtx(0) {}
+
+    // quien sabe que hay en la pantalla; se llama una vez por region
+    void setScene(StripScene fn, void* ctx) {
+        scene = fn;
+        sceneCtx = ctx;
+    }
+
+    bool hasScene() const { return scene != 0; }
+
+    // empieza la region (ya recortada a la pantalla) y junta sus capas
+    void begin(int x, int y, int w, int h) {
+        rx = x;
+        ry = y;
+        rw = w;
+        rh = h;
+        count = 0;
+        if (scene) {
+            scene(*this, sceneCtx);
+        }
+    }
+
+    // filas de la region que caben en una tira
+    uint8_t stripRows() const {
+        return min(255, STRIP_PIXELS / rw);
+    }
+
+    // las capas van de abajo hacia arriba; lo que no toca la region no entra
+    void addSprite(int x, int y, int w, int h, uint_farptr_t src) {
+        add(x, y, w, h, src, 0);
+    }
+
+    void addAnim(int x, int y, const SpriteAnim& anim, uint8_t frame) {
+        add(x, y, anim.w, anim.h, (uint_farptr_t)(uintptr_t)anim.key, &anim.deltas[frame]);
+    }
+
+    // arma las filas [y, y + rows) de la region: rw * rows pixeles seguidos
+    const uint16_t* render(int y, uint8_t rows) {
+        renderBackground(y, rows);
+        for (uint8_t i = 0; i < count; i++) {
+            renderLayer(layers[i], y, rows);
+        }
+        return strip;
+    }
+};
+
+#endif
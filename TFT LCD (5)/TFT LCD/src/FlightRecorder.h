@@ -0,0 +1,267 @@
+#ifndef FlightRecorder_h
+#define FlightRecorder_h
+
+#include <Arduino.h>
+#if defined(__AVR__)
+#include <avr/wdt.h>
+#endif
+#ifdef WATCHDOG
+#define WATCHDOG_PERIOD (_BV(WDP2) | _BV(WDP1)) // 1 s hasta la interrupcion y otro hasta el reset
+#endif
+
+// Caja negra de los cuadros lentos: cada vuelta de la tarea del juego se
+// parte en fases (phase()) y al final (frameEnd()) se compara lo que tardo
+// con el tope. Si se paso, se guarda la fase que mas tardo y cuanto en un
+// anillo de las ultimas FLIGHT_FRAMES; si no, no se guarda nada (solo un
+// micros() por fase).
+//
+// El anillo esta en .noinit: un reset no lo borra, asi que se puede ver que
+// paso antes de que el juego se colgara. Al prender la RAM trae basura y
+// magic no coincide, entonces se empieza de cero.
+//
+// Con -DWATCHDOG el watchdog primero da una interrupcion y despues resetea:
+// la interrupcion anota el cuadro colgado (la fase en que estaba y cuanto
+// lleva) y al volver a arrancar el registro sale solo por Serial. Tambien
+// sale cuando se manda una 'v' por Serial:
+//   cuadros lentos: 2 de 5120 (despues de un cuelgue)
+//   cuadro 812 estado 4 312408/50000 us fase estado 312004 us
+//   cuadro 5119 estado 1 colgado fase dibujo 1000228 us
+
+#ifndef FLIGHT_FRAMES
+#define FLIGHT_FRAMES 8
+#endif
+#define FLIGHT_MAGIC 0xF17E
+
+// lo que puede estar haciendo la tarea del juego
+enum FramePhase : uint8_t {
+    PHASE_STATE,   // la maquina de estados: pantallas, titulo, reinicio
+    PHASE_INPUT,   // el boton y el salto
+    PHASE_PLAYER,  // mover al dino
+    PHASE_DRAW,    // el dino, el scroll y el HUD
+    PHASE_COLLIDE, // choques, monedas y cambio de piso
+    PHASE_TRACK,   // la pista del modo sin fin y el final del cuadro
+    PHASE_SAVE,    // guardar y revisar la memoria
+    PHASE_COUNT
+};
+
+const char PHASE_NAME_0[] PROGMEM = "estado";
+const char PHASE_NAME_1[] PROGMEM = "boton";
+const char PHASE_NAME_2[] PROGMEM = "dino";
+const char PHASE_NAME_3[] PROGMEM = "dibujo";
+const char PHASE_NAME_4[] PROGMEM = "choques";
+const char PHASE_NAME_5[] PROGMEM = "pista";
+const char PHASE_NAME_6[] PROGMEM = "guardar";
+const char* const PHASE_NAMES[PHASE_COUNT] PROGMEM = {
+    PHASE_NAME_0, PHASE_NAME_1, PHASE_NAME_2, PHASE_NAME_3,
+    PHASE_NAME_4, PHASE_NAME_5, PHASE_NAME_6
+};
+
+struct FlightRecord {
+    uint16_t frame;    // numero de vuelta
+    uint8_t state;     // GameState
+    uint8_t phase;     // la fase que mas tardo (FramePhase)
+    uint8_t budgetMs;  // el tope; 0 si lo corto el watchdog
+    uint32_t totalUs;
+    uint32_t phaseUs;
+};
+
+struct FlightLog {
+    uint16_t magic;
+    uint16_t frames;   // vueltas contadas desde que se borro
+    uint8_t head;      // la que se escribe la proxima vez
+    uint8_t used;
+    bool stalled;      // lo ultimo fue un cuelgue; se muestra al arrancar
+    FlightRecord records[FLIGHT_FRAMES];
+};
+
+#if defined(__AVR__)
+FlightLog flightLog __attribute__((section(".noinit")));
+
+// MCUSR del ultimo reset. Despues de un reset del watchdog el AVR arranca
+// con el watchdog prendido en 16 ms (WDRF lo fuerza) y init() tarda mas que
+// eso: hay que apagarlo antes que nada, en .init3, y para eso borrar WDRF.
+// Optiboot ya lo borro y deja lo que leyo en r2.
+uint8_t resetFlags __attribute__((section(".noinit")));
+
+void saveResetFlags() __attribute__((naked, used, section(".init3")));
+void saveResetFlags() {
+    uint8_t flags = MCUSR;
+    if (!flags) {
+        __asm__ __volatile__("mov %0, r2" : "=r"(flags));
+    }
+    resetFlags = flags;
+    MCUSR = 0;
+    wdt_disable();
+}
+#else
+FlightLog flightLog;
+uint8_t resetFlags = 0;
+#endif
+
+class FlightRecorder {
+private:
+    uint32_t frameStart;
+    uint32_t phaseStart;
+    uint32_t longestUs;
+    uint8_t phaseNow;
+    uint8_t longest;
+    uint8_t state;
+    int8_t dumpPos;    // linea que sigue al mostrar el registro, -1 si no
+
+    void push(uint8_t budgetMs, uint32_t totalUs) {
+        FlightRecord& r = flightLog.records[flightLog.head];
+        r.frame = flightLog.frames;
+        r.state = state;
+        r.phase = longest;
+        r.budgetMs = budgetMs;
+        r.totalUs = totalUs;
+        r.phaseUs = longestUs;
+        flightLog.head = flightLog.head + 1 == FLIGHT_FRAMES ? 0 : flightLog.head + 1;
+        if (flightLog.used < FLIGHT_FRAMES) {
+            flightLog.used++;
+        }
+    }
+
+    // cierra la fase que estaba corriendo
+    void closePhase(uint32_t now) {
+        uint32_t took = now - phaseStart;
+        if (took >= longestUs) {
+            longestUs = took;
+            longest = phaseNow;
+        }
+        phaseStart = now;
+    }
+
+public:
+    FlightRecorder() : frameStart(0), phaseStart(0), longestUs(0), phaseNow(PHASE_STATE),
+                       longest(PHASE_STATE), state(0), dumpPos(-1) {}
+
+    // al arrancar: sigue con lo que sobrevivio al reset o empieza de cero.
+    // Al prender (o con la tension baja) la RAM es basura aunque magic coincida
+    void begin() {
+        FlightLog& f = flightLog;
+        if ((resetFlags & (_BV(PORF) | _BV(BORF))) ||
+            f.magic != FLIGHT_MAGIC || f.head >= FLIGHT_FRAMES || f.used > FLIGHT_FRAMES) {
+            memset(&f, 0, sizeof(f));
+            f.magic = FLIGHT_MAGIC;
+        }
+        if (resetFlags & _BV(WDRF)) {
+            f.stalled = true; // aunque la interrupcion no haya podido anotar el cuadro (con cli())
+        }
+        if (f.stalled) {
+            dumpPos = 0; // sale por Serial en cuanto haya telemetria
+        }
+#if defined(__AVR__) && defined(WATCHDOG)
+        // primero la interrupcion (WDIE) y en el siguiente vencimiento el reset
+        cli();
+        wdt_reset();
+        WDTCSR = _BV(WDCE) | _BV(WDE);
+        WDTCSR = _BV(WDIE) | _BV(WDE) | WATCHDOG_PERIOD;
+        sei();
+#endif
+    }
+
+    // en cada vuelta de loop(); la interrupcion se apaga sola cuando salta,
+    // asi que se vuelve a prender por si el cuadro termino despues de todo
+    void feed() {
+#if defined(__AVR__) && defined(WATCHDOG)
+        wdt_reset();
+        WDTCSR |= _BV(WDIE);
+#endif
+    }
+
+    void frameBegin(uint8_t gameState) {
+        uint32_t now = micros();
+        frameStart = now;
+        phaseStart = now;
+        longestUs = 0;
+        phaseNow = PHASE_STATE;
+        longest = PHASE_STATE;
+        state = gameState;
+    }
+
+    void phase(FramePhase p) {
+        closePhase(micros());
+        phaseNow = p;
+    }
+
+    // budgetUs es el tope de la tarea en el planificador; true si se paso
+    // (queda en newest())
+    bool frameEnd(uint32_t budgetUs) {
+        uint32_t now = micros();
+        flightLog.frames++;
+        uint32_t total = now - frameStart;
+        if (total <= budgetUs) {
+            return false;
+        }
+        closePhase(now);
+        push(budgetUs / 1000, total);
+        return true;
+    }
+
+    const FlightRecord& newest() const {
+        return flightLog.records[(flightLog.head + FLIGHT_FRAMES - 1) % FLIGHT_FRAMES];
+    }
+
+    // desde la interrupcion del watchdog: el cuadro que no termino
+    void stall() {
+        uint32_t now = micros();
+        closePhase(now);
+        push(0, now - frameStart);
+        flightLog.stalled = true;
+    }
+
+    void requestDump() {
+        dumpPos = 0;
+    }
+
+    bool dumping() const {
+        return dumpPos >= 0;
+    }
+
+    // una linea por llamada, para no llenar el buffer de Serial
+    void dumpLine(Print& out) {
+        FlightLog& f = flightLog;
+        if (dumpPos == 0) {
+            out.print(F("cuadros lentos: "));
+            out.print(f.used);
+            out.print(F(" de "));
+            out.print(f.frames);
+            out.println(f.stalled ? F(" (despues de un cuelgue)") : F(""));
+            f.stalled = false;
+        } else {
+            // del mas viejo al mas nuevo
+            uint8_t i = (f.head + FLIGHT_FRAMES - f.used + dumpPos - 1) % FLIGHT_FRAMES;
+            const FlightRecord& r = f.records[i];
+            out.print(F("cuadro "));
+            out.print(r.frame);
+            out.print(F(" estado "));
+            out.print(r.state);
+            out.print(' ');
+            if (r.budgetMs) {
+                out.print(r.totalUs);
+                out.print('/');
+                out.print(r.budgetMs * 1000UL);
+                out.print(F(" us"));
+            } else {
+                out.print(F("colgado"));
+            }
+            out.print(F(" fase "));
+            out.print((const __FlashStringHelper*)pgm_read_ptr(&PHASE_NAMES[r.phase]));
+            out.print(' ');
+            out.print(r.phaseUs);
+            out.println(F(" us"));
+        }
+        dumpPos = dumpPos == f.used ? -1 : dumpPos + 1;
+    }
+};
+
+FlightRecorder flightRecorder;
+
+#if defined(__AVR__) && defined(WATCHDOG)
+ISR(WDT_vect) {
+    flightRecorder.stall(); // despues de esto el watchdog resetea
+}
+#endif
+
+#endif
@@ -0,0 +1,99 @@
+#ifndef GameConfig_h
+#define GameConfig_h
+
+// Reglas, fisica y distribucion de los niveles.
+// Este archivo lo comparten el juego (main.cpp) y el verificador de niveles
+// (tools/level_solver.cpp), por eso no incluye nada de Arduino: si se mueve
+// un cactus aqui, el verificador revisa el nuevo nivel al compilar.
+
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+#define PROGMEM
+#endif
+
+const int XMAX = 240;
+const int YMAX = 320;
+
+const int SPRITE_SIZE = 32; // el dino, los cactus y las monedas miden 32x32
+
+// reglas del juego
+const int START_LIVES = 3;
+const int COIN_POINTS = 10;
+const int WIN_SCORE = 80;
+
+// duracion de un tick: FRAME_MS_BASE - velocidad del nivel * FRAME_MS_PER_SPEED
+// (la fisica del dino esta en JumpPhysics.h)
+const int FRAME_MS_BASE = 50;
+const int FRAME_MS_PER_SPEED = 5;
+
+// pantallas (Game::run): cuanto duran si nadie aprieta el boton
+const int TITLE_MS = 3000;
+const int LEVEL_TRANSITION_MS = 800; // la pausa con el letrero del nivel nuevo
+const int END_SCREEN_MS = 5000;      // victoria o game over, despues vuelve al titulo
+const int END_GUARD_MS = 500;        // antes de esto el boton no reinicia (venia saltando)
+
+// pisos: distancia desde abajo de la pantalla; el ultimo es solo decorativo
+const int FLOOR_COUNT = 4;
+const int FLOOR_OFFSETS[FLOOR_COUNT] = { 60, 160, 260, 32 };
+
+const int NUM_LEVELS = 3;
+const int MAX_OBJECTS = 4; // maximo de cactus o monedas por nivel
+
+struct LevelLayout {
+    int number;
+    int speed;       // entre mas alto, menos espera entre ticks
+    int cactusCount;
+    int coinCount;
+    int cactusX[MAX_OBJECTS];
+    int coinX[MAX_OBJECTS];
+};
+
+// todos los objetos se apoyan sobre el piso de su nivel.
+// En PROGMEM para no gastar RAM: el juego lo copia con memcpy_P
+//
+// Un salto avanza 150 px y el piso se deja en x = 208: en cada piso cabe un
+// salto, asi que los cactus van juntos. Un salto pasa un grupo que empiece
+// 55 px o mas adelante y que tenga 40 px o menos del primero al ultimo; en
+// los dos primeros pisos el grupo esta al final y el dino sigue en el aire
+// cuando cambia de piso. El dino entra en x = 0: nada antes de x = 32.
+// Las monedas van fuera de los grupos. Lo revisa tools/level_solver.cpp
+const LevelLayout LEVEL_LAYOUTS[NUM_LEVELS] PROGMEM = {
+    { 1, 2, 2, 2, { 100, 120 },          { 80, 180 } },
+    { 2, 3, 3, 3, { 170, 200, 220 },     { 60, 100, 130 } },
+    { 3, 4, 4, 4, { 140, 148, 156, 164 }, { 40, 70, 100, 200 } },
+};
+
+// modo sin fin (-DENDLESS, TrackGen.h): la pista sale de una semilla y se
+// recorre por tramos del ancho de la pantalla; el tramo s va en el piso
+// s % NUM_LEVELS y cuando el dino lo deja atras su piso se usa para el s + 3
+const int ENDLESS_START_X = 64;      // espacio libre al entrar a un piso
+const int ENDLESS_MIN_GAP = 48;      // de una cosa a la siguiente, mas 0..63 al azar
+const int ENDLESS_CACTUS_GAP = 160;  // entre dos cactus: un salto (unos 150 px) y un poco
+const int ENDLESS_CACTUS_BASE = 96;  // probabilidad de cactus en 256 en el primer tramo,
+const int ENDLESS_CACTUS_STEP = 8;   // sube tanto por tramo
+const int ENDLESS_CACTUS_MAX = 192;  // hasta aqui
+const int ENDLESS_START_SPEED = 2;
+const int ENDLESS_MAX_SPEED = 6;     // tick de FRAME_MS_BASE - 6 * FRAME_MS_PER_SPEED = 20 ms
+const int ENDLESS_SEGMENTS_PER_SPEED = 3;
+// lugares de los anillos (potencias de 2): cuantas cosas de cada tipo caben
+// en los tres pisos a la vez. Con ENDLESS_START_X y ENDLESS_MIN_GAP entran 4
+// por tramo, y cactus a lo mas 2 por ENDLESS_CACTUS_GAP
+const int ENDLESS_CACTUS_SLOTS = 8;
+const int ENDLESS_COIN_SLOTS = 16;
+
+// modo de lado (-DSCROLL_WORLD, va con el modo sin fin): la pantalla
+// acostada, SCROLL_W x SCROLL_H, con un solo piso. El mundo corre con el
+// scroll por hardware del ILI9341 en las primeras SCROLL_AREA columnas y el
+// HUD queda fijo en las de la derecha. SCROLL_AREA es potencia de 2: la x
+// del mundo va a la columna x & (SCROLL_AREA - 1) de la memoria
+const int SCROLL_W = 320;
+const int SCROLL_H = 240;
+const int SCROLL_AREA = 256;
+const int SCROLL_HUD_W = SCROLL_W - SCROLL_AREA;
+const int SCROLL_FLOOR_Y = 200;
+const int SCROLL_DINO_X = 48;      // donde se queda el dino en la pantalla
+const int SCROLL_LOOKAHEAD = 64;   // lo de la pista se prepara antes de que aparezca
+const int SCROLL_REBASE = 16384;   // multiplo de SCROLL_AREA, para que las x quepan en un int
+
+#endif
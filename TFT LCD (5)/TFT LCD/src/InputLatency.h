@@ -0,0 +1,123 @@
+#ifndef InputLatency_h
+#define InputLatency_h
+
+#include <Arduino.h>
+
+// Latencia del boton a la pantalla (-DINPUT_LATENCY): desde el flanco en
+// el pin del boton hasta el RAMWR de la primera ventana que abre
+// DinoPlayer::draw en el cuadro en que empieza el salto, o sea cuando los
+// pixeles del salto empiezan a salir por el SPI.
+//
+//   edge()       la interrupcion del boton: micros() del primer flanco
+//   pressed()    handleInput vio el toque; si no empezo un salto (ya estaba
+//                en el aire) se descarta
+//   armed()      true si el siguiente draw del dino es el del salto; Display
+//                anota la primera ventana (Display::stampNextWindow)
+//   collect()    despues del cuadro: si ya hay hora de la ventana, a la cuenta
+//
+// Los tiempos van a un histograma de LATENCY_BUCKETS cajas de
+// LATENCY_BUCKET_US y la telemetria manda p50 y p99 (el borde de arriba de
+// la caja) y el peor, desde el arranque:
+//   latencia x14 p50 24 p99 44 ms peor 43120 us
+// tools/latency_vcd.py saca lo mismo de las señales de simavr.
+
+#define LATENCY_BUCKET_US 2000
+#define LATENCY_BUCKETS 32 // la ultima junta todo lo que pase de 62 ms
+
+class InputLatency {
+private:
+    volatile uint32_t edgeUs;  // flanco que todavia no vio el juego, 0 si no hay
+    uint32_t startUs;          // flanco del salto que se esta midiendo
+    bool waitingDraw;          // el salto empezo, falta el draw del dino
+    bool waitingStamp;         // el draw ya se pidio, falta la hora de la ventana
+    uint16_t count;
+    uint32_t worstUs;
+    uint16_t buckets[LATENCY_BUCKETS];
+
+    uint8_t percentile(uint8_t pct) const {
+        uint32_t need = ((uint32_t)count * pct + 99) / 100;
+        uint32_t seen = 0;
+        for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) {
+            seen += buckets[i];
+            if (seen >= need) {
+                return i;
+            }
+        }
+        return LATENCY_BUCKETS - 1;
+    }
+
+public:
+    InputLatency() : edgeUs(0), startUs(0), waitingDraw(false), waitingStamp(false),
+                     count(0), worstUs(0) {
+        memset(buckets, 0, sizeof(buckets));
+    }
+
+    // desde la interrupcion; los rebotes del mismo toque no cuentan
+    void edge() {
+        if (!edgeUs) {
+            edgeUs = micros() | 1;
+        }
+    }
+
+    void pressed(bool jumped) {
+        uint8_t sreg = SREG;
+        cli();
+        uint32_t us = edgeUs;
+        edgeUs = 0;
+        SREG = sreg;
+        if (jumped && us && !waitingStamp) {
+            startUs = us;
+            waitingDraw = true;
+        }
+    }
+
+    // justo antes de DinoPlayer::draw; true una sola vez por salto
+    bool armed() {
+        if (!waitingDraw) {
+            return false;
+        }
+        waitingDraw = false;
+        waitingStamp = true;
+        return true;
+    }
+
+    // windowUs es la hora del RAMWR, 0 si todavia no salio (con la cola)
+    void collect(uint32_t windowUs) {
+        if (!waitingStamp || !windowUs) {
+            return;
+        }
+        waitingStamp = false;
+        uint32_t took = windowUs - startUs;
+        uint32_t bucket = took / LATENCY_BUCKET_US;
+        buckets[bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1]++;
+        if (count < 0xFFFF) {
+            count++;
+        }
+        if (took > worstUs) {
+            worstUs = took;
+        }
+    }
+
+    bool waiting() const {
+        return waitingStamp;
+    }
+
+    void report(Print& out) const {
+        out.print(F("latencia x"));
+        out.print(count);
+        if (count) {
+            out.print(F(" p50 "));
+            out.print((percentile(50) + 1) * (LATENCY_BUCKET_US / 1000));
+            out.print(F(" p99 "));
+            out.print((percentile(99) + 1) * (LATENCY_BUCKET_US / 1000));
+            out.print(F(" ms peor "));
+            out.print(worstUs);
+            out.print(F(" us"));
+        }
+        out.println();
+    }
+};
+
+InputLatency inputLatency;
+
+#endif
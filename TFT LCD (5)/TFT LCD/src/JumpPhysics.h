@@ -0,0 +1,89 @@
+#ifndef JumpPhysics_h
+#define JumpPhysics_h
+
+// Fisica del dino en punto fijo Q8.8 (8 bits de fraccion, 1 px = 256).
+// Sin floats ni divisiones: el salto sale de una tabla de velocidades en
+// PROGMEM, un valor por tick, y despues de la tabla sigue la gravedad.
+// Lo usan DinoPlayer (main.cpp) y el verificador de niveles.
+//
+// Las posiciones van en int32_t porque la pantalla pasa de los 8 bits
+// enteros de un Q8.8 de 16 bits (240 y 320 px); las velocidades si caben
+// en int16_t.
+
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#define pgm_read_word(addr) (*(addr))
+#endif
+
+const int FIXED_SHIFT = 8;
+
+inline int32_t toFixed(int px) { return (int32_t)px << FIXED_SHIFT; }
+inline int fixedToPx(int32_t f) { return (int)(f >> FIXED_SHIFT); }
+
+// velocidades en Q8.8 por tick (un tick dura FRAME_MS_BASE - velocidad * FRAME_MS_PER_SPEED)
+const int16_t RUN_SPEED_FX = 5 << FIXED_SHIFT;  // 5 px por tick
+const int16_t JUMP_BOOST_FX = 640;              // 2.5 px de mas por tick en el aire (unos 50 px por salto)
+const int16_t GRAVITY_FX = 297;                 // la misma de la tabla
+
+const int JUMP_HEIGHT = 58;
+const int JUMP_TICKS = 20;
+
+// generada con: python tools/gen_jump_arc.py 58 20
+// JUMP_HEIGHT = 58, JUMP_TICKS = 20, gravedad = 297 (Q8.8), pico = 57.99 px
+const int16_t JUMP_ARC[JUMP_TICKS] PROGMEM = {
+    -2821, -2524, -2227, -1930, -1633, -1336, -1039, -742, -445, -148,
+    148, 445, 742, 1039, 1336, 1633, 1930, 2227, 2524, 2821,
+};
+
+struct DinoMotion {
+    int32_t x, y;    // esquina superior izquierda, Q8.8
+    int16_t vy;      // Q8.8 por tick, negativo = hacia arriba
+    uint8_t tick;    // tick dentro del salto
+    bool jumping;
+};
+
+inline void motionPlace(DinoMotion& m, int px, int py) {
+    m.x = toFixed(px);
+    m.y = toFixed(py);
+    m.vy = 0;
+    m.tick = 0;
+    m.jumping = false;
+}
+
+inline void motionJump(DinoMotion& m) {
+    if (!m.jumping) {
+        m.jumping = true;
+        m.tick = 0;
+    }
+}
+
+// parte vertical del tick; groundY es la y (Q8.8) del dino parado en el piso
+inline void motionFall(DinoMotion& m, int32_t groundY) {
+    if (!m.jumping) {
+        m.y = groundY;
+        return;
+    }
+    if (m.tick < JUMP_TICKS) {
+        m.vy = (int16_t)pgm_read_word(&JUMP_ARC[m.tick]);
+        m.tick++;
+    } else {
+        m.vy += GRAVITY_FX;
+    }
+    m.y += m.vy;
+    if (m.y >= groundY) {
+        m.y = groundY;
+        m.vy = 0;
+        m.jumping = false;
+    }
+}
+
+// parte horizontal del tick
+inline void motionAdvance(DinoMotion& m) {
+    m.x += m.jumping ? RUN_SPEED_FX + JUMP_BOOST_FX : RUN_SPEED_FX;
+}
+
+#endif
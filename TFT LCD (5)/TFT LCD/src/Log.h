@@ -0,0 +1,145 @@
+#ifndef Log_h
+#define Log_h
+
+#include <Arduino.h>
+#include "LogFormats.h"
+
+// Log que no frena el juego. Serial.print a 9600 baudios se queda esperando
+// en cuanto se llenan los 64 bytes de su buffer; aqui cada mensaje es un
+// registro binario chico en un anillo de LOG_BUFFER bytes, y drain() le pasa
+// a Serial solo lo que le cabe sin esperar (despues lo saca la interrupcion
+// de la USART). Si el anillo esta lleno el mensaje se pierde y se cuenta;
+// la cuenta sale como un mensaje mas (LOG_DROPPED) cuando hay lugar.
+//
+//   0xFE  id  largo  argumentos (little endian, como estan en la RAM)
+//
+// Los textos estan en LogFormats.h y los arma tools/log_decode.py; el resto
+// de lo que sale por Serial (la telemetria) es texto y pasa tal cual.
+//
+// Se escribe con LOG(id, argumentos...). El nivel de cada mensaje esta en
+// LogFormats.h y se filtra al compilar con -DLOG_LEVEL=n: el if de LOG() es
+// una constante, asi que un mensaje de un nivel apagado no genera codigo
+// (ni se evaluan sus argumentos). Se puede llamar desde una interrupcion.
+
+#define LOG_OFF 0
+#define LOG_ERROR 1
+#define LOG_WARN 2
+#define LOG_INFO 3
+#define LOG_DEBUG 4
+
+// por defecto solo lo raro: asi la telemetria de siempre sale limpia
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_WARN
+#endif
+
+#ifndef LOG_BUFFER
+#define LOG_BUFFER 128 // potencia de 2
+#endif
+
+#define LOG_SYNC 0xFE // no es ASCII: asi se separa de la telemetria
+
+#define LOG_ENUM(id, level, text) id,
+enum LogId : uint8_t {
+    LOG_FORMATS(LOG_ENUM)
+    LOG_IDS
+};
+#undef LOG_ENUM
+
+#define LOG_LEVEL_OF(id, level, text) level,
+constexpr uint8_t LOG_LEVELS[LOG_IDS] = { LOG_FORMATS(LOG_LEVEL_OF) };
+#undef LOG_LEVEL_OF
+
+class Log {
+private:
+    uint8_t buf[LOG_BUFFER];
+    volatile uint8_t head, tail;
+    volatile uint16_t dropped;
+
+    uint8_t used() const {
+        return (uint8_t)(head - tail) & (LOG_BUFFER - 1);
+    }
+
+    void put(const void* data, uint8_t n) {
+        const uint8_t* p = (const uint8_t*)data;
+        for (uint8_t i = 0; i < n; i++) {
+            buf[head] = p[i];
+            head = (head + 1) & (LOG_BUFFER - 1);
+        }
+    }
+
+    static constexpr uint8_t argsSize() {
+        return 0;
+    }
+
+    template <typename T, typename... Rest>
+    static constexpr uint8_t argsSize(T, Rest... rest) {
+        return sizeof(T) + argsSize(rest...);
+    }
+
+    void putArgs() {}
+
+    template <typename T, typename... Rest>
+    void putArgs(T first, Rest... rest) {
+        put(&first, sizeof(first));
+        putArgs(rest...);
+    }
+
+    // entero o nada: false si no cabe
+    template <typename... Args>
+    bool record(uint8_t id, Args... args) {
+        const uint8_t len = argsSize(args...);
+        if (LOG_BUFFER - 1 - used() < 3 + len) {
+            return false;
+        }
+        uint8_t header[3] = { LOG_SYNC, id, len };
+        put(header, 3);
+        putArgs(args...);
+        return true;
+    }
+
+public:
+    Log() : head(0), tail(0), dropped(0) {}
+
+    template <typename... Args>
+    void write(LogId id, Args... args) {
+        uint8_t sreg = SREG;
+        cli();
+        if (!record(id, args...) && dropped < 0xFFFF) {
+            dropped++;
+        }
+        SREG = sreg;
+    }
+
+    // pasa a out lo que le quepa sin esperar, de a registros enteros
+    void drain(HardwareSerial& out) {
+        if (dropped) {
+            uint8_t sreg = SREG;
+            cli();
+            if (record(LOG_DROPPED, (uint16_t)dropped)) {
+                dropped = 0;
+            }
+            SREG = sreg;
+        }
+        while (used()) {
+            uint8_t len = 3 + buf[(tail + 2) & (LOG_BUFFER - 1)];
+            if (out.availableForWrite() < len) {
+                return;
+            }
+            for (uint8_t i = 0; i < len; i++) {
+                out.write(buf[tail]);
+                tail = (tail + 1) & (LOG_BUFFER - 1);
+            }
+        }
+    }
+};
+
+Log logger;
+
+#define LOG(id, ...)                                \
+    do {                                            \
+        if (LOG_LEVELS[id] <= LOG_LEVEL) {          \
+            logger.write(id, ##__VA_ARGS__);        \
+        }                                           \
+    } while (0)
+
+#endif
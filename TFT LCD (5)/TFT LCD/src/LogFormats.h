@@ -0,0 +1,26 @@
+#ifndef LogFormats_h
+#define LogFormats_h
+
+// Los mensajes del log (Log.h): X(id, nivel, "formato"). El numero de cada
+// uno es su lugar en la lista, asi que los nuevos van al final. El formato
+// no se compila: por Serial solo salen el numero y los argumentos, y
+// tools/log_decode.py lee esta misma lista para armar el texto.
+//
+// Cada % dice cuantos bytes ocupa el argumento, y el que se pasa tiene que
+// ser de ese tipo:
+//   %c %hhu %hhd  1 byte (char, uint8_t, int8_t)
+//   %u %d %x      2 bytes (unsigned, int)
+//   %lu %ld %lx   4 bytes (unsigned long, long)
+
+#define LOG_FORMATS(X) \
+    X(LOG_DROPPED,   LOG_WARN,  "log: %u mensajes perdidos") \
+    X(LOG_STATE,     LOG_INFO,  "estado %hhu") \
+    X(LOG_HIT,       LOG_INFO,  "choque en x %d, quedan %d vidas") \
+    X(LOG_FLOOR,     LOG_INFO,  "piso %d, %d puntos") \
+    X(LOG_OVERRUN,   LOG_WARN,  "cuadro lento: %lu us, fase %hhu") \
+    X(LOG_NO_RAM,    LOG_ERROR, "sin RAM: quedan %u bytes") \
+    X(LOG_JUMP,      LOG_DEBUG, "salto en x %d y %d") \
+    X(LOG_COIN,      LOG_DEBUG, "moneda, %d puntos") \
+    X(LOG_SAVE,      LOG_DEBUG, "guardado: piso %hhu vidas %hhu puntos %d")
+
+#endif
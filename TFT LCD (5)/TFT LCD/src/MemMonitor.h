@@ -0,0 +1,157 @@
+#ifndef MemMonitor_h
+#define MemMonitor_h
+
+#include <Arduino.h>
+
+// Monitor de RAM: cuanto llego a crecer la pila, donde esta el tope del
+// heap y que tan fragmentado esta, y aviso antes de que la pila y el heap
+// se pisen.
+//
+// La RAM del AVR, de abajo hacia arriba:
+//   .data .bss .noinit | heap (malloc) ->    libre    <- pila | RAMEND
+// Al arrancar (.init1, antes de que exista la pila de C) se pinta todo lo que
+// hay desde __heap_start hasta RAMEND con MEM_CANARY. Lo que la pila usa
+// alguna vez deja de tener ese valor, asi que contando los bytes pintados
+// que siguen intactos encima del heap sale el minimo de RAM libre que hubo.
+// Un byte de la pila que justo valga MEM_CANARY se cuenta como libre; el
+// error es de unos pocos bytes. Si el heap se achica, lo que devuelve ya no
+// esta pintado: por eso todo se mide desde el tope mas alto que se vio.
+
+#define MEM_CANARY 0xC5
+#define MEM_GUARD 32 // bytes encima del heap que la pila nunca deberia tocar
+
+extern "C" {
+extern char __heap_start;
+extern char* __brkval; // tope del heap, 0 si nunca se llamo malloc
+
+// lista de bloques libres de malloc (asi la define avr-libc en stdlib_private.h)
+struct __freelist {
+    size_t sz;
+    struct __freelist* nx;
+};
+extern struct __freelist* __flp;
+}
+
+#if defined(__AVR__)
+// .init1 corre antes de poner en cero r1 y de inicializar el SP, por eso es
+// asm y no C: pinta desde __heap_start hasta RAMEND inclusive
+void memPaintCanary() __attribute__((naked, used, section(".init1")));
+void memPaintCanary() {
+    asm volatile(
+        "    ldi r30, lo8(__heap_start)"   "\n\t"
+        "    ldi r31, hi8(__heap_start)"   "\n\t"
+        "    ldi r24, %[canary]"           "\n\t"
+        "    ldi r25, hi8(%[end])"         "\n\t"
+        "1:  st Z+, r24"                   "\n\t"
+        "    cpi r30, lo8(%[end])"         "\n\t"
+        "    cpc r31, r25"                 "\n\t"
+        "    brlo 1b"                      "\n\t"
+        "    breq 1b"                      "\n\t"
+        :
+        : [canary] "M" (MEM_CANARY), [end] "i" (RAMEND));
+}
+#endif
+
+struct MemStats {
+    uint16_t stackPeak; // lo mas que llego a usar la pila
+    uint16_t minFree;   // lo menos que quedo libre entre el heap y la pila
+    uint16_t heapUsed;  // desde __heap_start hasta el tope del heap
+    uint16_t heapFree;  // bytes en bloques libres de malloc (debajo del tope)
+    uint8_t fragPct;    // 100 - bloque libre mas grande / total libre
+};
+
+class MemMonitor {
+private:
+    uint8_t* lowWater; // el byte mas bajo que se sabe que toco la pila
+    uint8_t* heapPeak; // el tope mas alto que tuvo el heap
+    bool collided;
+
+    static uint8_t* heapTop() {
+        return (uint8_t*)(__brkval ? __brkval : &__heap_start);
+    }
+
+    uint8_t* paintedStart() {
+        uint8_t* top = heapTop();
+        if (top > heapPeak) {
+            heapPeak = top;
+        }
+        return heapPeak;
+    }
+
+    static uint8_t* stackPointer() {
+        return (uint8_t*)(uintptr_t)SP;
+    }
+
+public:
+    MemMonitor() : lowWater((uint8_t*)(uintptr_t)RAMEND), heapPeak((uint8_t*)&__heap_start), collided(false) {}
+
+    // Revisa que la pila no haya llegado a MEM_GUARD bytes del heap. Solo
+    // mira la zona de guarda y el SP actual, es barato para llamarlo en
+    // cada tick. Una vez que se detecta queda marcado.
+    bool check() {
+        uint8_t* top = paintedStart();
+        if (stackPointer() < top + MEM_GUARD) {
+            collided = true;
+        }
+        for (uint8_t i = 0; i < MEM_GUARD && !collided; i++) {
+            if (top[i] != MEM_CANARY) {
+                collided = true;
+            }
+        }
+        return !collided;
+    }
+
+    bool hasCollided() const {
+        return collided;
+    }
+
+    // Recorre toda la zona libre; en 8 KB son unos pocos ms, para reportes
+    // y no para cada tick.
+    MemStats measure() {
+        MemStats s;
+        uint8_t* top = paintedStart();
+        uint8_t* p = top;
+        uint8_t* end = (uint8_t*)(uintptr_t)RAMEND;
+        while (p < lowWater && p <= end && *p == MEM_CANARY) {
+            p++;
+        }
+        if (p < lowWater) {
+            lowWater = p;
+        }
+        s.minFree = lowWater > top ? lowWater - top : 0;
+        s.stackPeak = end - lowWater + 1;
+        top = heapTop();
+        s.heapUsed = top - (uint8_t*)&__heap_start;
+
+        // bloques libres de malloc; el hueco entre el heap y la pila tambien
+        // cuenta como un bloque libre
+        uint16_t total = 0;
+        uint16_t largest = stackPointer() - top;
+        for (struct __freelist* f = __flp; f; f = f->nx) {
+            total += f->sz + sizeof(size_t);
+            if (f->sz + sizeof(size_t) > largest) {
+                largest = f->sz + sizeof(size_t);
+            }
+        }
+        s.heapFree = total;
+        uint16_t allFree = total + (stackPointer() - top);
+        s.fragPct = allFree ? 100 - (uint8_t)((uint32_t)largest * 100 / allFree) : 0;
+        return s;
+    }
+
+    // una linea corta (cabe en el buffer de salida del Serial, no bloquea)
+    void report(Print& out) {
+        MemStats s = measure();
+        out.print(F("mem pila="));
+        out.print(s.stackPeak);
+        out.print(F(" libre="));
+        out.print(s.minFree);
+        out.print(F(" heap="));
+        out.print(s.heapUsed);
+        out.print(F(" frag="));
+        out.print(s.fragPct);
+        out.println(collided ? F("% CHOQUE") : F("%"));
+    }
+};
+
+#endif
@@ -1,10 +1,10 @@
 #ifndef Moneda_h
 #define Moneda_h
 
-#include <avr/pgmspace.h>
+#include "AssetBank.h"
 
 
-const uint16_t spriteMoneda[1024] PROGMEM = {
+const uint16_t spriteMoneda[1024] ASSET_FAR = {
 	// 'cactustreintados, 32x32px
 	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
 	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
@@ -0,0 +1,30 @@
+#ifndef MusicData_h
+#define MusicData_h
+
+#include <Arduino.h>
+
+// Generado por tools/gen_music.py desde resources/music.txt, no editar a mano.
+
+#define MUSIC_ROW_SAMPLES 857 // 140 bpm, 4 filas por tiempo
+#define MUSIC_ROWS 16
+#define MUSIC_ORDER_LEN 4
+
+// onda pulse, un ciclo en 32 muestras
+const int8_t MUSIC_WAVE[32] PROGMEM = {
+    40, 40, 40, 40, 40, 40, 40, 40, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24, -24
+};
+
+// paso del oscilador de cada nota (la fila guarda 2 + el indice)
+const uint16_t MUSIC_STEPS[9] PROGMEM = {
+    2861, 3211, 3604, 4046, 4286, 4811, 5401, 6422, 8573 // F-4 G-4 A-4 B-4 C-5 D-5 E-5 G-5 C-6
+};
+
+const uint8_t MUSIC_PATTERNS[3][MUSIC_ROWS] PROGMEM = {
+    { 6, 0, 8, 0, 9, 0, 8, 0, 6, 0, 3, 0, 4, 0, 5, 0 }, // a
+    { 2, 0, 4, 0, 6, 0, 4, 0, 3, 0, 5, 0, 7, 0, 5, 0 }, // b
+    { 6, 8, 9, 10, 9, 8, 6, 1, 8, 0, 7, 0, 6, 0, 1, 0 }, // c
+};
+
+const uint8_t MUSIC_ORDER[MUSIC_ORDER_LEN] PROGMEM = { 0, 1, 0, 2 }; // a b a c
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef MusicPlayer_h
+#define MusicPlayer_h
+
+#include <Arduino.h>
+#include "SampleAudio.h"
+#include "MusicData.h"
+
+// Reproductor de la musica de fondo (-DMUSIC): MusicData.h trae los
+// patrones y el orden ya compilados (tools/gen_music.py desde
+// resources/music.txt) y aqui solo se recorren. Todo el estado son dos
+// bytes; el resto lo lleva SampleAudio (fase, nota y cuenta de la fila).
+//
+// nextRow() corre dentro de la interrupcion de las muestras una vez por
+// fila (cada MUSIC_ROW_SAMPLES): lee un byte de la flash y a lo mas una
+// palabra, unos pocos ciclos cada ~100 ms. El juego no lo llama nunca.
+
+class MusicPlayer {
+private:
+    uint8_t order; // entrada de MUSIC_ORDER que suena
+    uint8_t row;
+
+public:
+    MusicPlayer() : order(0), row(0) {}
+
+    // desde el principio
+    void start() {
+        order = 0;
+        row = 0;
+        sampleAudio.startMusic();
+    }
+
+    void stop() {
+        sampleAudio.stopMusic();
+    }
+
+    void nextRow() {
+        uint8_t pattern = pgm_read_byte(&MUSIC_ORDER[order]);
+        uint8_t note = pgm_read_byte(&MUSIC_PATTERNS[pattern][row]);
+        if (note == 1) {
+            sampleAudio.musicStep = 0;
+        } else if (note > 1) {
+            sampleAudio.musicStep = pgm_read_word(&MUSIC_STEPS[note - 2]);
+        }
+        if (++row == MUSIC_ROWS) {
+            row = 0;
+            if (++order == MUSIC_ORDER_LEN) {
+                order = 0; // y vuelve a empezar
+            }
+        }
+    }
+};
+
+MusicPlayer musicPlayer;
+
+void musicRow() {
+    musicPlayer.nextRow();
+}
+
+#endif
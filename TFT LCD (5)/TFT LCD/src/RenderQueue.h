@@ -0,0 +1,397 @@
+#ifndef RenderQueue_h
+#define RenderQueue_h
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "Font5x7.h"
+
+// Cola de dibujo que se vacia sola con la interrupcion del SPI (-DRENDER_QUEUE).
+//
+// Display mete comandos cortos (rellenar un rectangulo, copiar uno de la
+// flash, una letra) y vuelve enseguida; la interrupcion de fin de byte del
+// SPI (SPI_STC) manda el byte siguiente. Asi las colisiones, la entrada y el
+// sonido corren mientras el bus esta ocupado, y el siguiente cuadro espera a
+// que la cola quede vacia con fence().
+//
+// Ojo con la velocidad: entre guardar registros, la maquina de estados y
+// volver, una interrupcion son unos 45 ciclos, mas que los 16 que tarda un
+// byte a fck/2. Con un byte por interrupcion a fck/8 (64 ciclos por byte)
+// al programa le quedaban unos 20 de cada 64: un sprite de 2048 bytes se
+// comia ~90000 ciclos de CPU para devolver ~40000, peor que mandarlo de una.
+// Por eso el SPI va a fck/2 y cada interrupcion se queda mandando hasta
+// RENDER_QUEUE_BURST bytes seguidos, esperando SPIF entre uno y otro (la
+// cuenta del byte siguiente se hace mientras sale el anterior); el ultimo
+// de la tanda trae la interrupcion que sigue. El programa casi no corre
+// durante una tanda, pero el cuadro entero gasta ~20 ciclos por byte en vez
+// de 64 y lo demas le queda libre. La tanda tiene tope para que la
+// interrupcion del sonido (SampleAudio.h, cada 2000 ciclos) no se atrase
+// mas que eso. Un relleno grande sigue saliendo mas rapido con SpiPump.h,
+// asi que la cola conviene para muchos comandos chicos (lo de cada cuadro).
+//
+// Cada comando ya viene recortado a la pantalla. La cola maneja CS y DC por
+// su cuenta; quien quiera usar el SPI directo (la libreria, SpiPump.h)
+// tiene que llamar antes a fence().
+
+#ifndef RENDER_QUEUE_LEN
+#define RENDER_QUEUE_LEN 32 // comandos, potencia de 2 (19 bytes cada uno: 608 B de RAM)
+#endif
+
+#ifndef RENDER_QUEUE_BURST
+#define RENDER_QUEUE_BURST 32 // bytes por interrupcion, ~650 ciclos a fck/2
+#endif
+
+enum RenderCmdType : uint8_t {
+    RQ_FILL,  // w x h pixeles de color
+    RQ_BLIT,  // w x h pixeles de la flash, saltando `stride` al final de cada fila
+    RQ_GLYPH  // letra `ch` de FONT_5X7 agrandada `size` veces, fondo transparente
+};
+
+struct RenderCmd {
+    uint8_t type;
+    uint8_t ch, size;   // RQ_GLYPH
+    uint16_t x, y, w, h;
+    uint16_t color;     // RQ_FILL, RQ_GLYPH
+    uint_farptr_t src;  // RQ_BLIT: primer pixel (direccion de flash, ver AssetBank.h)
+    uint16_t stride;    // RQ_BLIT
+};
+
+class RenderQueue {
+private:
+    RenderCmd cmds[RENDER_QUEUE_LEN];
+    volatile uint8_t head, tail;
+    volatile bool busy;
+
+    volatile uint8_t* csPort;
+    volatile uint8_t* dcPort;
+    uint8_t csMask, dcMask;
+#if defined(__AVR__)
+    uint8_t savedSpcr, savedSpsr;
+#endif
+
+    // estado de la interrupcion: el comando actual, la ventana que se esta
+    // abriendo (CASET x0 x1, PASET y0 y1, RAMWR) y los pixeles que faltan
+    RenderCmd cur;
+    uint8_t header[11];
+    uint8_t headerPos;  // 11: falta poner DC en datos, 12: pixeles
+    uint16_t winW, colsLeft, rowsLeft;
+    uint16_t pixel;
+    bool lowNext;
+    uint_farptr_t src;
+    uint8_t glyphCol, glyphBits, glyphRow;
+#ifdef INPUT_LATENCY
+    volatile uint8_t stampSlot; // el comando que anota la hora al salir, 0xFF si ninguno
+    volatile uint32_t stampUs;
+#endif
+
+    void send(uint8_t b) {
+#if defined(__AVR__)
+        SPDR = b;
+#else
+        SPI.transfer(b);
+#endif
+    }
+
+    // espera a que salga el byte anterior si lo mando esta misma
+    // interrupcion (si no, ya salio: por eso entro). Antes de cada byte,
+    // de tocar DC y de subir CS
+    void settle(uint8_t left) {
+#if defined(__AVR__)
+        if (left != RENDER_QUEUE_BURST) {
+            while (!(SPSR & _BV(SPIF))) {
+            }
+        }
+#else
+        (void)left;
+#endif
+    }
+
+    void openWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+        uint16_t x1 = x + w - 1, y1 = y + h - 1;
+        header[0] = 0x2A; // CASET
+        header[1] = x >> 8; header[2] = x; header[3] = x1 >> 8; header[4] = x1;
+        header[5] = 0x2B; // PASET
+        header[6] = y >> 8; header[7] = y; header[8] = y1 >> 8; header[9] = y1;
+        header[10] = 0x2C; // RAMWR
+        headerPos = 0;
+        winW = w;
+        colsLeft = w;
+        rowsLeft = h;
+        lowNext = false;
+        windows++;
+    }
+
+    // la siguiente racha vertical de pixeles encendidos de la letra, como
+    // TinyILI9341::write; false si ya no quedan
+    bool nextGlyphRun() {
+        for (;;) {
+            while (glyphBits) {
+                if (glyphBits & 1) {
+                    uint8_t len = 0;
+                    while (glyphBits & 1) { glyphBits >>= 1; len++; }
+                    openWindow(cur.x + glyphCol * cur.size, cur.y + glyphRow * cur.size,
+                               cur.size, len * cur.size);
+                    glyphRow += len;
+                    return true;
+                }
+                glyphBits >>= 1;
+                glyphRow++;
+            }
+            if (++glyphCol >= 5) {
+                return false;
+            }
+            glyphBits = pgm_read_byte(FONT_5X7 + (cur.ch - ' ') * 5 + glyphCol);
+            glyphRow = 0;
+        }
+    }
+
+    // saca el comando mas viejo y abre su primera ventana (un espacio no tiene)
+    void startCmd() {
+#ifdef INPUT_LATENCY
+        if (tail == stampSlot) {
+            stampSlot = 0xFF;
+            stampUs = micros() | 1;
+        }
+#endif
+        cur = cmds[tail];
+        tail = (tail + 1) & (RENDER_QUEUE_LEN - 1);
+        switch (cur.type) {
+        case RQ_GLYPH:
+            pixel = cur.color;
+            glyphCol = 0;
+            glyphRow = 0;
+            glyphBits = pgm_read_byte(FONT_5X7 + (cur.ch - ' ') * 5);
+            nextGlyphRun();
+            return;
+        case RQ_BLIT:
+            src = cur.src;
+            break;
+        default:
+            pixel = cur.color;
+            break;
+        }
+        openWindow(cur.x, cur.y, cur.w, cur.h);
+    }
+
+    static uint16_t readWord(uint_farptr_t addr) {
+#if defined(__AVR_HAVE_ELPM__)
+        return pgm_read_word_far(addr);
+#else
+        return pgm_read_word((const uint16_t*)(uintptr_t)addr);
+#endif
+    }
+
+    void finish() {
+        *csPort |= csMask;
+#if defined(__AVR__)
+        SPCR = savedSpcr;
+        SPSR = savedSpsr;
+#endif
+        busy = false;
+    }
+
+    // arranca la cola, con las interrupciones apagadas
+    void start() {
+        busy = true;
+        transactions++;
+        headerPos = 12;
+        rowsLeft = 0;
+        cur.type = RQ_FILL;
+#if defined(__AVR__)
+        savedSpcr = SPCR;
+        savedSpsr = SPSR & _BV(SPI2X);
+        SPCR = _BV(SPIE) | _BV(SPE) | _BV(MSTR); // modo 0, fck/2 con SPI2X
+        SPSR = _BV(SPI2X);
+        (void)SPSR; // limpiar SPIF si quedo puesto
+        (void)SPDR;
+#endif
+        *csPort &= ~csMask;
+        next();
+#if !defined(__AVR__)
+        while (busy) {
+            next(); // sin la interrupcion se vacia aqui mismo
+        }
+#endif
+    }
+
+    void push(const RenderCmd& c) {
+        uint8_t nextHead = (head + 1) & (RENDER_QUEUE_LEN - 1);
+        while (nextHead == tail) {
+            // llena: esperar a que la interrupcion saque uno
+        }
+#if defined(__AVR__)
+        uint8_t sreg = SREG;
+        cli();
+#endif
+        cmds[head] = c;
+        head = nextHead;
+        if (!busy) {
+            start();
+        }
+#if defined(__AVR__)
+        SREG = sreg;
+#endif
+    }
+
+public:
+    // ventanas (CASET, PASET, RAMWR) y veces que se bajo CS; fence() antes de leerlas
+    uint16_t windows, transactions;
+
+    RenderQueue() : head(0), tail(0), busy(false), csPort(0), dcPort(0), csMask(0), dcMask(0),
+                    headerPos(12), winW(0), colsLeft(0), rowsLeft(0), pixel(0), lowNext(false), src(0),
+                    glyphCol(0), glyphBits(0), glyphRow(0), windows(0), transactions(0) {}
+
+    // despues de inicializar el display (los pines ya son salidas)
+    void begin(uint8_t csPin, uint8_t dcPin) {
+        csPort = portOutputRegister(digitalPinToPort(csPin));
+        csMask = digitalPinToBitMask(csPin);
+        dcPort = portOutputRegister(digitalPinToPort(dcPin));
+        dcMask = digitalPinToBitMask(dcPin);
+#ifdef INPUT_LATENCY
+        stampSlot = 0xFF;
+        stampUs = 0;
+#endif
+    }
+
+    void fill(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+        RenderCmd c;
+        c.type = RQ_FILL;
+        c.x = x; c.y = y; c.w = w; c.h = h;
+        c.color = color;
+        push(c);
+    }
+
+    void blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint_farptr_t pixels, uint16_t stride) {
+        RenderCmd c;
+        c.type = RQ_BLIT;
+        c.x = x; c.y = y; c.w = w; c.h = h;
+        c.src = pixels;
+        c.stride = stride;
+        push(c);
+    }
+
+    // la letra tiene que caber entera en la pantalla y estar en FONT_5X7
+    void glyph(uint16_t x, uint16_t y, char ch, uint8_t size, uint16_t color) {
+        RenderCmd c;
+        c.type = RQ_GLYPH;
+        c.x = x; c.y = y;
+        c.ch = ch;
+        c.size = size;
+        c.color = color;
+        push(c);
+    }
+
+#ifdef INPUT_LATENCY
+    // anota micros() cuando la interrupcion empiece el proximo comando que
+    // se ponga en la cola (InputLatency.h)
+    void stampNext() {
+#if defined(__AVR__)
+        uint8_t sreg = SREG;
+        cli();
+#endif
+        stampSlot = head;
+        stampUs = 0;
+#if defined(__AVR__)
+        SREG = sreg;
+#endif
+    }
+
+    // 0 si todavia no salio
+    uint32_t stamped() {
+#if defined(__AVR__)
+        uint8_t sreg = SREG;
+        cli();
+#endif
+        uint32_t us = stampUs;
+#if defined(__AVR__)
+        SREG = sreg;
+#endif
+        return us;
+    }
+#endif
+
+    // espera a que salga todo lo que hay en la cola
+    void fence() {
+        while (busy) {
+        }
+    }
+
+    // manda los bytes que siguen, hasta RENDER_QUEUE_BURST; la llama la
+    // interrupcion cuando termina la tanda anterior
+    void next() {
+        uint8_t left = RENDER_QUEUE_BURST;
+        for (;;) {
+            if (headerPos < 11) {
+                uint8_t i = headerPos++;
+                settle(left);
+                if (i == 0 || i == 5 || i == 10) {
+                    *dcPort &= ~dcMask; // CASET, PASET y RAMWR son comandos
+                } else if (i == 1 || i == 6) {
+                    *dcPort |= dcMask;
+                }
+                send(header[i]);
+                if (--left == 0) {
+                    return;
+                }
+                continue;
+            }
+            if (rowsLeft) {
+                if (headerPos == 11) {
+                    settle(left);
+                    *dcPort |= dcMask;
+                    headerPos = 12;
+                }
+                uint8_t b;
+                if (lowNext) {
+                    lowNext = false;
+                    b = pixel;
+                    if (--colsLeft == 0) {
+                        colsLeft = winW;
+                        rowsLeft--;
+                        if (cur.type == RQ_BLIT) {
+                            src += 2 * cur.stride;
+                        }
+                    }
+                } else {
+                    if (cur.type == RQ_BLIT) {
+                        pixel = readWord(src);
+                        src += 2;
+                    }
+                    lowNext = true;
+                    b = pixel >> 8;
+                }
+                settle(left);
+                send(b);
+                if (--left == 0) {
+                    return;
+                }
+                continue;
+            }
+            // se termino la ventana
+            if (cur.type == RQ_GLYPH && nextGlyphRun()) {
+                continue;
+            }
+            if (tail == head) {
+                settle(left);
+                finish();
+                return;
+            }
+            startCmd();
+        }
+    }
+};
+
+RenderQueue renderQueue;
+
+#if defined(__AVR__)
+ISR(SPI_STC_vect) {
+#if defined(__AVR_HAVE_ELPM__)
+    uint8_t rampz = RAMPZ; // por si interrumpe a un ELPM de AssetBank.h
+#endif
+    renderQueue.next();
+#if defined(__AVR_HAVE_ELPM__)
+    RAMPZ = rampz;
+#endif
+}
+#endif
+
+#endif
@@ -0,0 +1,264 @@
+#ifndef SampleAudio_h
+#define SampleAudio_h
+
+#include <Arduino.h>
+#ifdef MUSIC
+#include "MusicData.h" // generado por tools/gen_music.py
+#endif
+
+// Efectos de sonido con muestras (-DSAMPLE_AUDIO), en vez de tone().
+//
+// El Timer2 hace PWM rapido de 8 bits sin prescaler en OC2B (62.5 kHz, muy
+// arriba de lo que se oye): el ancho del pulso es la muestra. El Timer1 en
+// CTC da la interrupcion de cada muestra a SAMPLE_RATE; ahi cada voz avanza
+// su acumulador de fase (8.8: la parte alta son las muestras del clip que
+// hay que saltar) y las dos voces se suman con saturacion.
+//
+// Los clips van en PROGMEM (SoundClips.h, tools/gen_sound_clips.py), en PCM
+// de 8 bits con signo o en ADPCM de 4 bits. Lo que cuesta la interrupcion
+// tiene tope: dos voces y el paso hasta 2.0, o sea a lo mas dos muestras
+// por voz en cada interrupcion. Al salir se lee TCNT1, que cuenta desde la
+// comparacion, y se guarda el peor caso (ciclos por muestra con la entrada
+// y la salida) para ver por Serial que no se come el cuadro.
+//
+// En el Mega OC2B es el pin 9 y en el Uno el 3: ahi va el buzzer (mejor un
+// parlantito con un capacitor en serie). tone() usa el mismo Timer2, asi
+// que con esto ya no se llama; play() arranca un clip y vuelve enseguida.
+//
+// Con -DMUSIC la voz 1 es el canal de la musica (MusicPlayer.h) cuando no
+// la usa un efecto: un oscilador con la onda de MUSIC_WAVE. Cada
+// MUSIC_ROW_SAMPLES muestras la misma interrupcion llama a musicRow(), que
+// cambia la nota. Los efectos le quitan la voz 1 a la musica y, cuando
+// terminan, la musica sigue donde va (las filas no dejan de correr).
+
+#define SAMPLE_RATE 8000
+#define SAMPLE_VOICES 2
+#define SAMPLE_MAX_STEP 0x200 // 2.0: tope de lo que avanza una voz por muestra
+#define SAMPLE_CYCLES (F_CPU / SAMPLE_RATE) // 2000 ciclos entre muestras a 16 MHz
+#define SAMPLE_ISR_BUDGET (SAMPLE_CYCLES / 10) // lo que se le deja a la interrupcion
+
+#if defined(__AVR_ATmega2560__)
+#define SAMPLE_PIN 9 // OC2B = PH6
+#else
+#define SAMPLE_PIN 3 // OC2B = PD3
+#endif
+
+enum SampleFormat : uint8_t {
+    SAMPLE_PCM8,  // un byte con signo por muestra
+    SAMPLE_ADPCM4 // 4 bits por muestra, el nibble bajo primero
+};
+
+struct SoundClip {
+    const uint8_t* data; // en PROGMEM
+    uint16_t length;     // muestras
+    uint8_t format;      // SampleFormat
+};
+
+// ADPCM parecido al IMA pero en 8 bits: cada codigo es signo + 3 bits de
+// magnitud en pasos de `step`, y el paso crece o se achica segun el codigo.
+// tools/gen_sound_clips.py tiene las mismas tablas
+const uint8_t ADPCM_STEPS[16] PROGMEM = { 1, 2, 3, 4, 5, 6, 8, 10, 13, 16, 20, 26, 33, 42, 54, 70 };
+const int8_t ADPCM_INDEX[8] PROGMEM = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+#ifdef MUSIC
+void musicRow(); // MusicPlayer.h: la fila siguiente, desde la interrupcion
+#endif
+
+struct SampleVoice {
+    const uint8_t* data;
+    uint16_t left;    // muestras que faltan
+    uint16_t phase;   // 8.8
+    uint16_t step;    // 8.8, 0x100 = la velocidad del clip
+    int8_t sample;    // lo que suena ahora
+    uint8_t format;
+    uint8_t index;    // ADPCM: paso actual
+    bool highNibble;  // ADPCM: el siguiente codigo es el nibble alto
+};
+
+class SampleAudio {
+private:
+    SampleVoice voices[SAMPLE_VOICES];
+    volatile uint8_t active; // un bit por voz
+#ifdef MUSIC
+    uint16_t musicPhase;
+    uint16_t rowLeft;       // muestras que faltan para la fila siguiente
+    volatile bool musicOn;
+#endif
+
+    // la siguiente muestra del clip de la voz
+    static void advance(SampleVoice& v) {
+        if (v.format == SAMPLE_PCM8) {
+            v.sample = (int8_t)pgm_read_byte(v.data++);
+            return;
+        }
+        uint8_t code = pgm_read_byte(v.data);
+        if (v.highNibble) {
+            code >>= 4;
+            v.data++;
+        }
+        v.highNibble = !v.highNibble;
+        code &= 0x0F;
+        uint8_t step = pgm_read_byte(&ADPCM_STEPS[v.index]);
+        int16_t diff = step >> 3;
+        if (code & 4) diff += step;
+        if (code & 2) diff += step >> 1;
+        if (code & 1) diff += step >> 2;
+        int16_t pred = (code & 8) ? v.sample - diff : v.sample + diff;
+        v.sample = pred < -128 ? -128 : (pred > 127 ? 127 : pred);
+        int8_t index = v.index + (int8_t)pgm_read_byte(&ADPCM_INDEX[code & 7]);
+        v.index = index < 0 ? 0 : (index > 15 ? 15 : index);
+    }
+
+public:
+    uint16_t peakCycles; // el peor caso de la interrupcion desde el ultimo report
+#ifdef MUSIC
+    uint16_t musicStep;  // lo pone musicRow(); 0 es silencio
+#endif
+
+    SampleAudio() : active(0),
+#ifdef MUSIC
+                    musicPhase(0), rowLeft(0), musicOn(false),
+#endif
+                    peakCycles(0)
+#ifdef MUSIC
+                    , musicStep(0)
+#endif
+    {}
+
+    void begin() {
+        pinMode(SAMPLE_PIN, OUTPUT);
+        // Timer2: PWM rapido (modo 3), OC2B sin invertir, sin prescaler
+        TCCR2A = _BV(COM2B1) | _BV(WGM21) | _BV(WGM20);
+        TCCR2B = _BV(CS20);
+        OCR2B = 128; // silencio: la mitad
+        // Timer1: CTC (modo 4) a SAMPLE_RATE, sin prescaler
+        TCCR1A = 0;
+        TCCR1B = _BV(WGM12) | _BV(CS10);
+        OCR1A = SAMPLE_CYCLES - 1;
+        TIMSK1 |= _BV(OCIE1A);
+    }
+
+    // arranca el clip (en PROGMEM) en una voz libre, o en la que le falte
+    // menos si las dos estan sonando. step 0x100 es la velocidad original;
+    // mas alto suena mas agudo y mas corto
+    void play(const SoundClip* clip, uint16_t step = 0x100) {
+        SoundClip c;
+        memcpy_P(&c, clip, sizeof(c));
+        uint8_t first = 0;
+#ifdef MUSIC
+        if (musicOn) {
+            first = 1; // primero se le quita la voz a la musica
+        }
+#endif
+        uint8_t second = first ^ 1;
+        uint8_t sreg = SREG;
+        cli();
+        uint8_t i = first;
+        if (active & (1 << first)) {
+            i = (!(active & (1 << second)) || voices[second].left < voices[first].left) ? second : first;
+        }
+        SampleVoice& v = voices[i];
+        v.data = c.data;
+        v.left = c.length;
+        v.phase = 0xFF; // la primera muestra sale en la siguiente interrupcion
+        v.step = step > SAMPLE_MAX_STEP ? SAMPLE_MAX_STEP : step;
+        v.sample = 0;
+        v.format = c.format;
+        v.index = 0;
+        v.highNibble = false;
+        active |= 1 << i;
+        SREG = sreg;
+    }
+
+    void stop() {
+        active = 0;
+    }
+    
+#ifdef MUSIC
+    // la primera fila sale en la siguiente interrupcion
+    void startMusic() {
+        uint8_t sreg = SREG;
+        cli();
+        musicStep = 0;
+        rowLeft = 1;
+        musicOn = true;
+        SREG = sreg;
+    }
+    
+    void stopMusic() {
+        musicOn = false;
+    }
+#endif
+
+    bool isPlaying() const {
+        return active != 0;
+    }
+
+    // una muestra: la llama la interrupcion del Timer1
+    void tick() {
+        int16_t mix = 0;
+        for (uint8_t i = 0; i < SAMPLE_VOICES; i++) {
+            if (!(active & (1 << i))) {
+                continue;
+            }
+            SampleVoice& v = voices[i];
+            v.phase += v.step;
+            for (uint8_t n = v.phase >> 8; n > 0; n--) { // 0, 1 o 2
+                if (v.left == 0) {
+                    active &= ~(1 << i);
+                    v.sample = 0;
+                    break;
+                }
+                v.left--;
+                advance(v);
+            }
+            v.phase &= 0xFF;
+            mix += v.sample;
+        }
+#ifdef MUSIC
+        if (musicOn) {
+            if (!(active & 2) && musicStep) {
+                musicPhase += musicStep;
+                mix += (int8_t)pgm_read_byte(&MUSIC_WAVE[musicPhase >> 11]);
+            }
+            if (--rowLeft == 0) {
+                rowLeft = MUSIC_ROW_SAMPLES;
+                musicRow();
+            }
+        }
+#endif
+        OCR2B = (mix < -128 ? -128 : (mix > 127 ? 127 : mix)) + 128;
+    }
+
+    // el peor caso de la interrupcion contra el tope, por Serial
+    void report(Print& out) {
+        uint8_t sreg = SREG;
+        cli();
+        uint16_t peak = peakCycles;
+        peakCycles = 0;
+        SREG = sreg;
+        out.print(F("audio ciclos="));
+        out.print(peak);
+        out.print('/');
+        out.print(SAMPLE_ISR_BUDGET);
+        if (peak > SAMPLE_ISR_BUDGET) {
+            out.print(F(" SE PASA"));
+        }
+        out.print(F(" de "));
+        out.println(SAMPLE_CYCLES);
+    }
+};
+
+SampleAudio sampleAudio;
+
+#if defined(__AVR__)
+ISR(TIMER1_COMPA_vect) {
+    sampleAudio.tick();
+    uint16_t cycles = TCNT1; // desde la comparacion: la entrada, tick() y hasta aqui
+    if (cycles > sampleAudio.peakCycles) {
+        sampleAudio.peakCycles = cycles;
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef SaveLog_h
+#define SaveLog_h
+
+#include <Arduino.h>
+#include <avr/eeprom.h>
+
+// Lo que queda guardado en la EEPROM (-DSAVE_GAME): el record, la
+// configuracion y la partida a medias, para seguirla despues de apagar.
+//
+// Cada byte de la EEPROM aguanta unas 100000 escrituras, asi que no se
+// escribe siempre en el mismo lugar: la EEPROM entera es un registro
+// circular de SaveRecord de 16 bytes (256 en el Mega, 64 en el Uno) y cada
+// save() va a la ranura siguiente con seq + 1. Al arrancar se leen todas y
+// vale la de seq mas alto que tenga bien el checksum. El checksum es lo
+// ultimo que se escribe: si se corta la luz a medio registro esa ranura no
+// cuadra y queda la anterior.
+//
+// Escribir un byte tarda 3.3 ms, asi que save() no escribe nada: copia el
+// registro y lo va escribiendo la interrupcion EE_READY, un byte por vez
+// mientras el juego sigue. Los bytes que ya tienen ese valor se saltan (en
+// la ranura vieja casi todo es igual). Si llega otro save() mientras tanto
+// queda esperando solo el ultimo: los de en medio ya no hacen falta.
+
+#define SAVE_SLOTS ((E2END + 1) / sizeof(SaveRecord))
+
+#define SAVE_IN_GAME 0x01 // flags: hay una partida a medias
+
+struct SaveRecord {
+    uint16_t seq;
+    uint16_t highScore;
+    uint8_t settings;   // para lo que se pueda configurar; hoy nada lo cambia
+    uint8_t flags;      // SAVE_IN_GAME
+    // la partida a medias (si flags lo dice)
+    uint8_t level;
+    uint8_t lives;
+    int16_t score;
+    uint16_t coins;     // un bit por moneda agarrada: nivel * MAX_OBJECTS + i
+    uint8_t reserved[3];
+    uint8_t check;      // el ultimo byte que se escribe
+};
+
+static_assert(sizeof(SaveRecord) == 16, "SaveRecord tiene que medir 16 bytes");
+
+class SaveLog {
+private:
+    SaveRecord saved;   // lo ultimo que se mando a guardar
+    SaveRecord writing; // lo que esta escribiendo la interrupcion
+    SaveRecord pending; // lo que sigue, si llego un save() mientras tanto
+    uint16_t seq;       // el de la ultima ranura escrita
+    uint16_t slot;
+    uint8_t writePos;   // byte de writing que sigue
+    volatile bool busy;
+    volatile bool hasPending;
+
+    // no puede dar lo mismo que una ranura en blanco (todo 0xFF) ni en cero
+    static uint8_t checksum(const SaveRecord& r) {
+        const uint8_t* p = (const uint8_t*)&r;
+        uint8_t sum = 0x5A;
+        for (uint8_t i = 0; i < sizeof(r) - 1; i++) {
+            sum = (sum << 1 | sum >> 7) ^ p[i];
+        }
+        return sum;
+    }
+
+    // la interrupcion empieza con el registro que esperaba, en la ranura siguiente
+    void startRecord() {
+        writing = pending;
+        hasPending = false;
+        writing.seq = ++seq;
+        slot = slot + 1 == SAVE_SLOTS ? 0 : slot + 1;
+        writing.check = checksum(writing);
+        writePos = 0;
+        EECR |= _BV(EERIE);
+    }
+
+public:
+    SaveLog() : seq(0), slot(SAVE_SLOTS - 1), writePos(0), busy(false), hasPending(false) {
+        memset(&saved, 0, sizeof(saved));
+    }
+
+    // busca el registro mas nuevo; false si no hay ninguno (EEPROM en blanco).
+    // Lee toda la EEPROM (4 KB en el Mega), un par de ms
+    bool load() {
+        bool found = false;
+        for (uint16_t i = 0; i < SAVE_SLOTS; i++) {
+            SaveRecord r;
+            eeprom_read_block(&r, (const void*)(i * sizeof(r)), sizeof(r));
+            if (r.check != checksum(r)) {
+                continue;
+            }
+            // seq da la vuelta: vale la resta con signo
+            if (!found || (int16_t)(r.seq - seq) > 0) {
+                found = true;
+                seq = r.seq;
+                slot = i;
+                saved = r;
+            }
+        }
+        return found;
+    }
+
+    const SaveRecord& last() const {
+        return saved;
+    }
+
+    // vuelve enseguida: lo escribe la interrupcion
+    void save(const SaveRecord& r) {
+        saved = r;
+        uint8_t sreg = SREG;
+        cli();
+        pending = r;
+        hasPending = true;
+        if (!busy) {
+            busy = true;
+            startRecord();
+        }
+        SREG = sreg;
+    }
+
+    bool isWriting() const {
+        return busy;
+    }
+
+    // EE_READY: la EEPROM termino el byte anterior. Lee los que siguen hasta
+    // uno distinto y lo manda a escribir (borrar y escribir, 3.3 ms)
+    void writeNext() {
+        const uint8_t* p = (const uint8_t*)&writing;
+        while (writePos < sizeof(SaveRecord)) {
+            uint16_t addr = slot * sizeof(SaveRecord) + writePos;
+            uint8_t b = p[writePos++];
+            EEAR = addr;
+            EECR |= _BV(EERE);
+            if (EEDR != b) {
+                EEDR = b;
+                EECR |= _BV(EEMPE); // EEPE tiene que ir antes de 4 ciclos
+                EECR |= _BV(EEPE);
+                return;
+            }
+        }
+        if (hasPending) {
+            startRecord();
+        } else {
+            busy = false;
+            EECR &= ~_BV(EERIE);
+        }
+    }
+};
+
+SaveLog saveLog;
+
+#if defined(__AVR__)
+ISR(EE_READY_vect) {
+    saveLog.writeNext();
+}
+#endif
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef Scheduler_h
+#define Scheduler_h
+
+#include <Arduino.h>
+#ifndef NO_IDLE_SLEEP
+#include <avr/sleep.h>
+#endif
+
+// Planificador cooperativo: loop() solo llama a run(), que corre las
+// tareas que ya tocan. Las tareas son funciones que hacen un pedazo y
+// vuelven (sin pila propia); lo que tengan que recordar entre vuelta y
+// vuelta lo guardan en su contexto, como una maquina de estados.
+//
+// Cada tarea tiene:
+//   periodo    cada cuantos ms toca (0: en cada vuelta de loop)
+//   prioridad  0 es la mas alta; en una vuelta corren todas las que tocan,
+//              de la mas alta a la mas baja, y cada una a lo mas una vez,
+//              asi que una tarea no deja sin correr a las demas
+//   tope       microsegundos que deberia tardar; si se pasa se cuenta
+// Si una tarea se atrasa mas de un periodo no corre varias veces seguidas
+// para alcanzar: se salta lo perdido y cuenta como atrasada.
+//
+// Si despues de una vuelta no toca ninguna tarea con periodo, la CPU se
+// duerme en SLEEP_MODE_IDLE (los timers, el SPI y las interrupciones siguen)
+// hasta la proxima interrupcion: el Timer0 de millis() cada 1.024 ms, el
+// boton, o la del SPI, el audio o la EEPROM si estan andando. Las tareas de
+// periodo 0 corren al despertar, asi que el boton se sigue leyendo por lo
+// menos cada ms. Una tarea que dejo trabajo a medias llama a stayAwake() y
+// la vuelta que sigue sale enseguida. reportDuty() dice que parte del
+// tiempo estuvo despierta: lo que sobra es lo que le queda libre a la CPU.
+// Con -DNO_IDLE_SLEEP no se duerme nunca (para comparar el consumo).
+//
+// Todo es estatico: SCHED_MAX_TASKS entradas en un arreglo.
+
+#define SCHED_MAX_TASKS 6
+
+typedef void (*TaskFn)(void* ctx);
+
+struct Task {
+    TaskFn fn;
+    void* ctx;
+    const __FlashStringHelper* name;
+    uint16_t periodMs;
+    uint8_t priority;
+    uint32_t budgetUs;
+    uint32_t nextMs;    // millis() cuando toca
+    // desde el ultimo reportTask()
+    uint16_t runs;
+    uint16_t overruns;  // veces que se paso del tope
+    uint16_t late;      // veces que se perdio un periodo entero
+    uint32_t worstUs;
+};
+
+class Scheduler {
+private:
+    Task tasks[SCHED_MAX_TASKS];
+    uint8_t count;
+    uint8_t order[SCHED_MAX_TASKS]; // indices por prioridad
+    bool busy;                      // alguien pidio otra vuelta sin dormir
+    uint32_t sleptUs;               // dormido desde el ultimo reportDuty()
+    uint32_t windowStart;           // micros() del ultimo reportDuty()
+
+    // duerme si no toca ninguna tarea con periodo
+    void idle() {
+        if (busy) {
+            busy = false;
+            return;
+        }
+        uint32_t now = millis();
+        for (uint8_t i = 0; i < count; i++) {
+            if (tasks[i].periodMs && (int32_t)(now - tasks[i].nextMs) >= 0) {
+                return;
+            }
+        }
+#ifndef NO_IDLE_SLEEP
+        uint32_t start = micros();
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        sleep_enable();
+        sleep_cpu(); // hasta la siguiente interrupcion
+        sleep_disable();
+        sleptUs += micros() - start;
+#endif
+    }
+
+public:
+    Scheduler() : count(0), busy(false), sleptUs(0), windowStart(0) {}
+
+    // devuelve el numero de la tarea (el orden en que se agregan)
+    uint8_t add(const __FlashStringHelper* name, TaskFn fn, void* ctx,
+                uint16_t periodMs, uint8_t priority, uint32_t budgetUs) {
+        Task& t = tasks[count];
+        t.fn = fn;
+        t.ctx = ctx;
+        t.name = name;
+        t.periodMs = periodMs;
+        t.priority = priority;
+        t.budgetUs = budgetUs;
+        t.nextMs = millis();
+        t.runs = 0;
+        t.overruns = 0;
+        t.late = 0;
+        t.worstUs = 0;
+        // insercion en el orden por prioridad (las de igual prioridad quedan
+        // en el orden en que se agregaron)
+        uint8_t i = count;
+        while (i > 0 && tasks[order[i - 1]].priority > priority) {
+            order[i] = order[i - 1];
+            i--;
+        }
+        order[i] = count;
+        return count++;
+    }
+
+    // cambia el periodo y el tope; la siguiente vez toca en un periodo
+    void setPeriod(uint8_t id, uint16_t periodMs, uint32_t budgetUs) {
+        Task& t = tasks[id];
+        t.periodMs = periodMs;
+        t.budgetUs = budgetUs;
+        t.nextMs = millis() + periodMs;
+    }
+
+    // una vuelta: las tareas que tocan, por prioridad
+    void run() {
+        for (uint8_t k = 0; k < count; k++) {
+            Task& t = tasks[order[k]];
+            uint32_t now = millis();
+            if ((int32_t)(now - t.nextMs) < 0) {
+                continue;
+            }
+            if (t.periodMs) {
+                t.nextMs += t.periodMs;
+                if ((int32_t)(now - t.nextMs) >= 0) {
+                    t.late++;
+                    t.nextMs = now + t.periodMs; // no corre de nuevo para alcanzar
+                }
+            }
+            uint32_t start = micros();
+            t.fn(t.ctx);
+            uint32_t took = micros() - start;
+            t.runs++;
+            if (took > t.worstUs) {
+                t.worstUs = took;
+            }
+            if (took > t.budgetUs) {
+                t.overruns++;
+            }
+        }
+        idle();
+    }
+
+    // la vuelta que sigue sin dormir (la tarea tiene mas que hacer)
+    void stayAwake() {
+        busy = true;
+    }
+
+    uint8_t size() const {
+        return count;
+    }
+
+    // la parte del tiempo despierta desde la vez anterior y vuelve a contar:
+    //   despierto 23% de 10240 ms
+    void reportDuty(Print& out) {
+        uint32_t now = micros();
+        uint32_t elapsed = now - windowStart;
+        out.print(F("despierto "));
+        out.print(elapsed >= 100 ? 100 - sleptUs / (elapsed / 100) : 100);
+        out.print(F("% de "));
+        out.print(elapsed / 1000);
+        out.println(F(" ms"));
+        windowStart = now;
+        sleptUs = 0;
+    }
+
+    // una linea por tarea y vuelve a contar:
+    //   tarea juego x200 peor 31240/40000 us pasadas 0 atrasos 0
+    void reportTask(Print& out, uint8_t id) {
+        Task& t = tasks[id];
+        out.print(F("tarea "));
+        out.print(t.name);
+        out.print(F(" x"));
+        out.print(t.runs);
+        out.print(F(" peor "));
+        out.print(t.worstUs);
+        out.print('/');
+        out.print(t.budgetUs);
+        out.print(F(" us pasadas "));
+        out.print(t.overruns);
+        out.print(F(" atrasos "));
+        out.println(t.late);
+        t.runs = 0;
+        t.overruns = 0;
+        t.late = 0;
+        t.worstUs = 0;
+    }
+};
+
+#endif
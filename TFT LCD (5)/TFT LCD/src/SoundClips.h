@@ -0,0 +1,465 @@
+#ifndef SoundClips_h
+#define SoundClips_h
+
+#include <Arduino.h>
+#include "SampleAudio.h"
+
+// Generado por tools/gen_sound_clips.py, no editar a mano.
+// Efectos de sonido a 8000 Hz para SampleAudio.h (-DSAMPLE_AUDIO).
+
+// 1120 muestras (0.14 s), 1120 bytes
+const uint8_t CLIP_COIN_DATA[1120] PROGMEM = {
+    0x00, 0x02, 0x04, 0x02, 0xf8, 0xf4, 0xf4, 0xfa, 0x0f, 0x16, 0x15, 0x0a, 0xeb, 0xe1, 0xe3, 0xf1,
+    0x1b, 0x29, 0x26, 0x14, 0xdf, 0xcf, 0xd1, 0xe7, 0x26, 0x3a, 0x38, 0x1f, 0xd6, 0xbe, 0xbf, 0xdb,
+    0x2e, 0x4a, 0x4a, 0x2b, 0xce, 0xae, 0xae, 0xce, 0x35, 0x57, 0x57, 0x35, 0xce, 0xab, 0xa9, 0xc9,
+    0x2f, 0x53, 0x57, 0x39, 0xd3, 0xae, 0xa9, 0xc6, 0x2a, 0x50, 0x57, 0x3c, 0xd9, 0xb2, 0xa9, 0xc3,
+    0x25, 0x4c, 0x56, 0x3e, 0xde, 0xb6, 0xaa, 0xc0, 0x20, 0x48, 0x56, 0x41, 0xe3, 0xba, 0xab, 0xbe,
+    0x1b, 0x44, 0x54, 0x43, 0x1a, 0xbe, 0xac, 0xbc, 0xe4, 0x3f, 0x53, 0x45, 0x1e, 0xc3, 0xae, 0xba,
+    0xe0, 0x3b, 0x51, 0x46, 0x22, 0xc7, 0xb0, 0xb9, 0xdc, 0x37, 0x4f, 0x48, 0x25, 0xcc, 0xb2, 0xb8,
+    0xd9, 0x32, 0x4c, 0x49, 0x29, 0xd0, 0xb5, 0xb7, 0xd6, 0x2e, 0x4a, 0x49, 0x2c, 0xd5, 0xb8, 0xb7,
+    0xd3, 0x29, 0x47, 0x49, 0x2f, 0xd9, 0xbb, 0xb7, 0xd0, 0x25, 0x44, 0x49, 0x31, 0xde, 0xbe, 0xb7,
+    0xcd, 0x20, 0x41, 0x49, 0x34, 0xe2, 0xc1, 0xb7, 0xcb, 0x1c, 0x3d, 0x48, 0x36, 0xe6, 0xc4, 0xb8,
+    0xc9, 0x18, 0x3a, 0x47, 0x38, 0xea, 0xc8, 0xb9, 0xc7, 0xe9, 0x36, 0x46, 0x3a, 0x18, 0xcb, 0xbb,
+    0xc6, 0xe6, 0x33, 0x44, 0x3b, 0x1b, 0xcf, 0xbc, 0xc5, 0xe3, 0x2f, 0x43, 0x3c, 0x1f, 0xd3, 0xbe,
+    0xc4, 0xe0, 0x2b, 0x41, 0x3d, 0x21, 0xd7, 0xc0, 0xc3, 0xdd, 0x27, 0x3f, 0x3d, 0x24, 0xdb, 0xc2,
+    0xc3, 0xdb, 0x24, 0x3c, 0x3e, 0x27, 0xde, 0xc5, 0xc2, 0xd8, 0x20, 0x3a, 0x3e, 0x29, 0xe2, 0xc7,
+    0xc3, 0xd6, 0x1c, 0x37, 0x3d, 0x2b, 0xe6, 0xca, 0xc3, 0xd4, 0x18, 0x34, 0x3d, 0x2d, 0xe9, 0xcd,
+    0xc3, 0xd2, 0x15, 0x32, 0x3c, 0x2f, 0xed, 0xd0, 0xc4, 0xd1, 0xee, 0x2f, 0x3b, 0x30, 0x14, 0xd3,
+    0xc5, 0xcf, 0xeb, 0x2c, 0x3a, 0x31, 0x16, 0xd6, 0xc7, 0xce, 0xe8, 0x28, 0x39, 0x32, 0x19, 0xd9,
+    0xc8, 0xcd, 0xe6, 0x25, 0x37, 0x33, 0x1b, 0xdc, 0xca, 0xcd, 0xe3, 0x22, 0x35, 0x33, 0x1e, 0xe0,
+    0xcc, 0xcc, 0xe1, 0x1f, 0x33, 0x34, 0x20, 0xe3, 0xce, 0xcc, 0xdf, 0x1c, 0x31, 0x34, 0x22, 0xe6,
+    0xd0, 0xcc, 0xdd, 0x19, 0x2f, 0x34, 0x24, 0xe9, 0xd2, 0xcd, 0xdb, 0x15, 0x2d, 0x33, 0x25, 0xec,
+    0xd4, 0xcd, 0xda, 0x12, 0x2a, 0x33, 0x27, 0xef, 0xd7, 0xce, 0xd9, 0x0f, 0x28, 0x32, 0x28, 0x10,
+    0xd9, 0xce, 0xd7, 0xef, 0x25, 0x31, 0x29, 0x12, 0xdc, 0xd0, 0xd6, 0xed, 0x23, 0x30, 0x2a, 0x14,
+    0xdf, 0xd1, 0xd6, 0xeb, 0x20, 0x2f, 0x2b, 0x16, 0xe1, 0xd2, 0xd5, 0xe9, 0x1d, 0x2d, 0x2b, 0x18,
+    0xe4, 0xd4, 0xd5, 0xe7, 0x1b, 0x2c, 0x2b, 0x1a, 0xe7, 0xd5, 0xd4, 0xe5, 0x18, 0x2a, 0x2c, 0x1c,
+    0xe9, 0xd7, 0xd4, 0xe3, 0x15, 0x28, 0x2b, 0x1e, 0xec, 0xd9, 0xd5, 0xe2, 0x13, 0x26, 0x2b, 0x1f,
+    0xe7, 0xd5, 0xe0, 0x18, 0x2b, 0x20, 0xe9, 0xd6, 0xdf, 0x16, 0x2a, 0x21, 0xeb, 0xd7, 0xde, 0x14,
+    0x29, 0x22, 0xed, 0xd8, 0xdd, 0x11, 0x28, 0x23, 0xf0, 0xd9, 0xdd, 0x0f, 0x26, 0x24, 0xf2, 0xda,
+    0xdc, 0x0d, 0x25, 0x24, 0xf4, 0xdc, 0xdb, 0xf3, 0x24, 0x25, 0x0e, 0xdd, 0xdb, 0xf1, 0x22, 0x25,
+    0x0f, 0xdf, 0xdb, 0xf0, 0x21, 0x25, 0x11, 0xe0, 0xdb, 0xee, 0x1f, 0x25, 0x13, 0xe2, 0xdb, 0xed,
+    0x1d, 0x25, 0x14, 0xe4, 0xdb, 0xeb, 0x1c, 0x25, 0x15, 0xe5, 0xdb, 0xea, 0x1a, 0x25, 0x17, 0xe7,
+    0xdb, 0xe9, 0x18, 0x25, 0x18, 0xe9, 0xdc, 0xe7, 0x16, 0x24, 0x19, 0xeb, 0xdc, 0xe6, 0x14, 0x23,
+    0x1a, 0xed, 0xdd, 0xe5, 0x13, 0x23, 0x1b, 0xee, 0xde, 0xe4, 0x11, 0x22, 0x1c, 0xf0, 0xdf, 0xe4,
+    0x0f, 0x21, 0x1d, 0xf2, 0xe0, 0xe3, 0x0d, 0x20, 0x1d, 0xf4, 0xe1, 0xe2, 0x0b, 0x1f, 0x1e, 0xf5,
+    0xe2, 0xe2, 0xf6, 0x1e, 0x1e, 0x0b, 0xe3, 0xe2, 0xf4, 0x1d, 0x1f, 0x0c, 0xe4, 0xe1, 0xf3, 0x1b,
+    0x1f, 0x0e, 0xe5, 0xe1, 0xf2, 0x1a, 0x1f, 0x0f, 0xe7, 0xe1, 0xf0, 0x19, 0x1f, 0x10, 0xe8, 0xe1,
+    0xef, 0x17, 0x1f, 0x11, 0xea, 0xe1, 0xee, 0x16, 0x1f, 0x12, 0xeb, 0xe2, 0xed, 0x14, 0x1e, 0x13,
+    0xec, 0xe2, 0xec, 0x13, 0x1e, 0x14, 0xee, 0xe2, 0xeb, 0x11, 0x1d, 0x15, 0xef, 0xe3, 0xea, 0x10,
+    0x1d, 0x16, 0xf1, 0xe4, 0xea, 0x0e, 0x1c, 0x17, 0xf2, 0xe4, 0xe9, 0x0d, 0x1b, 0x17, 0xf4, 0xe5,
+    0xe8, 0x0b, 0x1b, 0x18, 0xf5, 0xe6, 0xe8, 0x0a, 0x1a, 0x18, 0xf7, 0xe7, 0xe7, 0x08, 0x19, 0x19,
+    0x09, 0xe8, 0xe7, 0xf7, 0x18, 0x19, 0x0a, 0xe9, 0xe7, 0xf6, 0x17, 0x19, 0x0b, 0xea, 0xe7, 0xf5,
+    0x16, 0x19, 0x0c, 0xeb, 0xe7, 0xf4, 0x15, 0x19, 0x0d, 0xec, 0xe7, 0xf3, 0x13, 0x19, 0x0e, 0xed,
+    0xe7, 0xf2, 0x12, 0x19, 0x0f, 0xee, 0xe7, 0xf1, 0x11, 0x19, 0x10, 0xf0, 0xe7, 0xf0, 0x10, 0x19,
+    0x11, 0xf1, 0xe7, 0xef, 0x0f, 0x18, 0x11, 0xf2, 0xe8, 0xee, 0x0d, 0x18, 0x12, 0xf3, 0xe8, 0xee,
+    0x0c, 0x17, 0x13, 0xf4, 0xe9, 0xed, 0x0b, 0x17, 0x13, 0xf6, 0xea, 0xed, 0x0a, 0x16, 0x14, 0xf7,
+    0xea, 0xec, 0x09, 0x15, 0x14, 0xf8, 0xeb, 0xec, 0x07, 0x15, 0x14, 0xf9, 0xec, 0xec, 0xf9, 0x14,
+    0x15, 0x08, 0xec, 0xeb, 0xf8, 0x13, 0x15, 0x09, 0xed, 0xeb, 0xf7, 0x12, 0x15, 0x0a, 0xee, 0xeb,
+    0xf6, 0x11, 0x15, 0x0a, 0xef, 0xeb, 0xf5, 0x10, 0x15, 0x0b, 0xf0, 0xeb, 0xf4, 0x0f, 0x15, 0x0c,
+    0xf1, 0xeb, 0xf4, 0x0e, 0x15, 0x0d, 0xf2, 0xeb, 0xf3, 0x0d, 0x14, 0x0d, 0xf3, 0xec, 0xf2, 0x0c,
+    0x14, 0x0e, 0xf4, 0xec, 0xf2, 0x0b, 0x14, 0x0f, 0xf5, 0xec, 0xf1, 0x0a, 0x13, 0x0f, 0xf6, 0xed,
+    0xf1, 0x09, 0x13, 0x10, 0xf7, 0xed, 0xf0, 0x08, 0x12, 0x10, 0xf8, 0xee, 0xf0, 0x07, 0x12, 0x10,
+    0xf9, 0xee, 0xef, 0x06, 0x11, 0x11, 0xfa, 0xef, 0xef, 0xfa, 0x11, 0x11, 0x06, 0xf0, 0xef, 0xfa,
+    0x10, 0x11, 0x07, 0xf0, 0xef, 0xf9, 0x0f, 0x11, 0x08, 0xf1, 0xef, 0xf8, 0x0f, 0x11, 0x08, 0xf2,
+    0xef, 0xf7, 0x0e, 0x11, 0x09, 0xf3, 0xef, 0xf7, 0x0d, 0x11, 0x0a, 0xf3, 0xef, 0xf6, 0x0c, 0x11,
+    0x0a, 0xf4, 0xef, 0xf5, 0x0b, 0x11, 0x0b, 0xf5, 0xef, 0xf5, 0x0b, 0x11, 0x0b, 0xf6, 0xef, 0xf4,
+    0x0a, 0x10, 0x0c, 0xf7, 0xf0, 0xf4, 0x09, 0x10, 0x0c, 0xf8, 0xf0, 0xf3, 0x08, 0x10, 0x0d, 0xf8,
+    0xf0, 0xf3, 0x07, 0x0f, 0x0d, 0xf9, 0xf1, 0xf3, 0x06, 0x0f, 0x0d, 0xfa, 0xf1, 0xf2, 0x06, 0x0e,
+    0x0e, 0xfb, 0xf2, 0xf2, 0x05, 0x0e, 0x0e, 0x05, 0xf2, 0xf2, 0xfb, 0x0d, 0x0e, 0x05, 0xf3, 0xf2,
+    0xfa, 0x0d, 0x0e, 0x06, 0xf4, 0xf2, 0xfa, 0x0c, 0x0e, 0x07, 0xf4, 0xf2, 0xf9, 0x0c, 0x0e, 0x07,
+    0xf5, 0xf2, 0xf8, 0x0b, 0x0e, 0x08, 0xf5, 0xf2, 0xf8, 0x0a, 0x0e, 0x08, 0xf6, 0xf2, 0xf7, 0x0a,
+    0x0e, 0x09, 0xf7, 0xf2, 0xf7, 0x09, 0x0e, 0x09, 0xf7, 0xf2, 0xf7, 0x08, 0x0e, 0x0a, 0xf8, 0xf3,
+    0xf6, 0x08, 0x0d, 0x0a, 0xf9, 0xf3, 0xf6, 0x07, 0x0d, 0x0a, 0xfa, 0xf3, 0xf5, 0x06, 0x0d, 0x0b,
+    0xfa, 0xf3, 0xf5, 0x05, 0x0c, 0x0b, 0xfb, 0xf4, 0xf5, 0x05, 0x0c, 0x0b, 0xfc, 0xf4, 0xf5, 0x04,
+    0x0c, 0x0b, 0xfc, 0xf5, 0xf5, 0xfc, 0x0b, 0x0c, 0x04, 0xf5, 0xf4, 0xfb, 0x0b, 0x0c, 0x05, 0xf6,
+    0xf4, 0xfb, 0x0a, 0x0c, 0x05, 0xf6, 0xf4, 0xfa, 0x0a, 0x0c, 0x06, 0xf7, 0xf4, 0xfa, 0x09, 0x0c,
+    0x06, 0xf7, 0xf4, 0xfa, 0x09, 0x0c, 0x07, 0xf8, 0xf4, 0xf9, 0x08, 0x0c, 0x07, 0xf8, 0xf5, 0xf9,
+    0x08, 0x0b, 0x08, 0xf9, 0xf5, 0xf8, 0x07, 0x0b, 0x08, 0xf9, 0xf5, 0xf8, 0x06, 0x0b, 0x08, 0xfa,
+    0xf5, 0xf8, 0x06, 0x0b, 0x08, 0xfa, 0xf5, 0xf7, 0x05, 0x0b, 0x09, 0xfb, 0xf6, 0xf7, 0x05, 0x0a,
+    0x09, 0xfc, 0xf6, 0xf7, 0x04, 0x0a, 0x09, 0xfc, 0xf6, 0xf7, 0x04, 0x0a, 0x09, 0xfd, 0xf7, 0xf7,
+    0xfd, 0x09, 0x09, 0x03, 0xf7, 0xf6, 0xfc, 0x09, 0x0a, 0x04, 0xf7, 0xf6, 0xfc, 0x09, 0x0a, 0x04,
+    0xf8, 0xf6, 0xfc, 0x08, 0x0a, 0x05, 0xf8, 0xf6, 0xfb, 0x08, 0x0a, 0x05, 0xf9, 0xf6, 0xfb, 0x07,
+};
+const SoundClip CLIP_COIN PROGMEM = { CLIP_COIN_DATA, 1120, SAMPLE_PCM8 };
+
+// 1600 muestras (0.20 s), 800 bytes
+const uint8_t CLIP_HIT_DATA[800] PROGMEM = {
+    0x24, 0x4a, 0x76, 0x82, 0x00, 0x01, 0xb1, 0x9f, 0xa0, 0x80, 0x0d, 0x1a, 0xc0, 0x00, 0x0d, 0x2a,
+    0x30, 0x8d, 0x20, 0x5a, 0x92, 0x39, 0x51, 0x00, 0x99, 0x34, 0x41, 0x30, 0xc0, 0xbc, 0x4b, 0x82,
+    0x0e, 0x1a, 0x88, 0xb9, 0x22, 0x9f, 0x00, 0x99, 0x94, 0x29, 0x79, 0x10, 0x28, 0x21, 0xaa, 0x8b,
+    0x87, 0x10, 0x08, 0x49, 0x7b, 0x08, 0x88, 0x00, 0xf8, 0x08, 0x99, 0xb8, 0x10, 0x8f, 0x80, 0x30,
+    0xa2, 0x6b, 0x10, 0x92, 0x81, 0x06, 0x08, 0x92, 0x1a, 0x3b, 0x27, 0x1a, 0x00, 0x8f, 0x08, 0x9a,
+    0x1a, 0x1c, 0xd9, 0x80, 0x2b, 0xda, 0x12, 0xa8, 0x42, 0x23, 0x72, 0x88, 0x31, 0x43, 0x28, 0x0c,
+    0x5a, 0x01, 0xa1, 0xf1, 0x88, 0x90, 0xaa, 0xb2, 0xd3, 0xc1, 0x11, 0xa0, 0x11, 0xf2, 0x08, 0xaa,
+    0x84, 0x40, 0x90, 0x13, 0x78, 0x81, 0x11, 0xa0, 0xa2, 0x7b, 0x98, 0x22, 0xab, 0x19, 0x9f, 0x19,
+    0x29, 0x8c, 0x8e, 0x88, 0x89, 0x19, 0x06, 0x10, 0x81, 0xc8, 0x33, 0x13, 0x16, 0x02, 0x1d, 0x80,
+    0xa8, 0x3b, 0xb4, 0x15, 0x91, 0xbb, 0x1d, 0x01, 0xbc, 0xe8, 0x09, 0xa9, 0xc9, 0xa0, 0xc3, 0xa3,
+    0x24, 0xa4, 0xa4, 0xa0, 0x92, 0x26, 0x02, 0x6a, 0x18, 0x88, 0x12, 0x8a, 0xd0, 0xb9, 0x90, 0x0b,
+    0x9e, 0xd2, 0x0a, 0x8a, 0x52, 0x00, 0x9c, 0x8c, 0x98, 0x68, 0x10, 0x18, 0x01, 0x04, 0xa0, 0x2b,
+    0xa4, 0x07, 0x80, 0x40, 0x92, 0x21, 0xba, 0x4b, 0x1d, 0x0b, 0xf8, 0x08, 0xa9, 0x08, 0x99, 0x13,
+    0x9d, 0xd0, 0x18, 0xba, 0x6b, 0x11, 0xa1, 0x20, 0x02, 0x14, 0x69, 0x20, 0x72, 0x00, 0x19, 0x11,
+    0x93, 0x9b, 0x0f, 0x0a, 0x00, 0x0b, 0x14, 0xf9, 0x98, 0xb0, 0x0b, 0x5b, 0x91, 0xa2, 0xe3, 0x81,
+    0x09, 0xb9, 0x34, 0x07, 0x08, 0x39, 0x82, 0x32, 0x13, 0x26, 0xb1, 0x2a, 0x95, 0xe9, 0x89, 0x90,
+    0x82, 0x8c, 0xf1, 0x80, 0x90, 0x80, 0x0a, 0x31, 0xbd, 0x18, 0x06, 0x18, 0x82, 0xfb, 0x80, 0x20,
+    0x28, 0x92, 0x73, 0x80, 0x11, 0x2a, 0x32, 0x22, 0x8e, 0x90, 0x0f, 0x08, 0x89, 0xb9, 0x1b, 0x0e,
+    0x80, 0x9a, 0xca, 0x0e, 0x08, 0x09, 0x2a, 0xbb, 0x6a, 0x05, 0x91, 0x01, 0x39, 0x1b, 0x2a, 0x64,
+    0x93, 0x98, 0x14, 0x23, 0x9c, 0x69, 0x00, 0x08, 0xf0, 0x89, 0x80, 0x88, 0xba, 0xa4, 0xb2, 0xc1,
+    0x11, 0xbc, 0x49, 0x8d, 0x28, 0xa1, 0x07, 0x00, 0x01, 0xa8, 0x85, 0x21, 0x3a, 0xb4, 0x24, 0x99,
+    0xa9, 0x0e, 0xb2, 0x0c, 0x39, 0xeb, 0x09, 0x98, 0x5b, 0x9a, 0xb1, 0xab, 0x42, 0xc4, 0xb1, 0x32,
+    0x9e, 0x08, 0x32, 0xe3, 0x28, 0x30, 0xbb, 0x62, 0x28, 0x52, 0x81, 0x39, 0x10, 0x34, 0xa9, 0xa6,
+    0x98, 0x30, 0xea, 0x2a, 0x39, 0xbc, 0x0b, 0x4a, 0xc9, 0x0d, 0x91, 0x9a, 0x2a, 0xc0, 0xea, 0x21,
+    0x9b, 0xa2, 0x40, 0x0a, 0x64, 0x10, 0x18, 0x3a, 0x6a, 0x18, 0x04, 0x10, 0x13, 0xea, 0x01, 0x91,
+    0xaa, 0x06, 0x09, 0xd1, 0x80, 0x01, 0xbc, 0x9b, 0x1c, 0xa2, 0x8e, 0xb9, 0x0a, 0x9c, 0x05, 0xa8,
+    0x00, 0x06, 0x01, 0x02, 0x24, 0xa0, 0xca, 0x49, 0x21, 0x06, 0x02, 0xbb, 0xa3, 0xc2, 0x20, 0x24,
+    0xa4, 0x0a, 0xac, 0x0e, 0x09, 0x00, 0x22, 0xec, 0x19, 0x90, 0x9b, 0x0a, 0x4c, 0x10, 0xe2, 0x98,
+    0x99, 0x01, 0xc0, 0xb4, 0x34, 0xa0, 0x02, 0x40, 0x96, 0x82, 0x09, 0x29, 0x26, 0x00, 0x09, 0xca,
+    0x4a, 0x9a, 0x60, 0x08, 0x99, 0x40, 0xb2, 0xca, 0x2a, 0xc0, 0xea, 0x08, 0x99, 0xe1, 0x08, 0x19,
+    0x01, 0x0c, 0x20, 0xc2, 0x9c, 0xa2, 0x4a, 0x60, 0x08, 0x12, 0xa3, 0x02, 0xa4, 0x16, 0x90, 0x19,
+    0x2a, 0x44, 0xb2, 0x02, 0x0c, 0x94, 0x0a, 0x24, 0x14, 0x0e, 0x88, 0xa0, 0x9c, 0x12, 0xea, 0x80,
+    0x90, 0xca, 0x09, 0x4a, 0x21, 0x0a, 0xac, 0x40, 0x4a, 0x09, 0x1c, 0x2a, 0x40, 0x22, 0xa4, 0x04,
+    0x06, 0x10, 0x00, 0x21, 0x42, 0x22, 0xac, 0x40, 0x0a, 0xac, 0x0e, 0x19, 0xa9, 0x62, 0x88, 0x91,
+    0x29, 0x0a, 0x0c, 0xca, 0x02, 0xac, 0x4a, 0xea, 0x00, 0x2a, 0xa0, 0x02, 0x40, 0xa0, 0x0c, 0xca,
+    0x42, 0x22, 0xc0, 0xa0, 0x24, 0xa4, 0x42, 0x20, 0x04, 0x2a, 0xa4, 0x02, 0xa4, 0x4a, 0x22, 0xac,
+    0x42, 0xaa, 0xc0, 0x42, 0xa9, 0x40, 0xc2, 0x0a, 0xca, 0x22, 0xac, 0x0e, 0x08, 0x91, 0xc2, 0xa9,
+    0x42, 0xaa, 0xac, 0xc2, 0x0a, 0x04, 0x04, 0xaa, 0x24, 0xc2, 0x02, 0x0c, 0x00, 0x40, 0x42, 0x21,
+    0x02, 0xa4, 0xc0, 0x22, 0x24, 0x02, 0xa4, 0x4a, 0xca, 0x20, 0x40, 0x22, 0xa4, 0xc0, 0xca, 0x00,
+    0x1c, 0x2a, 0xa4, 0xca, 0xca, 0x29, 0x02, 0x0c, 0x4a, 0x0a, 0x0c, 0xc0, 0x20, 0x40, 0x2a, 0x40,
+    0x02, 0xc0, 0x2a, 0x2c, 0x0a, 0xa4, 0x40, 0x0a, 0x40, 0x02, 0x24, 0x0a, 0x40, 0x0a, 0x24, 0x02,
+    0xa4, 0x04, 0xa2, 0x2c, 0x40, 0x02, 0x00, 0xac, 0x02, 0x0c, 0xc2, 0xaa, 0xa4, 0x4a, 0x0a, 0x0c,
+    0x4a, 0x2a, 0xc0, 0xaa, 0x00, 0x00, 0xc0, 0x02, 0x0c, 0x42, 0x00, 0xac, 0x02, 0x00, 0x40, 0xaa,
+    0xa4, 0x02, 0x0c, 0x4a, 0x42, 0x20, 0x0a, 0x04, 0x0a, 0x24, 0x40, 0x22, 0xc0, 0x00, 0xc0, 0x00,
+    0xc0, 0x02, 0xa4, 0x42, 0xa0, 0xa4, 0x02, 0xa4, 0xc2, 0xc0, 0xa0, 0x0a, 0x00, 0x40, 0xaa, 0x04,
+    0xc0, 0xa0, 0x2c, 0xca, 0x02, 0x04, 0xc2, 0x0a, 0x00, 0x0c, 0x0a, 0x40, 0x02, 0xa4, 0x0a, 0x04,
+    0x02, 0x00, 0x40, 0x20, 0xc0, 0x02, 0x0c, 0x0a, 0x04, 0x40, 0x00, 0x04, 0xc2, 0x02, 0x0c, 0x00,
+    0x40, 0x0a, 0x04, 0x40, 0xa2, 0xc0, 0x20, 0x0c, 0x00, 0xa4, 0x40, 0x00, 0x0c, 0x00, 0xa4, 0xc0,
+    0x00, 0x04, 0x00, 0x0c, 0x0a, 0xa4, 0x0a, 0x00, 0x0c, 0x40, 0xaa, 0x04, 0x0a, 0x04, 0x40, 0xa0,
+    0xc0, 0x00, 0x04, 0xc2, 0x20, 0x0c, 0x00, 0xa4, 0x02, 0x40, 0x00, 0xc0, 0x02, 0x0c, 0x40, 0x2a,
+};
+const SoundClip CLIP_HIT PROGMEM = { CLIP_HIT_DATA, 1600, SAMPLE_ADPCM4 };
+
+// 6000 muestras (0.75 s), 3000 bytes
+const uint8_t CLIP_GAMEOVER_DATA[3000] PROGMEM = {
+    0x40, 0x22, 0x04, 0xc0, 0xae, 0x89, 0x19, 0x63, 0x14, 0x10, 0x88, 0xac, 0x9f, 0x08, 0x08, 0x31,
+    0x17, 0x00, 0x88, 0xb9, 0x9f, 0x88, 0x18, 0x31, 0x27, 0x00, 0x88, 0xba, 0xaf, 0x89, 0x18, 0x42,
+    0x17, 0x11, 0x88, 0xcb, 0xaf, 0x89, 0x08, 0x53, 0x17, 0x01, 0x80, 0xdb, 0x9f, 0x99, 0x00, 0x52,
+    0x17, 0x11, 0x80, 0xcb, 0xfb, 0x9b, 0x08, 0x31, 0x75, 0x11, 0x80, 0xb9, 0xfc, 0x8b, 0x89, 0x31,
+    0x74, 0x13, 0x00, 0xb8, 0xfc, 0x9b, 0x98, 0x21, 0x34, 0x37, 0x01, 0x98, 0xdb, 0x9f, 0x89, 0x00,
+    0x53, 0x17, 0x01, 0x80, 0xda, 0xfa, 0x99, 0x88, 0x32, 0x75, 0x01, 0x01, 0xaa, 0xfd, 0x99, 0x88,
+    0x30, 0x74, 0x03, 0x11, 0xa8, 0xbc, 0xbf, 0x89, 0x18, 0x43, 0x37, 0x10, 0x80, 0xda, 0xfa, 0x99,
+    0x88, 0x41, 0x72, 0x12, 0x01, 0xb9, 0xfc, 0x8b, 0x89, 0x10, 0x34, 0x37, 0x01, 0x90, 0xcb, 0xbf,
+    0x98, 0x08, 0x42, 0x73, 0x13, 0x00, 0xc9, 0xfa, 0x9a, 0x89, 0x20, 0x34, 0x37, 0x01, 0xa0, 0xda,
+    0x9f, 0x89, 0x08, 0x52, 0x72, 0x11, 0x00, 0xb9, 0xfc, 0x8b, 0x89, 0x20, 0x34, 0x37, 0x01, 0x90,
+    0xcb, 0xbf, 0x98, 0x88, 0x42, 0x73, 0x13, 0x00, 0xb8, 0xbc, 0xbf, 0x89, 0x10, 0x53, 0x17, 0x01,
+    0x80, 0xca, 0xfb, 0x9b, 0x88, 0x21, 0x75, 0x11, 0x10, 0xa8, 0xfb, 0x9c, 0x98, 0x08, 0x42, 0x73,
+    0x13, 0x00, 0xb9, 0xfc, 0x9a, 0x8a, 0x20, 0x63, 0x15, 0x11, 0x90, 0xc9, 0xfb, 0x9b, 0x88, 0x20,
+    0x34, 0x37, 0x01, 0x90, 0xcb, 0xaf, 0xa9, 0x08, 0x32, 0x56, 0x11, 0x01, 0xa8, 0xbc, 0xbf, 0x89,
+    0x08, 0x32, 0x47, 0x01, 0x01, 0xa9, 0xbc, 0xbf, 0x89, 0x00, 0x42, 0x73, 0x13, 0x80, 0xb8, 0xfc,
+    0xaa, 0x98, 0x10, 0x24, 0x37, 0x11, 0x00, 0xba, 0xde, 0x99, 0x89, 0x20, 0x63, 0x15, 0x11, 0x80,
+    0xca, 0xfa, 0x9b, 0x89, 0x20, 0x73, 0x14, 0x10, 0x80, 0xc9, 0xfb, 0x9b, 0x88, 0x28, 0x73, 0x14,
+    0x10, 0x80, 0xc9, 0xfa, 0x9b, 0x89, 0x20, 0x63, 0x15, 0x01, 0x81, 0xba, 0xde, 0x99, 0x98, 0x10,
+    0x24, 0x37, 0x11, 0x00, 0xba, 0xfd, 0x8a, 0x99, 0x00, 0x63, 0x71, 0x01, 0x00, 0xa8, 0xbc, 0xbf,
+    0x89, 0x18, 0x32, 0x47, 0x01, 0x01, 0x99, 0xbc, 0xbf, 0x89, 0x08, 0x31, 0x56, 0x11, 0x10, 0x98,
+    0xdb, 0xfa, 0x9a, 0x88, 0x21, 0x73, 0x04, 0x11, 0x80, 0xbb, 0xde, 0x99, 0x88, 0x10, 0x63, 0x15,
+    0x01, 0x81, 0xa9, 0x9e, 0x9f, 0x88, 0x08, 0x32, 0x47, 0x10, 0x01, 0x98, 0xeb, 0x9d, 0x89, 0x09,
+    0x30, 0x16, 0x07, 0x11, 0x90, 0xc9, 0xfb, 0x9b, 0x88, 0x10, 0x62, 0x15, 0x11, 0x00, 0xa9, 0xad,
+    0xaf, 0x99, 0x08, 0x32, 0x75, 0x02, 0x11, 0x98, 0xda, 0xfa, 0x9a, 0x98, 0x20, 0x63, 0x15, 0x01,
+    0x01, 0xb9, 0xad, 0xaf, 0x89, 0x09, 0x32, 0x75, 0x21, 0x10, 0x90, 0xcb, 0xfc, 0x99, 0x89, 0x10,
+    0x62, 0x71, 0x10, 0x81, 0x98, 0xeb, 0x9d, 0x89, 0x09, 0x21, 0x25, 0x27, 0x01, 0x81, 0xba, 0xad,
+    0xaf, 0x89, 0x08, 0x42, 0x72, 0x13, 0x10, 0x88, 0xdb, 0xfa, 0x9a, 0x98, 0x10, 0x63, 0x71, 0x10,
+    0x01, 0x99, 0xeb, 0x9d, 0x98, 0x89, 0x11, 0x25, 0x27, 0x11, 0x00, 0xb9, 0xcc, 0x9f, 0x99, 0x08,
+    0x30, 0x25, 0x27, 0x01, 0x00, 0xb9, 0xad, 0xaf, 0x89, 0x08, 0x21, 0x16, 0x07, 0x11, 0x08, 0xba,
+    0xfd, 0x99, 0x99, 0x08, 0x42, 0x73, 0x13, 0x01, 0x91, 0xd9, 0xfa, 0x9a, 0x89, 0x08, 0x52, 0x72,
+    0x12, 0x10, 0x80, 0xca, 0xfb, 0x9b, 0x99, 0x00, 0x51, 0x72, 0x12, 0x01, 0x80, 0xca, 0xfb, 0x9b,
+    0x99, 0x18, 0x41, 0x43, 0x27, 0x01, 0x80, 0xa9, 0x9e, 0x9e, 0x98, 0x08, 0x30, 0x25, 0x27, 0x01,
+    0x00, 0xa9, 0xad, 0xaf, 0x89, 0x09, 0x20, 0x25, 0x27, 0x01, 0x01, 0x99, 0x9d, 0xaf, 0x99, 0x89,
+    0x20, 0x34, 0x74, 0x12, 0x00, 0xa0, 0xda, 0xfa, 0x9a, 0x88, 0x08, 0x43, 0x73, 0x13, 0x01, 0x80,
+    0xba, 0x9f, 0x8d, 0x89, 0x09, 0x31, 0x34, 0x37, 0x11, 0x00, 0xa9, 0xbc, 0xbf, 0x99, 0x98, 0x20,
+    0x73, 0x51, 0x10, 0x10, 0x88, 0xda, 0xf9, 0x9a, 0x89, 0x19, 0x31, 0x17, 0x05, 0x01, 0x81, 0xa8,
+    0xad, 0xaf, 0x89, 0x89, 0x20, 0x73, 0x41, 0x11, 0x00, 0x90, 0xd9, 0xf9, 0x9a, 0x99, 0x08, 0x32,
+    0x16, 0x17, 0x11, 0x00, 0x98, 0xbc, 0xfc, 0x9a, 0x88, 0x18, 0x42, 0x73, 0x13, 0x01, 0x00, 0xba,
+    0x9e, 0x9f, 0x99, 0x88, 0x10, 0x34, 0x74, 0x02, 0x01, 0x80, 0xca, 0xcb, 0xaf, 0x98, 0x08, 0x20,
+    0x34, 0x37, 0x11, 0x00, 0x90, 0xac, 0xfc, 0x9a, 0x98, 0x08, 0x41, 0x42, 0x27, 0x01, 0x01, 0x99,
+    0xeb, 0xf9, 0x99, 0x89, 0x08, 0x41, 0x33, 0x37, 0x11, 0x00, 0x98, 0xbc, 0xfb, 0x9b, 0x89, 0x08,
+    0x41, 0x33, 0x37, 0x11, 0x00, 0x98, 0xbc, 0xfb, 0x9b, 0x89, 0x08, 0x41, 0x42, 0x27, 0x01, 0x01,
+    0x99, 0xeb, 0xf9, 0x99, 0x89, 0x08, 0x40, 0x42, 0x27, 0x01, 0x01, 0x98, 0xdb, 0xfa, 0x8b, 0x99,
+    0x08, 0x30, 0x25, 0x73, 0x03, 0x01, 0x80, 0xc9, 0xbb, 0xbf, 0x99, 0x88, 0x10, 0x63, 0x71, 0x11,
+    0x01, 0x00, 0xb9, 0xad, 0xfb, 0x8b, 0x89, 0x18, 0x41, 0x42, 0x27, 0x10, 0x01, 0x99, 0xdb, 0xfa,
+    0x8b, 0x89, 0x09, 0x30, 0x25, 0x73, 0x03, 0x01, 0x00, 0xba, 0x9e, 0x9f, 0x89, 0x89, 0x08, 0x53,
+    0x32, 0x37, 0x10, 0x00, 0xa0, 0xdb, 0xfa, 0x9a, 0x99, 0x88, 0x30, 0x25, 0x73, 0x03, 0x01, 0x81,
+    0xb9, 0xad, 0xfb, 0x8b, 0x89, 0x08, 0x41, 0x42, 0x27, 0x10, 0x01, 0x90, 0xca, 0xdb, 0x9f, 0x89,
+    0x89, 0x00, 0x53, 0x32, 0x37, 0x10, 0x00, 0x88, 0xeb, 0x99, 0xaf, 0x98, 0x88, 0x18, 0x63, 0x71,
+    0x11, 0x10, 0x01, 0xb8, 0xfb, 0xe9, 0x98, 0x99, 0x88, 0x20, 0x34, 0x75, 0x11, 0x10, 0x00, 0xa8,
+    0xbc, 0xfc, 0x9a, 0x99, 0x88, 0x30, 0x34, 0x74, 0x12, 0x11, 0x00, 0xb8, 0xfb, 0xe9, 0x98, 0x99,
+    0x88, 0x20, 0x24, 0x75, 0x11, 0x10, 0x01, 0xa8, 0xeb, 0xa9, 0xaf, 0x99, 0x88, 0x00, 0x43, 0x53,
+    0x17, 0x01, 0x10, 0x90, 0xca, 0xdb, 0x9f, 0x89, 0x89, 0x08, 0x42, 0x43, 0x27, 0x11, 0x01, 0x00,
+    0xca, 0xca, 0xfb, 0x8b, 0x89, 0x88, 0x20, 0x34, 0x74, 0x12, 0x01, 0x01, 0x98, 0xac, 0x9d, 0xaf,
+    0x98, 0x98, 0x10, 0x42, 0x52, 0x17, 0x01, 0x01, 0x00, 0xca, 0xca, 0xfb, 0x8b, 0x89, 0x88, 0x20,
+    0x34, 0x74, 0x12, 0x01, 0x01, 0xa0, 0xda, 0xbb, 0xbf, 0x89, 0x89, 0x08, 0x41, 0x42, 0x73, 0x03,
+    0x01, 0x00, 0xa8, 0xac, 0xbc, 0xbf, 0x88, 0x89, 0x08, 0x43, 0x52, 0x17, 0x10, 0x11, 0x80, 0xa9,
+    0xad, 0xfb, 0x9b, 0x98, 0x89, 0x00, 0x53, 0x32, 0x37, 0x01, 0x11, 0x00, 0xaa, 0xad, 0xfb, 0x9b,
+    0x98, 0x89, 0x00, 0x53, 0x32, 0x37, 0x01, 0x11, 0x00, 0xaa, 0xcc, 0xfa, 0x8b, 0x99, 0x98, 0x00,
+    0x43, 0x63, 0x71, 0x01, 0x01, 0x81, 0xa8, 0xdb, 0xca, 0x9f, 0x99, 0x98, 0x08, 0x22, 0x25, 0x73,
+    0x13, 0x10, 0x01, 0x98, 0xda, 0xba, 0xfc, 0x9a, 0x98, 0x08, 0x20, 0x53, 0x32, 0x37, 0x01, 0x01,
+    0x00, 0xaa, 0xad, 0xfb, 0x9b, 0x98, 0x89, 0x18, 0x32, 0x17, 0x71, 0x02, 0x01, 0x01, 0x98, 0xca,
+    0xac, 0xfb, 0x8b, 0x99, 0x08, 0x10, 0x52, 0x32, 0x37, 0x01, 0x01, 0x81, 0xa9, 0xfb, 0x99, 0x9f,
+    0x99, 0x88, 0x09, 0x21, 0x34, 0x25, 0x27, 0x00, 0x01, 0x00, 0xb9, 0xfb, 0x99, 0x9f, 0x98, 0x88,
+    0x09, 0x21, 0x34, 0x34, 0x27, 0x01, 0x00, 0x00, 0xa9, 0xbc, 0xac, 0xaf, 0x98, 0x88, 0x09, 0x21,
+    0x73, 0x10, 0x17, 0x00, 0x10, 0x80, 0xa8, 0xdb, 0xba, 0xaf, 0x98, 0x88, 0x88, 0x20, 0x52, 0x32,
+    0x27, 0x00, 0x01, 0x00, 0xa8, 0xd9, 0xaa, 0xfc, 0x89, 0x88, 0x09, 0x18, 0x31, 0x15, 0x73, 0x02,
+    0x00, 0x00, 0x88, 0xa9, 0x9d, 0xfb, 0x99, 0x88, 0x88, 0x08, 0x11, 0x24, 0x53, 0x17, 0x00, 0x18,
+    0x80, 0x98, 0xd9, 0xa9, 0xfa, 0x8a, 0x88, 0x88, 0x00, 0x31, 0x25, 0x72, 0x11, 0x00, 0x00, 0x81,
+    0xa9, 0xeb, 0xa9, 0x9f, 0x80, 0x09, 0x09, 0x00, 0x31, 0x24, 0x74, 0x10, 0x08, 0x00, 0x00, 0x89,
+    0xcb, 0xba, 0xbf, 0x88, 0x98, 0x88, 0x21, 0x62, 0x11, 0x72, 0x01, 0x01, 0x00, 0x80, 0xb9, 0xcb,
+    0xdb, 0x8f, 0x08, 0x88, 0x88, 0x00, 0x10, 0x43, 0x33, 0x27, 0x00, 0x10, 0x90, 0x99, 0xea, 0x99,
+    0xfa, 0x89, 0x88, 0x80, 0x18, 0x11, 0x62, 0x01, 0x07, 0x00, 0x00, 0x08, 0x08, 0x9a, 0xea, 0x98,
+    0x8f, 0x80, 0x88, 0x80, 0x00, 0x11, 0x42, 0x62, 0x02, 0x00, 0x01, 0x00, 0xc0, 0xaa, 0xac, 0xca,
+    0x8e, 0x88, 0x09, 0x00, 0x02, 0x04, 0x42, 0x60, 0x00, 0x09, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+    0x40, 0x22, 0x24, 0x14, 0x22, 0x00, 0xac, 0xca, 0xce, 0x88, 0x89, 0x99, 0x0a, 0x42, 0x42, 0x53,
+    0x07, 0x00, 0x01, 0x00, 0x80, 0xa9, 0xeb, 0xa9, 0x9f, 0x98, 0x88, 0x89, 0x00, 0x40, 0x32, 0x25,
+    0x27, 0x00, 0x11, 0x00, 0x91, 0xc9, 0xca, 0xdb, 0x9f, 0x89, 0x89, 0x89, 0x18, 0x51, 0x32, 0x24,
+    0x37, 0x10, 0x10, 0x01, 0x90, 0xd9, 0xb9, 0x9d, 0xaf, 0x98, 0x99, 0x98, 0x00, 0x31, 0x17, 0x21,
+    0x72, 0x03, 0x01, 0x10, 0x80, 0xa8, 0xad, 0xcb, 0xfa, 0x8b, 0x89, 0x99, 0x08, 0x20, 0x15, 0x53,
+    0x71, 0x02, 0x11, 0x10, 0x01, 0xa8, 0xfb, 0x99, 0xaa, 0xbf, 0x88, 0x99, 0x88, 0x18, 0x42, 0x53,
+    0x22, 0x37, 0x10, 0x10, 0x10, 0x90, 0xc9, 0xcb, 0xcb, 0xfb, 0x8b, 0x98, 0x98, 0x08, 0x21, 0x15,
+    0x53, 0x71, 0x02, 0x11, 0x10, 0x00, 0x98, 0xbc, 0xbc, 0xbc, 0xbf, 0x88, 0x89, 0x89, 0x10, 0x51,
+    0x32, 0x24, 0x37, 0x10, 0x10, 0x01, 0x80, 0xd9, 0xb9, 0xac, 0xfb, 0x9b, 0x88, 0x99, 0x08, 0x20,
+    0x34, 0x34, 0x74, 0x12, 0x10, 0x11, 0x10, 0x98, 0xeb, 0xa9, 0xdb, 0x9f, 0x89, 0x99, 0x98, 0x00,
+    0x40, 0x33, 0x17, 0x71, 0x01, 0x11, 0x10, 0x00, 0x98, 0x9d, 0xcb, 0xca, 0xaf, 0x88, 0x99, 0x88,
+    0x08, 0x51, 0x31, 0x24, 0x74, 0x02, 0x01, 0x10, 0x00, 0xa9, 0xbc, 0xbc, 0xfd, 0x99, 0x98, 0x98,
+    0x89, 0x18, 0x63, 0x21, 0x53, 0x17, 0x01, 0x01, 0x11, 0x80, 0xc8, 0xca, 0xcb, 0xfa, 0x8b, 0x98,
+    0x99, 0x88, 0x00, 0x73, 0x20, 0x21, 0x37, 0x10, 0x10, 0x01, 0x00, 0xb9, 0x9e, 0xba, 0xfd, 0x99,
+    0x98, 0x98, 0x89, 0x00, 0x24, 0x73, 0x01, 0x17, 0x01, 0x11, 0x01, 0x81, 0xb9, 0xad, 0xac, 0xfb,
+    0x8b, 0x99, 0x98, 0x89, 0x08, 0x63, 0x21, 0x43, 0x72, 0x03, 0x10, 0x10, 0x00, 0x98, 0xac, 0xbc,
+    0xac, 0xbf, 0x88, 0x99, 0x98, 0x00, 0x40, 0x42, 0x43, 0x72, 0x03, 0x10, 0x11, 0x00, 0x88, 0xac,
+    0xfb, 0x89, 0x9f, 0x89, 0x99, 0x89, 0x09, 0x30, 0x16, 0x32, 0x24, 0x37, 0x00, 0x01, 0x01, 0x00,
+    0xd9, 0xb9, 0xdb, 0xfa, 0x9a, 0x88, 0x99, 0x98, 0x00, 0x63, 0x21, 0x43, 0x72, 0x03, 0x10, 0x10,
+    0x00, 0x98, 0xac, 0xbc, 0xac, 0xbf, 0x88, 0x99, 0x98, 0x08, 0x30, 0x16, 0x32, 0x24, 0x37, 0x00,
+    0x01, 0x01, 0x80, 0xc9, 0xca, 0xcb, 0xfa, 0x8b, 0x98, 0x89, 0x89, 0x00, 0x53, 0x42, 0x32, 0x74,
+    0x12, 0x00, 0x11, 0x00, 0x98, 0xfb, 0xa8, 0xa9, 0xbf, 0x88, 0x99, 0x89, 0x09, 0x20, 0x34, 0x25,
+    0x43, 0x27, 0x01, 0x01, 0x01, 0x01, 0xb9, 0xad, 0xcb, 0xdb, 0x9f, 0x89, 0x98, 0x89, 0x88, 0x31,
+    0x25, 0x53, 0x22, 0x37, 0x00, 0x01, 0x01, 0x80, 0xc8, 0xba, 0x8f, 0xa9, 0xaf, 0x88, 0x89, 0x89,
+    0x08, 0x31, 0x16, 0x32, 0x74, 0x12, 0x00, 0x11, 0x11, 0x80, 0xcb, 0xea, 0xa9, 0xfa, 0x8b, 0x98,
+    0x98, 0x99, 0x00, 0x51, 0x22, 0x34, 0x74, 0x12, 0x10, 0x10, 0x01, 0x00, 0xcb, 0xea, 0x99, 0xbb,
+    0xbf, 0x88, 0x99, 0x88, 0x09, 0x31, 0x16, 0x32, 0x24, 0x37, 0x00, 0x10, 0x01, 0x00, 0xb9, 0xad,
+    0xdb, 0xaa, 0xaf, 0x89, 0x89, 0x99, 0x08, 0x30, 0x25, 0x43, 0x43, 0x27, 0x01, 0x10, 0x01, 0x01,
+    0xa9, 0xbc, 0xad, 0xcb, 0xaf, 0x98, 0x89, 0x99, 0x88, 0x10, 0x34, 0x25, 0x33, 0x75, 0x02, 0x10,
+    0x10, 0x10, 0x90, 0xdb, 0xba, 0xbc, 0xfc, 0x9a, 0x88, 0x99, 0x98, 0x00, 0x42, 0x62, 0x21, 0x71,
+    0x03, 0x10, 0x11, 0x10, 0x80, 0xc9, 0xda, 0xba, 0xdb, 0xaf, 0x88, 0x99, 0x98, 0x88, 0x30, 0x24,
+    0x16, 0x12, 0x37, 0x00, 0x11, 0x01, 0x01, 0x98, 0xac, 0x9d, 0xcb, 0xfa, 0x8b, 0x98, 0x98, 0x89,
+    0x08, 0x42, 0x52, 0x32, 0x53, 0x27, 0x00, 0x01, 0x11, 0x00, 0xa9, 0xbc, 0xad, 0xbb, 0xcf, 0x98,
+    0x88, 0x89, 0x09, 0x18, 0x52, 0x32, 0x34, 0x74, 0x02, 0x01, 0x11, 0x01, 0x00, 0xba, 0x9f, 0x99,
+    0xdb, 0x9f, 0x98, 0x98, 0x99, 0x88, 0x20, 0x73, 0x11, 0x32, 0x73, 0x04, 0x10, 0x10, 0x00, 0x80,
+    0xb9, 0xad, 0xcb, 0xcb, 0xaf, 0x98, 0x98, 0x89, 0x89, 0x20, 0x73, 0x11, 0x32, 0x74, 0x02, 0x01,
+    0x11, 0x00, 0x00, 0xbb, 0x9f, 0xa9, 0xbb, 0xcf, 0x88, 0x89, 0x89, 0x88, 0x10, 0x43, 0x63, 0x11,
+    0x73, 0x12, 0x10, 0x10, 0x01, 0x00, 0xba, 0x9e, 0xbb, 0xbc, 0xbf, 0x88, 0x99, 0x89, 0x89, 0x18,
+    0x24, 0x15, 0x33, 0x75, 0x02, 0x10, 0x11, 0x10, 0x00, 0xb9, 0xad, 0xeb, 0xa9, 0xf9, 0x8b, 0x98,
+    0x98, 0x98, 0x00, 0x41, 0x52, 0x31, 0x24, 0x27, 0x01, 0x01, 0x11, 0x01, 0xa0, 0xeb, 0xa9, 0xcb,
+    0xcb, 0xaf, 0x98, 0x98, 0x89, 0x88, 0x20, 0x73, 0x11, 0x31, 0x74, 0x02, 0x01, 0x11, 0x01, 0x00,
+    0xc9, 0xca, 0xca, 0xcb, 0xfa, 0x9a, 0x88, 0x99, 0x98, 0x08, 0x51, 0x31, 0x63, 0x21, 0x27, 0x10,
+    0x10, 0x01, 0x11, 0xa0, 0xcb, 0xac, 0xbc, 0xdb, 0xaf, 0x88, 0x89, 0x89, 0x89, 0x18, 0x24, 0x24,
+    0x34, 0x53, 0x27, 0x00, 0x01, 0x01, 0x01, 0xa8, 0xeb, 0xa9, 0xcb, 0xcb, 0xaf, 0x98, 0x98, 0x98,
+    0x88, 0x10, 0x24, 0x15, 0x33, 0x75, 0x02, 0x10, 0x10, 0x11, 0x00, 0xa0, 0xcc, 0xba, 0x9e, 0xfa,
+    0x8a, 0x89, 0x99, 0x98, 0x89, 0x21, 0x44, 0x32, 0x16, 0x72, 0x02, 0x01, 0x11, 0x10, 0x01, 0xa9,
+    0xbc, 0x8f, 0xa9, 0xba, 0xbf, 0x88, 0x98, 0x89, 0x89, 0x10, 0x63, 0x21, 0x43, 0x43, 0x27, 0x10,
+    0x00, 0x11, 0x01, 0x98, 0xeb, 0xa9, 0xcb, 0xbb, 0xcf, 0x88, 0x89, 0x98, 0x88, 0x08, 0x42, 0x52,
+    0x31, 0x53, 0x27, 0x00, 0x10, 0x11, 0x01, 0x00, 0xca, 0xeb, 0xa9, 0xca, 0xfa, 0x9a, 0x88, 0x99,
+    0x98, 0x08, 0x31, 0x25, 0x62, 0x11, 0x72, 0x12, 0x10, 0x10, 0x11, 0x00, 0xa9, 0xbc, 0x9e, 0xaa,
+    0xac, 0xaf, 0x89, 0x98, 0x89, 0x89, 0x10, 0x43, 0x24, 0x63, 0x21, 0x27, 0x00, 0x11, 0x01, 0x11,
+    0x90, 0xba, 0xae, 0xca, 0xca, 0xfa, 0x9a, 0x88, 0x99, 0xa8, 0x08, 0x20, 0x34, 0x16, 0x22, 0x53,
+    0x27, 0x00, 0x10, 0x01, 0x01, 0x90, 0xcb, 0xeb, 0xa9, 0xca, 0xf9, 0x8b, 0x88, 0x89, 0x99, 0x08,
+    0x21, 0x44, 0x32, 0x16, 0x71, 0x02, 0x01, 0x11, 0x11, 0x10, 0xa0, 0xea, 0xaa, 0xdb, 0xba, 0xfb,
+    0x8c, 0x88, 0x89, 0x88, 0x09, 0x10, 0x24, 0x15, 0x33, 0x34, 0x37, 0x00, 0x10, 0x01, 0x01, 0x90,
+    0xcb, 0xeb, 0x99, 0xbb, 0xfd, 0x8a, 0x88, 0x99, 0x98, 0x88, 0x21, 0x34, 0x25, 0x33, 0x07, 0x07,
+    0x01, 0x01, 0x01, 0x02, 0x00, 0xba, 0xae, 0xba, 0xad, 0xfb, 0x8b, 0x88, 0x99, 0x99, 0x89, 0x19,
+    0x63, 0x21, 0x63, 0x11, 0x72, 0x12, 0x00, 0x11, 0x10, 0x01, 0xa9, 0xeb, 0xaa, 0xdb, 0xba, 0xbf,
+    0x88, 0x98, 0x99, 0x89, 0x09, 0x31, 0x16, 0x32, 0x25, 0x33, 0x47, 0x00, 0x10, 0x00, 0x01, 0x00,
+    0xb9, 0xad, 0xda, 0xaa, 0xdb, 0xaf, 0x90, 0x98, 0x89, 0x89, 0x18, 0x32, 0x26, 0x32, 0x25, 0x73,
+    0x03, 0x00, 0x11, 0x11, 0x10, 0x90, 0xea, 0xa9, 0xdb, 0xb9, 0xfc, 0x8a, 0x98, 0x89, 0x99, 0x89,
+    0x19, 0x43, 0x24, 0x15, 0x33, 0x74, 0x12, 0x00, 0x11, 0x11, 0x00, 0x91, 0xcb, 0xac, 0x9d, 0xbb,
+    0xfc, 0x9a, 0x88, 0x99, 0xa8, 0x98, 0x10, 0x62, 0x21, 0x62, 0x11, 0x72, 0x12, 0x00, 0x11, 0x20,
+    0x00, 0x01, 0xca, 0xfb, 0xa8, 0xa9, 0x9c, 0xaf, 0x89, 0x98, 0x89, 0x89, 0x98, 0x32, 0x16, 0x32,
+    0x25, 0x42, 0x27, 0x00, 0x01, 0x11, 0x01, 0x10, 0xb9, 0xcc, 0xda, 0xb9, 0xca, 0xaf, 0x89, 0x98,
+    0x99, 0x89, 0x99, 0x11, 0x34, 0x16, 0x32, 0x63, 0x71, 0x02, 0x00, 0x01, 0x11, 0x10, 0x90, 0xea,
+    0xa9, 0xda, 0xaa, 0xfb, 0x8c, 0x88, 0x89, 0x89, 0x99, 0x08, 0x22, 0x16, 0x32, 0x15, 0x33, 0x47,
+    0x00, 0x10, 0x10, 0x10, 0x00, 0x99, 0xeb, 0xa9, 0xdb, 0xaa, 0xfb, 0x8c, 0x88, 0x98, 0x89, 0x89,
+    0x18, 0x31, 0x16, 0x32, 0x25, 0x32, 0x47, 0x00, 0x00, 0x11, 0x10, 0x00, 0x99, 0xeb, 0xa9, 0xdb,
+    0xaa, 0xfb, 0x8c, 0x88, 0x98, 0x89, 0x89, 0x18, 0x31, 0x16, 0x32, 0x15, 0x33, 0x47, 0x00, 0x00,
+    0x11, 0x10, 0x00, 0xa1, 0xea, 0xa9, 0xdb, 0xb9, 0xfb, 0x8c, 0x88, 0x98, 0x89, 0x99, 0x08, 0x21,
+    0x16, 0x22, 0x15, 0x33, 0x73, 0x05, 0x10, 0x10, 0x00, 0x01, 0x00, 0xb9, 0x9e, 0xba, 0x9d, 0xbb,
+    0xcf, 0x88, 0x88, 0x99, 0x98, 0x88, 0x19, 0x62, 0x21, 0x52, 0x31, 0x42, 0x27, 0x01, 0x00, 0x11,
+    0x11, 0x10, 0xa1, 0xbc, 0xad, 0xda, 0xb9, 0xfb, 0x8c, 0x88, 0x98, 0x89, 0x99, 0x98, 0x11, 0x34,
+    0x16, 0x22, 0x53, 0x72, 0x02, 0x01, 0x11, 0x20, 0x01, 0x02, 0xa9, 0x9e, 0xda, 0xa9, 0xbb, 0xfe,
+    0x89, 0x98, 0x98, 0x99, 0x89, 0x0a, 0x21, 0x16, 0x52, 0x21, 0x42, 0x72, 0x03, 0x00, 0x11, 0x20,
+    0x01, 0x02, 0xa9, 0x9e, 0xca, 0xba, 0x9d, 0xfb, 0x0b, 0x89, 0x99, 0x99, 0x99, 0x99, 0x20, 0x16,
+    0x32, 0x16, 0x31, 0x42, 0x27, 0x10, 0x10, 0x10, 0x11, 0x11, 0x90, 0xea, 0x9a, 0x9d, 0xaa, 0xac,
+    0xbf, 0x88, 0x98, 0x98, 0x8a, 0xa9, 0x10, 0x62, 0x21, 0x63, 0x11, 0x32, 0x74, 0x02, 0x01, 0x01,
+    0x11, 0x11, 0x01, 0xa9, 0xae, 0xc9, 0xba, 0x9d, 0xfb, 0x9a, 0x88, 0x99, 0x99, 0x99, 0xa9, 0x20,
+    0x16, 0x31, 0x16, 0x21, 0x33, 0x57, 0x00, 0x01, 0x10, 0x11, 0x00, 0x11, 0xaa, 0xae, 0xd9, 0xa9,
+    0xba, 0xfe, 0x89, 0x88, 0x99, 0x99, 0x99, 0xa9, 0x20, 0x16, 0x41, 0x22, 0x15, 0x23, 0x47, 0x00,
+    0x00, 0x01, 0x11, 0x10, 0x01, 0xa9, 0xae, 0xc9, 0xba, 0x9d, 0xab, 0xcf, 0x88, 0x88, 0x98, 0x98,
+    0x89, 0x10, 0x22, 0x26, 0x42, 0x32, 0x15, 0x73, 0x12, 0x00, 0x11, 0x10, 0x11, 0x21, 0xa0, 0x9e,
+    0xc9, 0xaa, 0x9d, 0xba, 0xcf, 0x88, 0x88, 0x89, 0x99, 0x89, 0x99, 0x21, 0x16, 0x32, 0x25, 0x32,
+    0x25, 0x27, 0x10, 0x00, 0x11, 0x11, 0x11, 0x02, 0xca, 0xcb, 0xac, 0xac, 0xdb, 0xb9, 0xaf, 0x89,
+    0x98, 0x98, 0x99, 0x99, 0x0a, 0x42, 0x63, 0x21, 0x52, 0x21, 0x33, 0x57, 0x00, 0x10, 0x10, 0x10,
+    0x01, 0x11, 0xa9, 0xae, 0xb9, 0x9e, 0xa9, 0xca, 0xaf, 0x98, 0x88, 0x99, 0x99, 0x99, 0x0a, 0x42,
+    0x62, 0x21, 0x42, 0x32, 0x15, 0x27, 0x10, 0x10, 0x10, 0x02, 0x21, 0x02, 0xaa, 0xec, 0xa9, 0xd9,
+    0xa9, 0xbb, 0xfd, 0x8a, 0x88, 0x89, 0x99, 0x99, 0xa9, 0x20, 0x34, 0x34, 0x16, 0x22, 0x53, 0x71,
+    0x02, 0x01, 0x10, 0x11, 0x02, 0x22, 0x00, 0xac, 0xbc, 0xad, 0xca, 0xba, 0x9d, 0xaf, 0x98, 0x88,
+    0x99, 0xa9, 0xa8, 0x09, 0x22, 0x64, 0x21, 0x41, 0x32, 0x15, 0x73, 0x12, 0x00, 0x10, 0x11, 0x11,
+    0x21, 0xa0, 0xca, 0x9e, 0xa9, 0x9d, 0xaa, 0xdb, 0xaf, 0x88, 0x98, 0x98, 0x8a, 0xa9, 0x0a, 0x40,
+    0x42, 0x43, 0x63, 0x11, 0x22, 0x73, 0x05, 0x00, 0x01, 0x01, 0x11, 0x11, 0x01, 0xca, 0xea, 0x99,
+    0xbb, 0x8f, 0x99, 0xf9, 0x8a, 0x89, 0x98, 0xa8, 0x99, 0xa9, 0x20, 0x42, 0x16, 0x21, 0x24, 0x52,
+    0x31, 0x27, 0x01, 0x00, 0x11, 0x11, 0x21, 0x12, 0xa0, 0xcc, 0xbb, 0xae, 0xb9, 0x9d, 0xaa, 0xcf,
+    0x08, 0x89, 0x98, 0xa8, 0x98, 0xa9, 0x20, 0x42, 0x16, 0x12, 0x15, 0x22, 0x52, 0x27, 0x00, 0x10,
+    0x10, 0x21, 0x20, 0x12, 0xa0, 0xcc, 0xbb, 0x9e, 0xba, 0xac, 0xdb, 0xaf, 0x88, 0x88, 0x99, 0xa9,
+    0xb8, 0x9a, 0x20, 0x24, 0x16, 0x32, 0x25, 0x22, 0x15, 0x72, 0x12, 0x00, 0x10, 0x20, 0x11, 0x21,
+    0x01, 0xca, 0xbc, 0xbc, 0xac, 0xac, 0xdb, 0xf9, 0x8a, 0x98, 0x98, 0x99, 0x99, 0xab, 0x09, 0x40,
+    0x62, 0x12, 0x43, 0x52, 0x21, 0x32, 0x57, 0x00, 0x00, 0x10, 0x10, 0x01, 0x21, 0xa0, 0xca, 0xbc,
+    0xbc, 0xac, 0xac, 0xda, 0xf9, 0x8a, 0x90, 0x98, 0x98, 0x99, 0xa9, 0x09, 0x42, 0x62, 0x11, 0x43,
+    0x41, 0x22, 0x24, 0x37, 0x18, 0x00, 0x11, 0x11, 0x22, 0x21, 0x00, 0xac, 0x8e, 0xb9, 0xdb, 0x9a,
+    0xdb, 0xa9, 0xaf, 0x88, 0x89, 0x98, 0x99, 0x9a, 0x09, 0x00, 0x24, 0x06, 0x31, 0x53, 0x21, 0x43,
+    0x72, 0x03, 0x10, 0x10, 0x10, 0x22, 0x22, 0x40, 0xa0, 0xac, 0xbc, 0xea, 0xa9, 0xbb, 0xbc, 0xfb,
+    0x8d, 0x80, 0x88, 0x89, 0x88, 0x98, 0x0a, 0x20, 0x24, 0x24, 0x62, 0x11, 0x33, 0x63, 0x71, 0x81,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0xac, 0x9c, 0xea, 0x89, 0xbb, 0xcb, 0xbb, 0xfe, 0x08,
+    0x88, 0x88, 0x88, 0x88, 0x09, 0x00, 0x40, 0x42, 0x21, 0x06, 0x11, 0x33, 0x24, 0x27, 0x01, 0x00,
+    0x10, 0x22, 0x02, 0x04, 0x00, 0xc0, 0xa0, 0xac, 0xac, 0xca, 0xaa, 0x8e, 0xf9, 0x88, 0x88, 0x88,
+    0x88, 0x99, 0x09, 0x0a, 0x04, 0x40, 0x22, 0x24, 0x42, 0x42, 0x22, 0x14, 0x36, 0x00, 0x21, 0x21,
+    0x02, 0x04, 0x40, 0xa0, 0x00, 0x0c, 0xca, 0xa0, 0xac, 0xca, 0xaa, 0xec, 0x0a, 0x98, 0x90, 0xa0,
+    0x00, 0x0c, 0x00, 0x04, 0x00, 0x04, 0x02, 0x04, 0x02, 0x04, 0x42, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0x00, 0x00, 0x0c, 0x00, 0x0c,
+};
+const SoundClip CLIP_GAMEOVER PROGMEM = { CLIP_GAMEOVER_DATA, 6000, SAMPLE_ADPCM4 };
+
+// 4000 muestras (0.50 s), 2000 bytes
+const uint8_t CLIP_VICTORY_DATA[2000] PROGMEM = {
+    0x40, 0x34, 0x01, 0xca, 0xee, 0x08, 0x08, 0x71, 0x00, 0x00, 0xa8, 0x9f, 0x89, 0x08, 0x32, 0x37,
+    0x10, 0x88, 0xdb, 0x9e, 0x89, 0x20, 0x73, 0x14, 0x00, 0xa9, 0xdd, 0x99, 0x88, 0x32, 0x75, 0x01,
+    0x81, 0xca, 0xaf, 0x99, 0x10, 0x53, 0x17, 0x01, 0xa8, 0xdb, 0x9f, 0x88, 0x10, 0x55, 0x11, 0x81,
+    0xb9, 0xfd, 0x89, 0x09, 0x41, 0x72, 0x03, 0x80, 0xca, 0xaf, 0x89, 0x18, 0x24, 0x27, 0x11, 0xa8,
+    0xeb, 0x9c, 0x88, 0x21, 0x73, 0x23, 0x80, 0xb9, 0xfd, 0x89, 0x08, 0x41, 0x27, 0x10, 0x80, 0xdb,
+    0x9f, 0x98, 0x10, 0x53, 0x17, 0x00, 0x98, 0xfc, 0x9a, 0x88, 0x31, 0x74, 0x12, 0x81, 0xb9, 0xce,
+    0x98, 0x08, 0x41, 0x27, 0x10, 0x90, 0xcb, 0xaf, 0x99, 0x20, 0x53, 0x16, 0x00, 0xa0, 0xfc, 0xa9,
+    0x08, 0x30, 0x65, 0x11, 0x80, 0xc9, 0xfa, 0x9a, 0x00, 0x41, 0x17, 0x02, 0x88, 0xdb, 0x9e, 0x89,
+    0x10, 0x24, 0x27, 0x81, 0xa8, 0xfb, 0x9b, 0x09, 0x31, 0x65, 0x01, 0x81, 0xba, 0xbf, 0x99, 0x18,
+    0x52, 0x16, 0x01, 0xa0, 0xda, 0x9e, 0x09, 0x28, 0x73, 0x13, 0x01, 0xb9, 0xfc, 0x9a, 0x08, 0x40,
+    0x72, 0x02, 0x00, 0xba, 0xbf, 0x99, 0x00, 0x43, 0x27, 0x01, 0x98, 0xdb, 0x9e, 0x88, 0x20, 0x73,
+    0x13, 0x00, 0xa9, 0xed, 0x89, 0x09, 0x41, 0x72, 0x02, 0x80, 0xba, 0xbf, 0x89, 0x18, 0x43, 0x27,
+    0x01, 0xa8, 0xcb, 0xaf, 0x88, 0x20, 0x73, 0x13, 0x00, 0xb9, 0xed, 0x89, 0x08, 0x31, 0x74, 0x02,
+    0x80, 0xca, 0x9f, 0x89, 0x00, 0x53, 0x16, 0x00, 0x98, 0xfc, 0x99, 0x88, 0x30, 0x74, 0x02, 0x81,
+    0xb9, 0xfc, 0x8a, 0x08, 0x41, 0x17, 0x01, 0x90, 0xca, 0xaf, 0x98, 0x10, 0x43, 0x27, 0x00, 0xa8,
+    0xfb, 0x8b, 0x09, 0x30, 0x74, 0x02, 0x00, 0xaa, 0xed, 0x98, 0x08, 0x32, 0x37, 0x10, 0x90, 0xcb,
+    0xaf, 0x88, 0x00, 0x24, 0x17, 0x01, 0x99, 0xfb, 0x8b, 0x09, 0x30, 0x74, 0x02, 0x80, 0xb9, 0xfc,
+    0x99, 0x08, 0x32, 0x37, 0x10, 0x98, 0xda, 0x9d, 0x88, 0x28, 0x72, 0x03, 0x01, 0xa9, 0xfc, 0x99,
+    0x09, 0x21, 0x55, 0x01, 0x00, 0xba, 0xaf, 0x99, 0x18, 0x42, 0x17, 0x11, 0x98, 0xcb, 0x9f, 0x89,
+    0x20, 0x72, 0x03, 0x81, 0xb8, 0xfb, 0x8b, 0x09, 0x31, 0x74, 0x11, 0x90, 0xb9, 0xaf, 0x99, 0x00,
+    0x74, 0x11, 0x80, 0xda, 0x9c, 0x08, 0x32, 0x27, 0x00, 0xba, 0xaf, 0x09, 0x32, 0x27, 0x81, 0xba,
+    0xaf, 0x09, 0x22, 0x27, 0x81, 0xa9, 0xbf, 0x08, 0x31, 0x27, 0x81, 0xa9, 0xaf, 0x89, 0x31, 0x27,
+    0x01, 0xb9, 0xaf, 0x89, 0x21, 0x27, 0x01, 0xb8, 0xaf, 0x89, 0x30, 0x27, 0x01, 0xa8, 0xaf, 0x99,
+    0x21, 0x74, 0x01, 0x99, 0xfb, 0x8a, 0x10, 0x73, 0x02, 0xa0, 0xfb, 0x8a, 0x28, 0x72, 0x12, 0x98,
+    0xfb, 0x9a, 0x10, 0x73, 0x12, 0x98, 0xfb, 0x9a, 0x10, 0x72, 0x12, 0x90, 0xfb, 0x9a, 0x00, 0x72,
+    0x12, 0x80, 0xfb, 0x9a, 0x18, 0x72, 0x12, 0x90, 0xfa, 0x9a, 0x08, 0x43, 0x07, 0x91, 0xb9, 0xaf,
+    0x08, 0x31, 0x27, 0x00, 0xba, 0xaf, 0x08, 0x31, 0x27, 0x80, 0xa9, 0xaf, 0x88, 0x31, 0x27, 0x00,
+    0xb9, 0xaf, 0x88, 0x21, 0x27, 0x81, 0xb8, 0xaf, 0x09, 0x30, 0x27, 0x81, 0xb8, 0xaf, 0x88, 0x20,
+    0x27, 0x01, 0xa9, 0xaf, 0x89, 0x21, 0x73, 0x02, 0x98, 0xfb, 0x8a, 0x20, 0x72, 0x02, 0x98, 0xfb,
+    0x8a, 0x10, 0x73, 0x02, 0x98, 0xfa, 0x8a, 0x18, 0x73, 0x02, 0x90, 0xfb, 0x8a, 0x18, 0x73, 0x02,
+    0x90, 0xfa, 0x8a, 0x08, 0x73, 0x02, 0x90, 0xfa, 0x8a, 0x08, 0x72, 0x12, 0x90, 0xfa, 0x8a, 0x19,
+    0x72, 0x02, 0x80, 0xc9, 0x9e, 0x08, 0x22, 0x27, 0x80, 0xb9, 0xaf, 0x08, 0x31, 0x27, 0x80, 0xb9,
+    0xaf, 0x08, 0x21, 0x27, 0x00, 0xb9, 0xaf, 0x08, 0x30, 0x27, 0x80, 0xb8, 0xaf, 0x08, 0x20, 0x27,
+    0x00, 0xa9, 0xaf, 0x88, 0x21, 0x27, 0x00, 0xa8, 0xaf, 0x88, 0x10, 0x27, 0x10, 0x99, 0xec, 0x98,
+    0x20, 0x72, 0x11, 0x98, 0xfb, 0x99, 0x10, 0x73, 0x11, 0x98, 0xfa, 0x8a, 0x10, 0x72, 0x02, 0x98,
+    0xfa, 0x8a, 0x10, 0x72, 0x11, 0x90, 0xfa, 0x8a, 0x18, 0x72, 0x02, 0x90, 0xfa, 0x8a, 0x18, 0x72,
+    0x11, 0x80, 0xfa, 0x8a, 0x08, 0x72, 0x02, 0x80, 0xba, 0xaf, 0x80, 0x22, 0x17, 0x00, 0xaa, 0x9f,
+    0x88, 0x31, 0x17, 0x00, 0xa9, 0x9f, 0x09, 0x21, 0x17, 0x81, 0xa9, 0x9f, 0x09, 0x30, 0x17, 0x81,
+    0xb8, 0x9f, 0x09, 0x20, 0x27, 0x80, 0xa8, 0x9f, 0x89, 0x21, 0x17, 0x01, 0xa9, 0x9f, 0x89, 0x20,
+    0x27, 0x00, 0xa8, 0x9f, 0x89, 0x10, 0x54, 0x81, 0x90, 0xfb, 0x89, 0x18, 0x73, 0x01, 0x90, 0xfb,
+    0x89, 0x20, 0x17, 0x80, 0xfa, 0x89, 0x10, 0x17, 0x00, 0xfa, 0x89, 0x28, 0x17, 0x00, 0xb9, 0x9f,
+    0x18, 0x72, 0x00, 0xa8, 0x9f, 0x00, 0x72, 0x81, 0xa8, 0x9f, 0x18, 0x71, 0x01, 0x98, 0x9f, 0x08,
+    0x71, 0x01, 0x98, 0x9f, 0x88, 0x72, 0x01, 0x90, 0xfb, 0x89, 0x21, 0x07, 0x80, 0xfa, 0x09, 0x20,
+    0x17, 0x88, 0xfa, 0x09, 0x10, 0x17, 0x80, 0xfa, 0x89, 0x20, 0x17, 0x80, 0xf9, 0x89, 0x18, 0x17,
+    0x81, 0xb9, 0x9f, 0x18, 0x72, 0x81, 0xa8, 0x9f, 0x00, 0x71, 0x01, 0x99, 0x9f, 0x08, 0x72, 0x01,
+    0xa8, 0x9f, 0x08, 0x72, 0x01, 0x98, 0x9f, 0x88, 0x71, 0x01, 0x90, 0xfa, 0x89, 0x21, 0x07, 0x80,
+    0xfa, 0x09, 0x20, 0x07, 0x91, 0xf9, 0x89, 0x20, 0x17, 0x80, 0xfa, 0x89, 0x10, 0x17, 0x00, 0xfa,
+    0x89, 0x10, 0x17, 0x00, 0xaa, 0x9f, 0x18, 0x72, 0x00, 0xa8, 0x8f, 0x08, 0x71, 0x01, 0x99, 0x9f,
+    0x08, 0x72, 0x01, 0xa8, 0x9f, 0x08, 0x62, 0x01, 0x98, 0x9e, 0x88, 0x71, 0x01, 0x90, 0xfa, 0x89,
+    0x11, 0x17, 0x88, 0xfa, 0x88, 0x10, 0x17, 0x88, 0xf9, 0x09, 0x10, 0x07, 0x81, 0xea, 0x89, 0x10,
+    0x17, 0x80, 0xf9, 0x89, 0x10, 0x72, 0x81, 0xa8, 0x8f, 0x08, 0x72, 0x00, 0x98, 0x9f, 0x00, 0x71,
+    0x81, 0x98, 0x8f, 0x09, 0x72, 0x10, 0xa8, 0x9e, 0x08, 0x71, 0x01, 0x98, 0x9e, 0x88, 0x31, 0x17,
+    0x88, 0xfa, 0x88, 0x20, 0x07, 0x80, 0xea, 0x88, 0x10, 0x07, 0x80, 0xe9, 0x09, 0x28, 0x16, 0x80,
+    0xea, 0x89, 0x10, 0x07, 0x81, 0xe9, 0x89, 0x10, 0x72, 0x81, 0xa8, 0x8f, 0x08, 0x72, 0x00, 0xa8,
+    0x8e, 0x08, 0x61, 0x81, 0x98, 0x9e, 0x80, 0x62, 0x10, 0x98, 0x8f, 0x09, 0x61, 0x01, 0x98, 0x8e,
+    0x09, 0x20, 0x17, 0x88, 0xea, 0x88, 0x20, 0x06, 0x80, 0xf9, 0x88, 0x10, 0x16, 0x08, 0xea, 0x09,
+    0x28, 0x06, 0x81, 0xe9, 0x89, 0x10, 0x06, 0x81, 0xf8, 0x98, 0x00, 0x72, 0x81, 0xa8, 0x8e, 0x08,
+    0x62, 0x00, 0x98, 0x9e, 0x00, 0x61, 0x10, 0xa8, 0x8e, 0x09, 0x62, 0x10, 0x98, 0x8f, 0x09, 0x61,
+    0x10, 0x88, 0xfa, 0x09, 0x20, 0x06, 0x80, 0xea, 0x88, 0x20, 0x06, 0x80, 0xf9, 0x88, 0x10, 0x06,
+    0x00, 0xea, 0x88, 0x18, 0x07, 0x81, 0xe9, 0x89, 0x10, 0x06, 0x81, 0xb8, 0x8f, 0x08, 0x62, 0x00,
+    0xd9, 0x09, 0x51, 0x81, 0xda, 0x08, 0x51, 0x80, 0x8c, 0x19, 0x15, 0x88, 0x8e, 0x18, 0x05, 0x90,
+    0x8e, 0x10, 0x05, 0xc8, 0x98, 0x51, 0x81, 0xe8, 0x88, 0x51, 0x81, 0xda, 0x08, 0x14, 0x88, 0x9d,
+    0x00, 0x06, 0x90, 0x8d, 0x18, 0x05, 0xa0, 0x9c, 0x51, 0x81, 0xd8, 0x09, 0x51, 0x00, 0xd9, 0x09,
+    0x52, 0x80, 0xca, 0x08, 0x15, 0x88, 0x9d, 0x10, 0x05, 0x90, 0x8d, 0x28, 0x04, 0xc8, 0x89, 0x70,
+    0x00, 0xd8, 0x09, 0x51, 0x00, 0xca, 0x19, 0x62, 0x80, 0x9c, 0x18, 0x15, 0x98, 0x8d, 0x18, 0x05,
+    0xa0, 0x8c, 0x40, 0x01, 0xe8, 0x09, 0x50, 0x81, 0xd9, 0x88, 0x42, 0x80, 0xe9, 0x08, 0x04, 0x80,
+    0x8d, 0x08, 0x15, 0x98, 0x8d, 0x28, 0x04, 0xc8, 0x89, 0x60, 0x81, 0xd8, 0x88, 0x41, 0x81, 0xf9,
+    0x08, 0x51, 0x80, 0x9c, 0x00, 0x05, 0x80, 0x8d, 0x18, 0x05, 0x98, 0x9c, 0x11, 0x06, 0xc8, 0x88,
+    0x50, 0x00, 0xc9, 0x09, 0x62, 0x80, 0xd9, 0x08, 0x04, 0x91, 0x8d, 0x08, 0x05, 0x90, 0x9c, 0x20,
+    0x06, 0x98, 0x8d, 0x40, 0x00, 0xc8, 0x89, 0x71, 0x00, 0xd9, 0x08, 0x41, 0x80, 0x9c, 0x08, 0x16,
+    0x88, 0x8d, 0x18, 0x14, 0xa8, 0x8e, 0x10, 0x05, 0xc8, 0x88, 0x40, 0x01, 0xe9, 0x88, 0x41, 0x81,
+    0xea, 0x08, 0x23, 0xa1, 0x9f, 0x18, 0x14, 0x98, 0x8d, 0x18, 0x14, 0xa8, 0x8e, 0x40, 0x00, 0xd8,
+    0x88, 0x41, 0x81, 0xe9, 0x88, 0x42, 0x80, 0xda, 0x08, 0x04, 0x90, 0x9c, 0x10, 0x06, 0x90, 0x8d,
+    0x10, 0x04, 0xc8, 0x89, 0x51, 0x81, 0xd8, 0x88, 0x41, 0x81, 0xda, 0x08, 0x41, 0x80, 0x8d, 0x08,
+    0x14, 0xa0, 0x8d, 0x18, 0x14, 0xa8, 0x8d, 0x30, 0x11, 0xf9, 0x89, 0x41, 0x81, 0xe9, 0x08, 0x41,
+    0x80, 0xda, 0x08, 0x23, 0x90, 0x9f, 0x00, 0x14, 0x98, 0x8e, 0x10, 0x04, 0xc8, 0x89, 0x51, 0x00,
+    0xc8, 0x09, 0x51, 0x00, 0xc9, 0x88, 0x52, 0x80, 0xab, 0x28, 0x17, 0x88, 0x9c, 0x10, 0x05, 0x90,
+    0x8d, 0x10, 0x04, 0xc8, 0x09, 0x60, 0x00, 0xc9, 0x88, 0x61, 0x80, 0xc9, 0x08, 0x14, 0x90, 0x8d,
+    0x08, 0x14, 0x98, 0x8d, 0x18, 0x04, 0xa0, 0x8d, 0x30, 0x02, 0xfa, 0x09, 0x40, 0x81, 0xd9, 0x08,
+    0x40, 0x80, 0xbb, 0x18, 0x17, 0x80, 0x8d, 0x18, 0x04, 0x90, 0x8e, 0x10, 0x04, 0xc8, 0x89, 0x51,
+    0x00, 0xc8, 0x09, 0x61, 0x80, 0xc9, 0x08, 0x14, 0x90, 0x8d, 0x08, 0x14, 0x98, 0x8d, 0x18, 0x04,
+    0xa0, 0x8d, 0x30, 0x11, 0xfa, 0x09, 0x31, 0x82, 0xfa, 0x09, 0x31, 0x81, 0xfb, 0x19, 0x22, 0xa0,
+    0x9f, 0x10, 0x04, 0x98, 0x9c, 0x20, 0x07, 0xb8, 0x99, 0x72, 0x00, 0xc8, 0x88, 0x51, 0x80, 0xc8,
+    0x08, 0x51, 0x80, 0xab, 0x10, 0x07, 0x80, 0x8c, 0x18, 0x05, 0x88, 0x8c, 0x30, 0x12, 0xf9, 0x89,
+    0x31, 0x02, 0xfb, 0x09, 0x31, 0x81, 0xfb, 0x88, 0x13, 0xa1, 0x8f, 0x08, 0x04, 0x90, 0x8d, 0x10,
+    0x13, 0xf9, 0x09, 0x40, 0x00, 0xc9, 0x09, 0x61, 0x00, 0xc9, 0x08, 0x51, 0x80, 0x9b, 0x18, 0x07,
+    0x80, 0x8c, 0x18, 0x05, 0x98, 0x9b, 0x71, 0x10, 0xb9, 0x8a, 0x72, 0x81, 0xc8, 0x88, 0x51, 0x80,
+    0xb9, 0x08, 0x17, 0x88, 0x8c, 0x18, 0x14, 0x98, 0x8e, 0x18, 0x04, 0x98, 0x8d, 0x30, 0x01, 0xf9,
+    0x88, 0x40, 0x00, 0xd9, 0x08, 0x31, 0x91, 0x8f, 0x19, 0x23, 0xa0, 0x9f, 0x00, 0x04, 0x90, 0x8d,
+    0x10, 0x03, 0xf8, 0x09, 0x40, 0x00, 0xc9, 0x09, 0x61, 0x00, 0xc9, 0x08, 0x23, 0x91, 0x9f, 0x18,
+    0x23, 0xa8, 0x9f, 0x10, 0x13, 0xb8, 0x8f, 0x20, 0x01, 0xf9, 0x88, 0x40, 0x00, 0xd9, 0x08, 0x31,
+    0x80, 0x8f, 0x08, 0x13, 0xa1, 0x9f, 0x00, 0x04, 0x90, 0x8d, 0x10, 0x03, 0xf8, 0x88, 0x30, 0x11,
+    0xfa, 0x09, 0x40, 0x80, 0xd8, 0x08, 0x31, 0x80, 0x8f, 0x08, 0x23, 0xa8, 0x9f, 0x10, 0x13, 0xb8,
+    0x8f, 0x20, 0x01, 0xf9, 0x88, 0x40, 0x00, 0xc9, 0x09, 0x52, 0x80, 0xc9, 0x08, 0x05, 0x80, 0x8c,
+    0x18, 0x14, 0xa8, 0x8d, 0x10, 0x04, 0xc8, 0x89, 0x51, 0x00, 0xc8, 0x09, 0x51, 0x00, 0xc9, 0x08,
+    0x51, 0x80, 0xab, 0x28, 0x07, 0x80, 0x9b, 0x28, 0x07, 0x90, 0x8b, 0x60, 0x00, 0xb8, 0x89, 0x71,
+    0x81, 0xc8, 0x08, 0x40, 0x81, 0xda, 0x08, 0x13, 0x91, 0x9f, 0x00, 0x23, 0xa8, 0x8f, 0x18, 0x03,
+    0xb8, 0x8f, 0x20, 0x01, 0xe9, 0x88, 0x40, 0x80, 0xc8, 0x88, 0x52, 0x80, 0xab, 0x18, 0x17, 0x88,
+    0xab, 0x20, 0x07, 0x90, 0x8b, 0x30, 0x07, 0xa8, 0x89, 0x61, 0x00, 0xc8, 0x08, 0x40, 0x00, 0xda,
+    0x08, 0x23, 0x90, 0x9f, 0x00, 0x13, 0x90, 0x8f, 0x18, 0x12, 0xa8, 0x8f, 0x20, 0x01, 0xea, 0x88,
+    0x21, 0x82, 0xfa, 0x88, 0x31, 0x80, 0x8e, 0x08, 0x13, 0xa0, 0x8f, 0x08, 0x23, 0x99, 0x8f, 0x18,
+    0x03, 0xe8, 0x88, 0x30, 0x01, 0xfa, 0x88, 0x21, 0x01, 0xfb, 0x08, 0x30, 0x80, 0x8e, 0x08, 0x13,
+    0xa0, 0x8f, 0x18, 0x03, 0xa8, 0x8f, 0x20, 0x01, 0xe9, 0x88, 0x30, 0x01, 0xfa, 0x88, 0x31, 0x80,
+    0xfa, 0x08, 0x12, 0xa0, 0x9d, 0x10, 0x14, 0x98, 0x8e, 0x00, 0x03, 0xe8, 0x88, 0x30, 0x01, 0xfa,
+    0x88, 0x21, 0x01, 0xfa, 0x08, 0x30, 0x90, 0x9d, 0x18, 0x05, 0x90, 0x9b, 0x38, 0x07, 0x90, 0x9a,
+    0x51, 0x01, 0xd9, 0x88, 0x40, 0x00, 0xc9, 0x09, 0x52, 0x00, 0xca, 0x08, 0x14, 0x90, 0x9d, 0x00,
+    0x05, 0x90, 0x9b, 0x20, 0x07, 0x90, 0x8b, 0x61, 0x00, 0xb8, 0x89, 0x72, 0x00, 0xb9, 0x08, 0x72,
+    0x80, 0x9a, 0x00, 0x06, 0x90, 0x9a, 0x10, 0x07, 0x90, 0x8b, 0x20, 0x07, 0xa8, 0x98, 0x61, 0x00,
+    0xa9, 0x09, 0x71, 0x80, 0xa8, 0x09, 0x06, 0x80, 0x9b, 0x10, 0x07, 0x90, 0x9a, 0x20, 0x07, 0x88,
+    0x8b, 0x60, 0x00, 0xb8, 0x89, 0x72, 0x80, 0xa8, 0x09, 0x72, 0x80, 0x8a, 0x19, 0x15, 0x88, 0x8d,
+    0x18, 0x13, 0xb0, 0x8f, 0x18, 0x12, 0xd9, 0x09, 0x40, 0x01, 0xda, 0x88, 0x51, 0x80, 0xc8, 0x08,
+    0x51, 0x80, 0x9b, 0x18, 0x07, 0x90, 0x9a, 0x20, 0x07, 0x88, 0x8b, 0x60, 0x00, 0xb8, 0x09, 0x71,
+    0x00, 0xa9, 0x09, 0x71, 0x80, 0xb8, 0x18, 0x05, 0x80, 0x9c, 0x10, 0x05, 0x90, 0x9c, 0x20, 0x05,
+    0xb8, 0x8a, 0x72, 0x00, 0xa8, 0x89, 0x71, 0x80, 0xa8, 0x09, 0x72, 0x80, 0x8a, 0x08, 0x15, 0x88,
+    0x8d, 0x00, 0x13, 0xb8, 0x8f, 0x10, 0x01, 0xd8, 0x09, 0x40, 0x81, 0xd9, 0x88, 0x51, 0x80, 0xa9,
+    0x09, 0x07, 0x80, 0xaa, 0x10, 0x07, 0x90, 0x9a, 0x20, 0x07, 0x98, 0x8a, 0x51, 0x00, 0xc8, 0x09,
+    0x51, 0x00, 0xd9, 0x08, 0x21, 0x81, 0x8f, 0x08, 0x12, 0xa1, 0x8e, 0x18, 0x13, 0xb8, 0x8f, 0x00,
+    0x02, 0xd8, 0x88, 0x40, 0x00, 0xc9, 0x09, 0x71, 0x80, 0xa8, 0x09, 0x15, 0x88, 0x8c, 0x08, 0x05,
+    0x90, 0x8c, 0x10, 0x05, 0x98, 0x8c, 0x40, 0x01, 0xd9, 0x88, 0x41, 0x00, 0xca, 0x09, 0x62, 0x80,
+    0x9a, 0x08, 0x07, 0x80, 0x8b, 0x18, 0x06, 0x90, 0x9b, 0x21, 0x07, 0x98, 0x89, 0x50, 0x00, 0xc8,
+    0x88, 0x51, 0x80, 0xb9, 0x19, 0x73, 0x80, 0x8a, 0x19, 0x07, 0x90, 0x8a, 0x28, 0x06, 0x88, 0x9b,
+    0x61, 0x00, 0xb8, 0x89, 0x72, 0x00, 0xa9, 0x08, 0x61, 0x80, 0xb8, 0x19, 0x06, 0x80, 0x9b, 0x28,
+    0x07, 0x90, 0x8a, 0x10, 0x07, 0xa8, 0x88, 0x50, 0x00, 0xc8, 0x88, 0x41, 0x81, 0xf9, 0x08, 0x20,
+    0x91, 0x9c, 0x18, 0x06, 0x90, 0x9a, 0x28, 0x07, 0x88, 0x8a, 0x50, 0x00, 0xb8, 0x8a, 0x72, 0x00,
+    0xb8, 0x09, 0x72, 0x80, 0xa8, 0x08, 0x14, 0x80, 0x8e, 0x08, 0x13, 0xa0, 0x8f, 0x00, 0x02, 0xa8,
+};
+const SoundClip CLIP_VICTORY PROGMEM = { CLIP_VICTORY_DATA, 4000, SAMPLE_ADPCM4 };
+
+// en total 6920 bytes de flash
+
+#endif
@@ -0,0 +1,244 @@
+#ifndef SpiPump_h
+#define SpiPump_h
+
+#include <Arduino.h>
+#include <SPI.h>
+#ifdef DISPLAY_USART
+#include "UsartSpi.h"
+#endif
+
+// Bombeo de pixeles por el SPI por hardware escribiendo SPDR directo.
+//
+// A fck/2 (8 MHz con 16 MHz de reloj) un byte tarda 16 ciclos en salir. Las
+// librerias mandan cada byte y esperan SPIF en un ciclo de IN/SBRS/RJMP, asi
+// que entre byte y byte se pierden varios ciclos. Aqui el siguiente OUT va
+// exactamente 17 ciclos despues del anterior (16 del byte + 1 de margen),
+// contados a mano, sin mirar SPIF; SPSR solo se lee al final para limpiar
+// SPIF. Mientras sale un byte se prepara el siguiente (el color de relleno ya
+// esta en registros; al leer de la flash el LPM del pixel siguiente cabe en
+// la espera). Queda en 16/17 (94%) del maximo teorico del SPI.
+//
+// Si una interrupcion corta el ciclo solo se alarga la espera, nunca se pisa
+// un byte. Lo que si romperia la cuenta es un SPI mas lento que fck/2: en ese
+// caso (y fuera del AVR) se manda byte por byte esperando SPIF.
+//
+// Quien llama ya abrio la ventana (startWrite + setAddrWindow) y cierra con
+// endWrite. Solo sirve si el display va por el SPI por hardware; con
+// -DDISPLAY_USART spiPumpFill y spiPumpStream van a la USART (UsartSpi.h).
+
+#if defined(__AVR__)
+inline bool spiPumpFullSpeed() {
+#ifdef NO_SPI_PUMP
+    return false; // env:bench_lib, para comparar
+#else
+    return (SPCR & (_BV(SPR1) | _BV(SPR0))) == 0 && (SPSR & _BV(SPI2X));
+#endif
+}
+
+// 1..65535 pixeles del mismo color
+inline void spiPumpFill16(uint8_t hi, uint8_t lo, uint16_t n) {
+    asm volatile(
+        "1:  out %[spdr], %[hi]"     "\n\t" // ciclo 0
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t" // 16
+        "    out %[spdr], %[lo]"     "\n\t" // ciclo 17
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t" // 12
+        "    sbiw %[n], 1"           "\n\t" // 14
+        "    brne 1b"                "\n\t" // 16 -> OUT en el ciclo 34
+        "    rjmp .+0"               "\n\t" // el ultimo byte ya salio
+        "    in __tmp_reg__, %[spsr]" "\n\t" // limpiar SPIF: leer SPSR y luego SPDR
+        "    in __tmp_reg__, %[spdr]" "\n\t"
+        : [n] "+w" (n)
+        : [hi] "r" (hi), [lo] "r" (lo),
+          [spdr] "I" (_SFR_IO_ADDR(SPDR)), [spsr] "I" (_SFR_IO_ADDR(SPSR)));
+}
+
+// 1..65535 pixeles seguidos de la flash, en el orden en que estan guardados
+// (uint16_t: byte bajo primero, el display quiere el alto primero)
+inline void spiPumpStream16(uint_farptr_t addr, uint16_t n) {
+    uint8_t hi, lo, nextLo;
+    uint16_t z = (uint16_t)addr;
+#if defined(__AVR_HAVE_ELPM__)
+    uint8_t page = (uint8_t)(addr >> 16);
+    asm volatile(
+        "    out %[rampz], %[page]"  "\n\t"
+        "    elpm %[lo], Z+"         "\n\t"
+        "    elpm %[hi], Z+"         "\n\t"
+        "1:  out %[spdr], %[hi]"     "\n\t" // ciclo 0
+        "    elpm %[nlo], Z+"        "\n\t" // 3: siguiente pixel mientras sale este
+        "    elpm %[hi], Z+"         "\n\t" // 6
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t" // 16
+        "    out %[spdr], %[lo]"     "\n\t" // ciclo 17
+        "    mov %[lo], %[nlo]"      "\n\t" // 1
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    nop"                    "\n\t" // 12
+        "    sbiw %[n], 1"           "\n\t" // 14
+        "    brne 1b"                "\n\t" // 16 -> OUT en el ciclo 34
+        "    out %[rampz], __zero_reg__" "\n\t"
+        "    in __tmp_reg__, %[spsr]" "\n\t"
+        "    in __tmp_reg__, %[spdr]" "\n\t"
+        : [n] "+w" (n), [z] "+z" (z), [hi] "=&r" (hi), [lo] "=&r" (lo), [nlo] "=&r" (nextLo)
+        : [page] "r" (page), [rampz] "I" (_SFR_IO_ADDR(RAMPZ)),
+          [spdr] "I" (_SFR_IO_ADDR(SPDR)), [spsr] "I" (_SFR_IO_ADDR(SPSR)));
+#else
+    asm volatile(
+        "    lpm %[lo], Z+"          "\n\t"
+        "    lpm %[hi], Z+"          "\n\t"
+        "1:  out %[spdr], %[hi]"     "\n\t" // ciclo 0
+        "    lpm %[nlo], Z+"         "\n\t" // 3: siguiente pixel mientras sale este
+        "    lpm %[hi], Z+"          "\n\t" // 6
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t" // 16
+        "    out %[spdr], %[lo]"     "\n\t" // ciclo 17
+        "    mov %[lo], %[nlo]"      "\n\t" // 1
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    nop"                    "\n\t" // 12
+        "    sbiw %[n], 1"           "\n\t" // 14
+        "    brne 1b"                "\n\t" // 16 -> OUT en el ciclo 34
+        "    rjmp .+0"               "\n\t"
+        "    in __tmp_reg__, %[spsr]" "\n\t"
+        "    in __tmp_reg__, %[spdr]" "\n\t"
+        : [n] "+w" (n), [z] "+z" (z), [hi] "=&r" (hi), [lo] "=&r" (lo), [nlo] "=&r" (nextLo)
+        : [spdr] "I" (_SFR_IO_ADDR(SPDR)), [spsr] "I" (_SFR_IO_ADDR(SPSR)));
+#endif
+}
+
+// 1..65535 pixeles seguidos de la RAM (las tiras de Compositor.h). Igual
+// que spiPumpStream16 pero LD tarda 2 ciclos y LPM 3: un RJMP mas de espera
+inline void spiPumpRam16(const uint16_t* p, uint16_t n) {
+    uint8_t hi, lo, nextLo;
+    asm volatile(
+        "    ld %[lo], Z+"           "\n\t"
+        "    ld %[hi], Z+"           "\n\t"
+        "1:  out %[spdr], %[hi]"     "\n\t" // ciclo 0
+        "    ld %[nlo], Z+"          "\n\t" // 2: siguiente pixel mientras sale este
+        "    ld %[hi], Z+"           "\n\t" // 4
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t" // 16
+        "    out %[spdr], %[lo]"     "\n\t" // ciclo 17
+        "    mov %[lo], %[nlo]"      "\n\t" // 1
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    rjmp .+0"               "\n\t"
+        "    nop"                    "\n\t" // 12
+        "    sbiw %[n], 1"           "\n\t" // 14
+        "    brne 1b"                "\n\t" // 16 -> OUT en el ciclo 34
+        "    rjmp .+0"               "\n\t"
+        "    in __tmp_reg__, %[spsr]" "\n\t"
+        "    in __tmp_reg__, %[spdr]" "\n\t"
+        : [n] "+w" (n), [z] "+z" (p), [hi] "=&r" (hi), [lo] "=&r" (lo), [nlo] "=&r" (nextLo)
+        : [spdr] "I" (_SFR_IO_ADDR(SPDR)), [spsr] "I" (_SFR_IO_ADDR(SPSR))
+        : "memory");
+}
+
+inline void spiPumpByte(uint8_t b) {
+    SPDR = b;
+    while (!(SPSR & _BV(SPIF))) {}
+}
+#else
+inline bool spiPumpFullSpeed() { return false; }
+inline void spiPumpFill16(uint8_t, uint8_t, uint16_t) {}
+inline void spiPumpStream16(uint_farptr_t, uint16_t) {}
+inline void spiPumpRam16(const uint16_t*, uint16_t) {}
+inline void spiPumpByte(uint8_t b) { SPI.transfer(b); }
+#endif
+
+// n pixeles de un color
+inline void spiPumpFill(uint16_t color, uint32_t n) {
+#ifdef DISPLAY_USART
+    if (n > 0) {
+        usartSpiFill(color, n);
+    }
+    return;
+#endif
+    uint8_t hi = color >> 8, lo = color;
+    if (spiPumpFullSpeed()) {
+        while (n > 0) {
+            uint16_t k = n > 0xFFFF ? 0xFFFF : (uint16_t)n;
+            spiPumpFill16(hi, lo, k);
+            n -= k;
+        }
+        return;
+    }
+    while (n--) {
+        spiPumpByte(hi);
+        spiPumpByte(lo);
+    }
+}
+
+// n pixeles seguidos de la flash (cercana o lejana, ver AssetBank.h)
+inline void spiPumpStream(uint_farptr_t addr, uint16_t n) {
+    if (n == 0) {
+        return;
+    }
+#ifdef DISPLAY_USART
+    usartSpiStream(addr, n);
+    return;
+#endif
+    if (spiPumpFullSpeed()) {
+        spiPumpStream16(addr, n);
+        return;
+    }
+    for (; n > 0; n--, addr += 2) {
+#if defined(__AVR_HAVE_ELPM__)
+        uint16_t w = pgm_read_word_far(addr);
+#else
+        uint16_t w = pgm_read_word((const uint16_t*)(uintptr_t)addr);
+#endif
+        spiPumpByte(w >> 8);
+        spiPumpByte(w);
+    }
+}
+
+// n pixeles de la RAM
+inline void spiPumpPixels(const uint16_t* p, uint16_t n) {
+    if (n == 0) {
+        return;
+    }
+#ifdef DISPLAY_USART
+    usartSpiPixels(p, n);
+    return;
+#endif
+    if (spiPumpFullSpeed()) {
+        spiPumpRam16(p, n);
+        return;
+    }
+    for (; n > 0; n--, p++) {
+        spiPumpByte(*p >> 8);
+        spiPumpByte(*p);
+    }
+}
+
+#endif
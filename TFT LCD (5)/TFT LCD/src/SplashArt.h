@@ -0,0 +1,246 @@
+#ifndef SplashArt_h
+#define SplashArt_h
+
+#include "AssetBank.h"
+
+// Generado por tools/gen_half_res.py, no editar a mano.
+// Imagenes a media resolucion en el banco de assets lejano; se dibujan con
+// Display::drawRGBBitmapScaled.
+
+const uint16_t splashFondo[1824] ASSET_FAR = {
+	// spriteFondo de fondo.h, 32x57px (original 64x114)
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xf7de, 0xffdf, 0xbdf7, 0x8410, 0xe73c, 0xf7de, 0xffdf, 0xffff, 0xffff, 0xa534, 0xef7d, 0xffdf, 0xdefb, 0xbdd7, 0xffff,
+	0xf7de, 0xffff, 0xf7de, 0xa514, 0xdefb, 0x94d2, 0x6b8d, 0xdf1b, 0xffdf, 0xffff, 0xef7d, 0xad95, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7de, 0xffff, 0xf7be, 0x8c71, 0x9cd3, 0x4248, 0xef5d, 0xf7de, 0xffdf, 0xf7de, 0x39e7, 0xb5d6, 0xf7de, 0xe73c, 0x738e, 0xf7de,
+	0xffff, 0xffdf, 0xffdf, 0x5aeb, 0xf7be, 0x738e, 0xc658, 0x4a69, 0xf7be, 0xffff, 0xdf1b, 0x7bcf, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xf7be, 0xffff, 0x8430, 0xb596, 0x4a69, 0xef7d, 0xf7de, 0xf7de, 0xef5d, 0x4a69, 0x73ae, 0xffdf, 0xffdf, 0x528a, 0xf7de,
+	0xf7de, 0xffdf, 0xffdf, 0x528a, 0xf7de, 0x6b6d, 0xad55, 0x528a, 0xffdf, 0xf7de, 0xd6ba, 0x7c0f, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffdf, 0xf7de, 0x9492, 0x2945, 0xdf1b, 0xf7be, 0xffdf, 0xf7de, 0xad55, 0x9d13, 0x4a69, 0xffdf, 0xf7de, 0x528a, 0xf7de,
+	0xdefb, 0xf7be, 0xdedb, 0x73ae, 0xffff, 0x6b4d, 0x39e7, 0xf7be, 0xf7de, 0xf7be, 0xd6ba, 0x7c0f, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffdf, 0xf7de, 0x8430, 0x5b0b, 0xad55, 0xffff, 0xffdf, 0xf7be, 0x73ae, 0x4a49, 0x2124, 0xdf3b, 0xf7de, 0x6b8d, 0xe75c,
+	0x2965, 0xb5b6, 0xa534, 0xa534, 0xf7df, 0x6b6d, 0x7bcf, 0xb596, 0xf7de, 0xffff, 0xce79, 0x8450, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xffff, 0xffdf, 0x8410, 0xce79, 0x4a69, 0xdefb, 0xf7de, 0xf7de, 0x4a69, 0xf7be, 0xad55, 0x94d2, 0xf7de, 0x8cb1, 0x7c0f,
+	0x8c91, 0x528a, 0x6b8e, 0xe71c, 0xffdf, 0x630c, 0xf79e, 0x4a69, 0xdf1b, 0xf7de, 0xc618, 0x8450, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7de, 0xffdf, 0xf7de, 0x7bef, 0xd6da, 0xe73c, 0x528a, 0xf7be, 0xef9d, 0x630c, 0xf7de, 0xef7d, 0x630c, 0xf7de, 0xbe38, 0x18e3,
+	0xef9d, 0x9492, 0x31a7, 0xf7be, 0xf7df, 0x6b4d, 0xf79e, 0xdf1b, 0x4a69, 0xf7de, 0xdf1b, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7de, 0xffdf, 0xffff, 0x94b2, 0xdf1b, 0xf7be, 0xb596, 0xc638, 0xc638, 0xa534, 0xf7de, 0xf7de, 0x6b8e, 0xf7de, 0xef7e, 0x9cd3,
+	0xf7be, 0xf79e, 0x8c72, 0xffdf, 0xffdf, 0x94b2, 0xffde, 0xffdf, 0xbdf7, 0xdedb, 0xe71c, 0xce79, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7be, 0xffff, 0xffdf, 0xf7de,
+	0xffdf, 0xffdf, 0xffde, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xf7de, 0xffde, 0xffff,
+	0xffde, 0xffde, 0xffde, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0xd699, 0xbdd5, 0xf7bd,
+	0xffdd, 0xef7c, 0x842f, 0xad74, 0xfffe, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xfffe, 0xded9, 0x7bcc, 0xb572, 0x83ec,
+	0xef5b, 0x738b, 0xded8, 0x7bcc, 0xffde, 0xfffe, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0xffdf, 0xffdf, 0xffff, 0xf7df, 0xffdf, 0xf7be, 0xfffd, 0x83cb, 0xeef5, 0xe6b3, 0xde51,
+	0x62c6, 0xeeb4, 0xf6d2, 0xaccd, 0xd679, 0xf7be, 0xce57, 0xef5c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0xffff, 0xffdf, 0xffdf, 0xffff, 0xef7d, 0x94d1, 0x52c8, 0x8c6e, 0xbdd2, 0xad4e, 0xad4e,
+	0xc632, 0xe6d4, 0xeed3, 0xce31, 0x7329, 0x840b, 0xad50, 0x7b8e, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0xf7de, 0xf7de, 0xc677, 0x5b6a, 0x8d31, 0x84cf, 0x5b6a, 0x7c4d, 0x8cce, 0x8cee,
+	0x7c4b, 0x5b68, 0x846a, 0xded3, 0xeed3, 0xf732, 0xef15, 0x83af, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0xf7de, 0xf7de, 0xb5b6, 0x63cb, 0xa5f3, 0x9dd2, 0x9df2, 0x9df3, 0x9df3, 0x9df3, 0x9dd2,
+	0x9dd1, 0x9e13, 0x9590, 0x6367, 0xd672, 0xf6b0, 0xcdee, 0xb553, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xf7df, 0xffdf, 0xffdf, 0xf7de, 0xf7de, 0xd6ba, 0x636b, 0xa5f3, 0x9df2, 0x9df2, 0x9612, 0x9611, 0x9611, 0x9612, 0x9611,
+	0x95f2, 0x9613, 0x9612, 0xa5d2, 0x6ae8, 0xeed3, 0xe690, 0x942b, 0x7bee, 0xf7de, 0xf7de, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xffff, 0xffdf, 0xffff, 0xf7de, 0xa5b4, 0x3226, 0x84f0, 0x9df2, 0x95f2, 0x9e12, 0x9611, 0x9611, 0x8df0, 0x9e31, 0x9612,
+	0x9e13, 0x9612, 0x9631, 0x9dd3, 0x9d33, 0x8c2b, 0xef13, 0xeef5, 0x7bee, 0xef5d, 0xf7de, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xffdf, 0xf7de, 0xf7de, 0x8cd1, 0x7c6f, 0x5bab, 0x744d, 0x9df2, 0x9e12, 0x9611, 0x9611, 0x95f1, 0x9df2, 0xa613, 0x8d51,
+	0x748e, 0x9e12, 0x9e11, 0x95f2, 0x9df4, 0x5b68, 0xe714, 0x8baa, 0xc617, 0xf7be, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffdf, 0xf7de, 0xbe16, 0x6c0d, 0x9db2, 0x00e0, 0x8d70, 0x9dd1, 0x9e12, 0x9e11, 0x9e12, 0x6c8d, 0x7ccf, 0x4b09, 0x63cc,
+	0x9db2, 0x9dd2, 0x9e10, 0x9611, 0x9612, 0x7ced, 0xb56f, 0x9bed, 0x9471, 0xe73c, 0xf7de, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xffde, 0xffde, 0x636a, 0xa613, 0x95f2, 0x9612, 0x9dd2, 0xa5d2, 0x9e12, 0x9e31, 0x95f1, 0x9df2, 0x1983, 0x6c4d, 0x9dd3,
+	0x9df2, 0x9df2, 0x9e12, 0x9e12, 0x95d2, 0xa5b1, 0x8c2a, 0xeef5, 0xe6d8, 0x7b8c, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7df, 0xf7df, 0xd6da, 0x73ed, 0xa5b3, 0xadd3, 0xa5d3, 0x9d92, 0x31e6, 0x3205, 0x8550, 0x9612, 0x9df3, 0x2184, 0x534a, 0x9df3,
+	0x9e12, 0x9e12, 0x9e12, 0x9e12, 0x9df3, 0xadf2, 0x7388, 0xe6b4, 0x7b8a, 0xd698, 0xf7de, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xf7df, 0xa5b5, 0x8cd1, 0xc616, 0xd678, 0xbe36, 0x6bec, 0x0000, 0x0800, 0x10c2, 0x95b2, 0x9dd3, 0xad93, 0xb5d4, 0x95d2,
+	0x9e12, 0x9e12, 0x9e12, 0x9612, 0x95f2, 0xae33, 0x6b88, 0xbd8f, 0xb572, 0xf7dd, 0xf7be, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7de, 0xf7ff, 0xa5b5, 0x8cf1, 0xadb4, 0xb5d4, 0xadd4, 0x6c0c, 0x0020, 0x1000, 0x28a1, 0x63cb, 0x9dd3, 0xce16, 0xde77, 0xbe34,
+	0x9df2, 0x9e12, 0x9e11, 0x9612, 0x95f2, 0xa612, 0x73a9, 0xef36, 0x83ed, 0xef5c, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7fe, 0xf7de, 0xce98, 0x7c2e, 0x9dd3, 0x95f2, 0x9e12, 0x8d50, 0x10c1, 0xbc0e, 0xecf2, 0x6ae8, 0x9e33, 0xa5d3, 0xbe15, 0xadd3,
+	0x9df2, 0x9e12, 0x9e11, 0x9612, 0x9612, 0x9dd2, 0x7c0a, 0xce12, 0x7bad, 0xf7de, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7fe, 0xfffe, 0xffde, 0x5b2a, 0x9e14, 0x9632, 0x9611, 0xa612, 0x7389, 0xab8b, 0xe511, 0x62c6, 0x9e33, 0x8df3, 0x9dd3, 0x9df3,
+	0x9df2, 0x9df2, 0x9e11, 0x9e12, 0x95d1, 0x8d2f, 0xa52f, 0x7b88, 0xf7bd, 0xffde, 0xf7de, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xffde, 0xffde, 0xadb5, 0x746e, 0x9df3, 0x95f1, 0x9611, 0x9613, 0x84cd, 0x5b48, 0x8d2e, 0x9dd2, 0x9dd2, 0xa5b2, 0xadb2,
+	0x9df3, 0x9df2, 0x9df2, 0x9e12, 0x9df2, 0x6bea, 0xdeb5, 0x9c6c, 0xd6d9, 0xef9e, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffbf, 0xffdf, 0xefdf, 0xf7fe, 0x8c90, 0x7c2e, 0xae13, 0x9df2, 0xa5d4, 0x9dd3, 0x9e12, 0x95f2, 0x9df2, 0x9e13, 0x9632, 0x8e31,
+	0x95f3, 0x9df2, 0x9df2, 0x9df2, 0xa5f2, 0x6388, 0xef16, 0x942b, 0xd6ba, 0xf7df, 0xf7df, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7de, 0xf7be, 0xdefb, 0x8cb1, 0x8c91, 0x9512, 0x5bab, 0x84ef, 0x9df2, 0x95f1, 0x95f2, 0x9dd2, 0x8d51, 0x538a, 0x4b68, 0x7d2f,
+	0x9e13, 0x9df1, 0x9df2, 0x9df2, 0x7c6b, 0xbdb0, 0x7b69, 0xc637, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xe73c, 0x4248, 0xad74, 0xa594, 0x63cc, 0x5b8b, 0x8d50, 0x9611, 0x95f1, 0x95f1, 0x8530, 0x32a6, 0x9dd3, 0xa613, 0x53ca,
+	0x74ef, 0x9dd1, 0xa612, 0x9e12, 0x6388, 0xeef5, 0x83ab, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7be, 0xd6da, 0x4248, 0x5b0b, 0x6bed, 0x84d0, 0x6c6d, 0x95f2, 0x9611, 0x9611, 0x9e12, 0x5bca, 0x5369, 0x74ae, 0x95b2, 0xa614,
+	0x4328, 0x9e12, 0x9df2, 0x84ee, 0xa52e, 0xe6b4, 0xc5d3, 0xad75, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7de, 0xffdf, 0xce79, 0xd6fa, 0xc698, 0x3246, 0x9e12, 0x9e12, 0x95f1, 0x95f1, 0x9e12, 0x9dd2, 0x748d, 0x746d, 0x642c, 0x9dd2,
+	0x6c6d, 0x8d30, 0x9dd2, 0x63a9, 0xded4, 0xd653, 0x7349, 0xef7c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xf7de, 0xf7de, 0xf7de, 0xb5f5, 0x7caf, 0x9dd2, 0x9df2, 0x9e12, 0x9df2, 0x9df1, 0x9df2, 0x9dd2, 0x8d70, 0x640b, 0x9df3,
+	0x9db1, 0x4348, 0xa613, 0x6388, 0xeef5, 0x83a9, 0xffbc, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xffdf, 0xffff, 0xf7de, 0x7c2e, 0x9531, 0x7ccf, 0x9591, 0xa613, 0x95d2, 0x9df2, 0x9df2, 0x9df2, 0x9df2, 0x53a9, 0x8d50,
+	0x9dd1, 0x9e33, 0x9df3, 0x7be9, 0xf715, 0x8beb, 0xd6b8, 0xf7be, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xffdf, 0xffdf, 0xffdf, 0x4248, 0x9512, 0xae15, 0x8d11, 0x538a, 0x9592, 0x95d2, 0x9df2, 0x95d1, 0x9e12, 0x9e12, 0xa5f2,
+	0x9df1, 0x8df2, 0x9df2, 0x8429, 0xeef4, 0xde96, 0x94d2, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffdf, 0xffdf, 0xffdf, 0xc618, 0xad95, 0xe77c, 0xefdd, 0xe7dc, 0xdf9b, 0x5beb, 0x9591, 0x95d2, 0x9e12, 0x9e11, 0x9df1, 0x9df1,
+	0x9dd0, 0x9633, 0x95f2, 0x8408, 0xde72, 0x7b8a, 0xefbd, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffdf, 0x94f2, 0xe77c, 0xe7dc, 0xdfdb, 0xe7dc, 0xe7dc, 0xdfdb, 0x5b8a, 0xa5f3, 0x9df2, 0x9df2, 0x9df2, 0x95f1,
+	0x95f1, 0x95f2, 0x9e33, 0x6ba8, 0xe6b3, 0x8ba9, 0xded9, 0xf7ff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffdf, 0xffff, 0x94d2, 0xe79c, 0xe7dd, 0xe7fc, 0xdffb, 0xe7dc, 0xe7dc, 0xbe96, 0x6c2c, 0x9dd2, 0x9df2, 0x9df2, 0x95f1,
+	0x95f1, 0x9e12, 0x9e12, 0x6368, 0xe6f5, 0xf6f6, 0x7b8b, 0xf7df, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xf7df, 0xffff, 0xffff, 0xa534, 0xd6fa, 0xefdd, 0xe7dc, 0xe7dc, 0xe7dc, 0xe7dc, 0xe7dc, 0x63cb, 0xa613, 0x9dd2, 0x9e12, 0x9611,
+	0x9e12, 0x95f2, 0x9df2, 0x6c0a, 0xd653, 0xd633, 0x8c0d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xf7de, 0xf7be, 0xce99, 0xa574, 0xe7bc, 0xe7dc, 0xe7dc, 0xe7dc, 0xe7dc, 0xe7dc, 0x9531, 0x8d30, 0x9df2, 0x9e12, 0x95f1,
+	0x95f1, 0x9612, 0x9df2, 0x9d90, 0x8c4b, 0x83ca, 0xad11, 0xef7c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0x7c0f, 0xefbc, 0xefdd, 0xe7dc, 0xe7dc, 0xe7dc, 0xe7dc, 0xbeb7, 0x746d, 0x9df2, 0x9e12, 0x9e11,
+	0x9e12, 0x9e12, 0x9e12, 0xa612, 0x6368, 0xded6, 0xd635, 0x83ac, 0xf7de, 0xf7de, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xad95, 0xbe17, 0xe7bc, 0xe7dc, 0xe7dc, 0xe7dc, 0xe7dc, 0xdf9b, 0x63eb, 0x95b2, 0x95f2, 0x9e32,
+	0x9e12, 0x9e12, 0x9e12, 0x9df2, 0x9d91, 0x73ea, 0xef17, 0x8beb, 0xf7dd, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0x7c0f, 0xdf3b, 0xe7bc, 0xe7dc, 0xe7dc, 0xe7dc, 0xe7dc, 0x5b8b, 0x9e13, 0x95d1, 0x9611,
+	0x9df2, 0x9e12, 0x9e12, 0x95f2, 0x9df2, 0x7c6c, 0xa550, 0x8bea, 0xce77, 0xce98, 0xfffe, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0xf7be, 0x6bcd, 0xd71a, 0xe7dc, 0xe7dc, 0xe7dc, 0xe7dc, 0x5b8b, 0x642c, 0x8d90, 0x9e12,
+	0x9e12, 0x9e12, 0x9612, 0x9632, 0x9612, 0x9dd2, 0x73ea, 0xa4ee, 0xad51, 0x73ac, 0xf7dd, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0xffdf, 0xf7be, 0x7c0f, 0xadd5, 0xefdd, 0xe7dc, 0xe7bd, 0x63cc, 0x5369, 0xa613, 0x95f1,
+	0x9df1, 0x9df2, 0x9df1, 0x9df2, 0x9df1, 0x9df2, 0x9df2, 0x6c2b, 0x844c, 0x946d, 0xce56, 0xb574, 0xf79d, 0xffdf, 0xf7df, 0xf7df,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0xffdf, 0xf7be, 0xf7be, 0xbdf6, 0x740e, 0xb636, 0xe7bc, 0x63cc, 0x5b6a, 0x9db2, 0x9df2,
+	0x7d0e, 0x854f, 0x9e12, 0x95d1, 0x9df1, 0x9e12, 0x95d1, 0x9e12, 0x8d0f, 0x5327, 0x846d, 0xbdf4, 0x9490, 0xf7de, 0xf7de, 0xf7de,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xf7de, 0xf7be, 0xdf1b, 0x638c, 0x742f, 0x5b6b, 0x3206, 0x6bcc, 0x744d, 0x95d2,
+	0xa613, 0x4b68, 0x9e12, 0x9df2, 0x9df2, 0x9df2, 0x9df2, 0x95d2, 0x9df1, 0x9df2, 0x6c2c, 0x6bab, 0x5b0a, 0xf7bd, 0xf7de, 0xf7de,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0x8c70, 0x6bad, 0x740e, 0x5b6c, 0xadd5, 0x52e9, 0xa5b3, 0xae14,
+	0xadf4, 0x3a86, 0x63cb, 0x63ab, 0x63cc, 0x6bec, 0x6c0d, 0x6c2d, 0x6c4c, 0x6c4d, 0x6c0d, 0x740d, 0x52a9, 0x2964, 0xe71b, 0xffdf,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffde, 0xe73c, 0xceda, 0xefbd, 0xce79, 0x6bad, 0x638c, 0x6bcc,
+	0x6bad, 0xce99, 0xf7de, 0xf7de, 0xef7c, 0xe73b, 0xd6fa, 0xd6da, 0xd6da, 0xd6da, 0xd6da, 0xdefb, 0xe75c, 0xf7be, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf7ff, 0xffff, 0xf7be, 0xf7de, 0xf7fe, 0xf7de,
+	0xffdf, 0xf7de, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xf7df, 0xffff, 0xffdf, 0xffdf, 0xffde, 0xf7de,
+	0xf7de, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffff, 0xf7df, 0xffdf, 0xffdf, 0xffff, 0xffff,
+	0xf7de, 0xffff, 0xf7de, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+	0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
+};
+
+const uint16_t splashGameover[1824] ASSET_FAR = {
+	// spriteGameover de gameoverwin.h, 32x57px (original 64x114)
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0040, 0x0860, 0x0000, 0x0000, 0x0860, 0x2982, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0880,
+	0x8ce6, 0x84c6, 0x6be5, 0x84a5, 0x7445, 0x7c86, 0x3a23, 0x1901, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5b85,
+	0x9dc7, 0x5ba5, 0x9566, 0xa627, 0x8d46, 0xa607, 0xae26, 0xae06, 0x63a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3243, 0x8d67,
+	0x8d27, 0x29e5, 0x8d66, 0xa627, 0xa627, 0x8d06, 0x9e07, 0x95c6, 0x84e6, 0x10e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6425, 0x95a7,
+	0x9e06, 0x9566, 0xa607, 0xa627, 0xa627, 0x9dc6, 0x9e07, 0x9e07, 0x9e07, 0x2182, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x6c66, 0x9de7,
+	0xa626, 0xa627, 0xa627, 0xa627, 0xa627, 0xa627, 0xa627, 0xa627, 0x9e07, 0x1941, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6405, 0xa607,
+	0x7cc6, 0x8d26, 0xa627, 0xa627, 0xa627, 0xa627, 0xa627, 0xa627, 0x8506, 0x0860, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x29e2, 0x9de7,
+	0x95a6, 0x7465, 0x6c45, 0x7466, 0x6c26, 0x6c45, 0x6c45, 0x63c5, 0x1922, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x7ce6,
+	0x8d67, 0x8d67, 0x95a7, 0x95a7, 0x7467, 0x9de7, 0xa607, 0x8526, 0x08a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1101, 0x7cc6,
+	0x9dc6, 0x5ba5, 0x5ba6, 0x5385, 0x4b44, 0x42c4, 0x29c3, 0x0880, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0880, 0x6c26, 0x9de7,
+	0x84e6, 0x63e7, 0x5ba7, 0x2162, 0x29a2, 0x1101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x6c25, 0x9de7, 0x7445,
+	0x7466, 0x5b87, 0x6c46, 0x4b45, 0x5ba5, 0x08a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4b04, 0x95c7, 0x8d46, 0x7ce6,
+	0x5385, 0x6c46, 0x8547, 0x4b45, 0x0880, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x29e3, 0x95c7, 0xa607, 0x9dc6, 0x84e6,
+	0x9de7, 0xa607, 0x8d67, 0x3a84, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0881, 0x10a1, 0x1921, 0x42a3, 0x9586, 0xa627, 0xa627, 0xa627, 0xa627,
+	0xa627, 0x95c7, 0x7d07, 0x3a64, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x63e5, 0x9587, 0x9de7, 0xa5e7, 0x9de7, 0x9de7, 0x9e07, 0x9de7, 0x7445,
+	0x8d87, 0x7d27, 0x5be5, 0x8506, 0x3a23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08c1, 0x6426, 0x7d07, 0x74c7, 0x6c66, 0x7d07, 0x7d07, 0x9dc7, 0x9da6,
+	0x6426, 0x6406, 0x5be6, 0x95a7, 0x4b04, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0x3a64, 0x6406, 0x4b25, 0x74c7, 0x7d07, 0x8d87, 0xa607,
+	0x2a03, 0x4b45, 0x7d27, 0x8d46, 0x1901, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1942, 0x7d07, 0x7d07, 0x9dc7, 0x5b64,
+	0x0020, 0x1962, 0x7d07, 0x5be6, 0x1922, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1901, 0x7ce7, 0x7d07, 0x3a64, 0x0000,
+	0x0000, 0x0860, 0x1921, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2182, 0x21a2, 0x1942, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+#endif
@@ -0,0 +1,366 @@
+#ifndef TinyILI9341_h
+#define TinyILI9341_h
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "SpiPump.h" // con DISPLAY_USART incluye UsartSpi.h
+#include "Font5x7.h"
+
+// Driver minimo del ILI9341 para el env:uno (DISPLAY_TINY) y para el
+// transporte por la USART del Mega (DISPLAY_USART, ver UsartSpi.h).
+//
+// Adafruit GFX + Adafruit ILI9341 ocupan varios KB de flash y traen cosas
+// que el juego no usa (fuentes GFX, circulos, triangulos, SPI por software).
+// Este driver solo tiene lo que llama Display, con los mismos nombres que
+// Adafruit_ILI9341, asi Display no cambia: ventanas de escritura,
+// rectangulos, lineas rectas, bitmaps, texto con la fuente clasica de 5x7
+// y la rotacion y el scroll por hardware del modo de lado.
+//
+// Usa el SPI por hardware (en el Uno MOSI 11, MISO 12, SCK 13, los mismos
+// pines del cableado del Mega), a 8 MHz. CS y DC se mueven directo en el
+// registro del puerto y los rellenos van con SpiPump.h.
+
+#ifndef ILI9341_BLACK
+#define ILI9341_BLACK 0x0000
+#define ILI9341_WHITE 0xFFFF
+#define ILI9341_RED 0xF800
+#define ILI9341_GREEN 0x07E0
+#define ILI9341_BLUE 0x001F
+#define ILI9341_YELLOW 0xFFE0
+#endif
+
+#define ILI9341_TFTWIDTH 240
+#define ILI9341_TFTHEIGHT 320
+
+#define ILI9341_SWRESET 0x01
+#define ILI9341_SLPOUT 0x11
+#define ILI9341_DISPON 0x29
+#define ILI9341_CASET 0x2A
+#define ILI9341_PASET 0x2B
+#define ILI9341_RAMWR 0x2C
+#define ILI9341_VSCRDEF 0x33
+#define ILI9341_MADCTL 0x36
+#define ILI9341_VSCRSADD 0x37
+
+// MADCTL de cada rotacion, los mismos de Adafruit (BGR + MX/MY/MV)
+const uint8_t TINY_ROTATIONS[4] PROGMEM = { 0x48, 0x28, 0x88, 0xE8 };
+
+// secuencia de arranque de Adafruit_ILI9341::begin(): comando, numero de
+// bytes (bit 7: esperar TINY_SLPOUT_MS despues) y los bytes
+const uint8_t TINY_INIT_CMDS[] PROGMEM = {
+    0xEF, 3, 0x03, 0x80, 0x02,
+    0xCF, 3, 0x00, 0xC1, 0x30,
+    0xED, 4, 0x64, 0x03, 0x12, 0x81,
+    0xE8, 3, 0x85, 0x00, 0x78,
+    0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+    0xF7, 1, 0x20,
+    0xEA, 2, 0x00, 0x00,
+    0xC0, 1, 0x23,       // PWCTR1
+    0xC1, 1, 0x10,       // PWCTR2
+    0xC5, 2, 0x3E, 0x28, // VMCTR1
+    0xC7, 1, 0x86,       // VMCTR2
+    0x36, 1, 0x48,       // MADCTL: vertical, BGR
+    0x37, 1, 0x00,       // VSCRSADD
+    0x3A, 1, 0x55,       // 16 bits por pixel
+    0xB1, 2, 0x00, 0x18, // FRMCTR1
+    0xB6, 3, 0x08, 0x82, 0x27,
+    0xF2, 1, 0x00,
+    0x26, 1, 0x01,       // GAMMASET
+    0xE0, 15, 0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1, 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+    0xE1, 15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+    ILI9341_SLPOUT, 0x80,
+    ILI9341_DISPON, 0x00,
+    0x00
+};
+
+// tiempos de la hoja de datos del ILI9341, no los de Adafruit (que espera
+// 150 ms despues de cada paso): tras el reset hay que esperar 5 ms para
+// mandar comandos y 120 ms para SLPOUT, y tras SLPOUT 5 ms. La configuracion
+// se manda mientras corren los 120 ms, asi begin() tarda unos 125 ms y no 700
+#define TINY_RESET_MS 5
+#define TINY_SLEEP_OUT_WAIT_MS 120
+#define TINY_SLPOUT_MS 5
+
+class TinyILI9341 : public Print {
+private:
+    int8_t cs, dc, rst;
+    volatile uint8_t* csPort;
+    volatile uint8_t* dcPort;
+    uint8_t csMask, dcMask;
+    int16_t cursorX, cursorY;
+    uint16_t textColor;
+    uint8_t textSize;
+    int16_t widthPx, heightPx; // cambian con setRotation
+
+public:
+    // mismos argumentos que el constructor de SPI por hardware de Adafruit
+    TinyILI9341(int8_t csPin, int8_t dcPin, int8_t rstPin = -1)
+        : cs(csPin), dc(dcPin), rst(rstPin), csPort(0), dcPort(0), csMask(0), dcMask(0),
+          cursorX(0), cursorY(0), textColor(ILI9341_WHITE), textSize(1),
+          widthPx(ILI9341_TFTWIDTH), heightPx(ILI9341_TFTHEIGHT) {}
+
+    void begin() {
+        csPort = portOutputRegister(digitalPinToPort(cs));
+        csMask = digitalPinToBitMask(cs);
+        dcPort = portOutputRegister(digitalPinToPort(dc));
+        dcMask = digitalPinToBitMask(dc);
+        pinMode(cs, OUTPUT);
+        pinMode(dc, OUTPUT);
+        *csPort |= csMask;
+        *dcPort |= dcMask;
+#ifdef DISPLAY_USART
+        usartSpiBegin();
+#else
+        SPI.begin();
+#endif
+
+        if (rst >= 0) {
+            pinMode(rst, OUTPUT);
+            digitalWrite(rst, LOW);
+            delayMicroseconds(20); // el pulso minimo es de 10 us
+            digitalWrite(rst, HIGH);
+        } else {
+            sendCommand(ILI9341_SWRESET, 0, 0);
+        }
+        unsigned long resetAt = millis();
+        delay(TINY_RESET_MS);
+
+        const uint8_t* p = TINY_INIT_CMDS;
+        uint8_t cmd;
+        while ((cmd = pgm_read_byte(p++)) != 0) {
+            uint8_t n = pgm_read_byte(p++);
+            if (cmd == ILI9341_SLPOUT) {
+                unsigned long waited = millis() - resetAt;
+                if (waited < TINY_SLEEP_OUT_WAIT_MS) {
+                    delay(TINY_SLEEP_OUT_WAIT_MS - waited);
+                }
+            }
+            startWrite();
+            writeCommand(cmd);
+            for (uint8_t i = 0; i < (n & 0x7F); i++) {
+                spiWrite(pgm_read_byte(p++));
+            }
+            endWrite();
+            if (n & 0x80) {
+                delay(TINY_SLPOUT_MS);
+            }
+        }
+    }
+
+    // --- escritura en bloque: startWrite, ventana, pixeles, endWrite ---
+
+    // con la USART los bytes quedan en el buffer: antes de mover CS o DC
+    // hay que esperar a que salga el ultimo (usartSpiFlush)
+#ifdef DISPLAY_USART
+    void startWrite() {
+        *csPort &= ~csMask;
+    }
+
+    void endWrite() {
+        usartSpiFlush();
+        *csPort |= csMask;
+    }
+
+    void writeCommand(uint8_t cmd) {
+        usartSpiFlush();
+        *dcPort &= ~dcMask;
+        usartSpiWrite(cmd);
+        usartSpiFlush();
+        *dcPort |= dcMask;
+    }
+
+    void spiWrite(uint8_t b) {
+        usartSpiWrite(b);
+    }
+
+    inline void SPI_WRITE16(uint16_t w) {
+        usartSpiPut(w >> 8);
+        usartSpiWrite(w);
+    }
+#else
+    void startWrite() {
+        SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE0));
+        *csPort &= ~csMask;
+    }
+
+    void endWrite() {
+        *csPort |= csMask;
+        SPI.endTransaction();
+    }
+
+    void writeCommand(uint8_t cmd) {
+        *dcPort &= ~dcMask;
+        SPI.transfer(cmd);
+        *dcPort |= dcMask;
+    }
+
+    void spiWrite(uint8_t b) {
+        SPI.transfer(b);
+    }
+
+    inline void SPI_WRITE16(uint16_t w) {
+        SPI.transfer(w >> 8);
+        SPI.transfer(w);
+    }
+#endif
+
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+        writeCommand(ILI9341_CASET);
+        SPI_WRITE16(x);
+        SPI_WRITE16(x + w - 1);
+        writeCommand(ILI9341_PASET);
+        SPI_WRITE16(y);
+        SPI_WRITE16(y + h - 1);
+        writeCommand(ILI9341_RAMWR);
+    }
+
+    void writeColor(uint16_t color, uint32_t n) {
+        spiPumpFill(color, n);
+    }
+
+    void sendCommand(uint8_t cmd, const uint8_t* data, uint8_t n) {
+        startWrite();
+        writeCommand(cmd);
+        for (uint8_t i = 0; i < n; i++) {
+            spiWrite(data[i]);
+        }
+        endWrite();
+    }
+
+    // --- rotacion y scroll, como Adafruit_ILI9341 ---
+
+    void setRotation(uint8_t r) {
+        r &= 3;
+        uint8_t madctl = pgm_read_byte(TINY_ROTATIONS + r);
+        sendCommand(ILI9341_MADCTL, &madctl, 1);
+        widthPx = (r & 1) ? ILI9341_TFTHEIGHT : ILI9341_TFTWIDTH;
+        heightPx = (r & 1) ? ILI9341_TFTWIDTH : ILI9341_TFTHEIGHT;
+    }
+
+    // filas fijas arriba y abajo (en la memoria, de 0 a 319); las del medio corren
+    void setScrollMargins(uint16_t top, uint16_t bottom) {
+        if (top + bottom > ILI9341_TFTHEIGHT) {
+            return;
+        }
+        uint16_t middle = ILI9341_TFTHEIGHT - top - bottom;
+        uint8_t data[6] = { (uint8_t)(top >> 8), (uint8_t)top, (uint8_t)(middle >> 8),
+                            (uint8_t)middle, (uint8_t)(bottom >> 8), (uint8_t)bottom };
+        sendCommand(ILI9341_VSCRDEF, data, 6);
+    }
+
+    // fila de la memoria que se ve primero en el area que corre
+    void scrollTo(uint16_t y) {
+        uint8_t data[2] = { (uint8_t)(y >> 8), (uint8_t)y };
+        sendCommand(ILI9341_VSCRSADD, data, 2);
+    }
+
+    // --- dibujo ---
+
+    // como fillRect pero dentro de una transaccion ya abierta (startWrite)
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        // recortar a la pantalla
+        if (x < 0) { w += x; x = 0; }
+        if (y < 0) { h += y; y = 0; }
+        if (x + w > widthPx) { w = widthPx - x; }
+        if (y + h > heightPx) { h = heightPx - y; }
+        if (w <= 0 || h <= 0) {
+            return;
+        }
+        setAddrWindow(x, y, w, h);
+        writeColor(color, (uint32_t)w * h);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        startWrite();
+        writeFillRect(x, y, w, h, color);
+        endWrite();
+    }
+
+    void fillScreen(uint16_t color) {
+        fillRect(0, 0, widthPx, heightPx, color);
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+        fillRect(x, y, 1, 1, color);
+    }
+
+    // el juego solo dibuja lineas horizontales y verticales; las demas
+    // van pixel por pixel
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        if (y0 == y1) {
+            fillRect(min(x0, x1), y0, abs(x1 - x0) + 1, 1, color);
+        } else if (x0 == x1) {
+            fillRect(x0, min(y0, y1), 1, abs(y1 - y0) + 1, color);
+        } else {
+            int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+            int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+            int16_t err = dx + dy;
+            while (true) {
+                drawPixel(x0, y0, color);
+                if (x0 == x1 && y0 == y1) {
+                    break;
+                }
+                int16_t e2 = 2 * err;
+                if (e2 >= dy) { err += dy; x0 += sx; }
+                if (e2 <= dx) { err += dx; y0 += sy; }
+            }
+        }
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        fillRect(x, y, w, 1, color);
+        fillRect(x, y + h - 1, w, 1, color);
+        fillRect(x, y + 1, 1, h - 2, color);
+        fillRect(x + w - 1, y + 1, 1, h - 2, color);
+    }
+
+    // bitmap RGB565 en PROGMEM (con cada pixel)
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
+        for (int16_t j = 0; j < h; j++) {
+            for (int16_t i = 0; i < w; i++) {
+                drawPixel(x + i, y + j, pgm_read_word(bitmap + j * w + i));
+            }
+        }
+    }
+
+    // --- texto: fondo transparente como setTextColor(color) de Adafruit ---
+
+    void setTextColor(uint16_t color) { textColor = color; }
+    void setTextSize(uint8_t size) { textSize = size > 0 ? size : 1; }
+    void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+
+    size_t write(uint8_t c) override {
+        if (c == '\n') {
+            cursorX = 0;
+            cursorY += 8 * textSize;
+            return 1;
+        }
+        if (c < ' ' || c > '~') {
+            return 1;
+        }
+        const uint8_t* glyph = FONT_5X7 + (c - ' ') * 5;
+        for (uint8_t col = 0; col < 5; col++) {
+            uint8_t bits = pgm_read_byte(glyph + col);
+            // cada racha vertical de pixeles encendidos va en un solo rectangulo
+            uint8_t row = 0;
+            while (bits) {
+                if (bits & 1) {
+                    uint8_t len = 0;
+                    while (bits & 1) { bits >>= 1; len++; }
+                    fillRect(cursorX + col * textSize, cursorY + row * textSize,
+                             textSize, len * textSize, textColor);
+                    row += len;
+                } else {
+                    bits >>= 1;
+                    row++;
+                }
+            }
+        }
+        cursorX += 6 * textSize;
+        return 1;
+    }
+
+    using Print::write;
+};
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef TrackGen_h
+#define TrackGen_h
+
+// Generador de la pista del modo sin fin (-DENDLESS).
+// Saca las cosas de la pista (cactus y monedas) una por una y en orden, con
+// un xorshift de 16 bits: la misma semilla da siempre la misma pista. Cada
+// next() cuesta lo mismo, sin ciclos ni tablas, asi que el juego puede pedir
+// una por tick sin que se note en el cuadro. Como GameConfig.h, no incluye
+// nada de Arduino.
+
+#include <stdint.h>
+#include "GameConfig.h"
+
+#ifndef ENDLESS_SEED
+#define ENDLESS_SEED 0xACE1 // cualquiera menos 0
+#endif
+
+enum TrackKind : uint8_t {
+    TRACK_CACTUS,
+    TRACK_COIN
+};
+
+struct TrackSpawn {
+    uint16_t segment; // tramo de la pista, va en el piso segment % NUM_LEVELS
+    int x;
+    uint8_t kind;     // TrackKind
+};
+
+class TrackGen {
+private:
+    uint16_t state;
+    uint16_t segment;
+    int x;
+    int32_t lastCactus; // posicion en la pista (segment * XMAX + x) del ultimo cactus
+
+    // xorshift 7, 9, 8: pasa por los 65535 valores distintos de 0
+    uint16_t rand16() {
+        state ^= state << 7;
+        state ^= state >> 9;
+        state ^= state << 8;
+        return state;
+    }
+
+public:
+    TrackGen() { reset(ENDLESS_SEED); }
+
+    void reset(uint16_t seed) {
+        state = seed ? seed : 1;
+        segment = 0;
+        x = ENDLESS_START_X - ENDLESS_MIN_GAP;
+        lastCactus = -ENDLESS_CACTUS_GAP;
+    }
+
+    // la siguiente cosa de la pista
+    TrackSpawn next() {
+        uint16_t r = rand16();
+        x += ENDLESS_MIN_GAP + (r & 63);
+        if (x > XMAX - SPRITE_SIZE) {
+            segment++;
+            x = ENDLESS_START_X + ((r >> 6) & 31);
+        }
+
+        TrackSpawn s;
+        s.segment = segment;
+        s.x = x;
+        s.kind = TRACK_COIN;
+
+        // los cactus van saliendo mas seguido, pero nunca dos sin lugar para saltar
+        int32_t pos = (int32_t)segment * XMAX + x;
+        int32_t chance = ENDLESS_CACTUS_BASE + (int32_t)segment * ENDLESS_CACTUS_STEP;
+        if (chance > ENDLESS_CACTUS_MAX) {
+            chance = ENDLESS_CACTUS_MAX;
+        }
+        if ((rand16() & 255) < chance && pos - lastCactus >= ENDLESS_CACTUS_GAP) {
+            s.kind = TRACK_CACTUS;
+            lastCactus = pos;
+        }
+        return s;
+    }
+};
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef UsartSpi_h
+#define UsartSpi_h
+
+#include <Arduino.h>
+#include <SPI.h>
+
+// Transporte del display por una USART en modo SPI maestro (MSPIM), con
+// -DDISPLAY_USART (env:usart). Lo usan TinyILI9341.h y SpiPump.h.
+//
+// El SPI normal del AVR tiene un solo registro: el byte siguiente no se
+// puede escribir hasta que salio el anterior, asi que entre byte y byte
+// siempre se pierde algo (SpiPump.h lo deja en 16/17). La USART en MSPIM
+// tiene el transmisor con doble buffer: mientras sale un byte ya se puede
+// dejar el siguiente en UDR, y a fck/2 (UBRR = 0) los bytes salen pegados
+// con un ciclo normal que solo espera UDRE, sin contar ciclos a mano.
+//
+// Lo delicado es DC y CS: UDRE solo dice que hay lugar en el buffer, no que
+// el ultimo byte ya salio; eso lo dice TXC. Antes de mover DC o subir CS se
+// espera a TXC con usartSpiFlush(). TXC se limpia con el ultimo byte de
+// cada tanda, para que un hueco a la mitad (una interrupcion) no lo deje
+// puesto antes de tiempo.
+//
+// Pines con la USART2 (-DTFT_USART=3 para la USART3):
+//   TXD2 (16) -> SDI/MOSI del display, XCK2 -> SCK. RXD2 (17) no se usa.
+// En la placa del Mega ningun XCK sale a un pin: XCK2 es PH2 (pata 14 del
+// chip) y XCK3 es PJ2, hay que soldarles un cable. La USART0 es el Serial y
+// la USART1 saca TXD1 por el 18, que es el boton.
+
+#ifndef TFT_USART
+#define TFT_USART 2
+#endif
+
+#if defined(__AVR__)
+#if !defined(UDR2)
+#error "DISPLAY_USART necesita la USART2 o la USART3 (solo en el Mega)"
+#elif TFT_USART == 2
+#define TU_UDR UDR2
+#define TU_UCSRA UCSR2A
+#define TU_UCSRB UCSR2B
+#define TU_UCSRC UCSR2C
+#define TU_UBRR UBRR2
+#define TU_UDRE UDRE2
+#define TU_TXC TXC2
+#define TU_TXEN TXEN2
+#define TU_MSPIM (_BV(UMSEL21) | _BV(UMSEL20))
+#define TU_XCK_DDR DDRH
+#define TU_XCK_BIT 2
+#elif TFT_USART == 3
+#define TU_UDR UDR3
+#define TU_UCSRA UCSR3A
+#define TU_UCSRB UCSR3B
+#define TU_UCSRC UCSR3C
+#define TU_UBRR UBRR3
+#define TU_UDRE UDRE3
+#define TU_TXC TXC3
+#define TU_TXEN TXEN3
+#define TU_MSPIM (_BV(UMSEL31) | _BV(UMSEL30))
+#define TU_XCK_DDR DDRJ
+#define TU_XCK_BIT 2
+#else
+#error "TFT_USART tiene que ser 2 o 3"
+#endif
+
+// byte al buffer sin limpiar TXC (dentro de una tanda)
+inline void usartSpiPut(uint8_t b) {
+    while (!(TU_UCSRA & _BV(TU_UDRE))) {}
+    TU_UDR = b;
+}
+
+// ultimo byte de una tanda (o uno suelto): limpia TXC para usartSpiFlush.
+// TXC se limpia despues de escribir UDR (con el byte en el buffer TXC no
+// se puede poner por el anterior) y sin interrupciones en el medio (que el
+// byte no alcance a salir antes de limpiarlo)
+inline void usartSpiWrite(uint8_t b) {
+    while (!(TU_UCSRA & _BV(TU_UDRE))) {}
+    uint8_t sreg = SREG;
+    cli();
+    TU_UDR = b;
+    TU_UCSRA = _BV(TU_TXC); // se limpia escribiendo un 1
+    SREG = sreg;
+}
+
+inline void usartSpiFlush() {
+    while (!(TU_UCSRA & _BV(TU_TXC))) {}
+}
+
+inline void usartSpiBegin() {
+    TU_UBRR = 0;
+    TU_XCK_DDR |= _BV(TU_XCK_BIT); // XCK como salida: maestro
+    TU_UCSRC = TU_MSPIM;           // MSPIM, modo 0, MSB primero
+    TU_UCSRB = _BV(TU_TXEN);       // solo transmisor
+    TU_UBRR = 0;                   // fck/2; el datasheet pide ponerlo despues de habilitar
+    // un byte con CS arriba para que TXC quede puesto y el primer flush no se cuelgue
+    usartSpiWrite(0);
+    usartSpiFlush();
+}
+
+inline uint16_t usartSpiReadWord(uint_farptr_t addr) {
+#if defined(__AVR_HAVE_ELPM__)
+    return pgm_read_word_far(addr);
+#else
+    return pgm_read_word((const uint16_t*)(uintptr_t)addr);
+#endif
+}
+#else
+// fuera del AVR (pruebas en la PC) va por SPI.transfer como el resto
+inline void usartSpiPut(uint8_t b) { SPI.transfer(b); }
+inline void usartSpiWrite(uint8_t b) { SPI.transfer(b); }
+inline void usartSpiFlush() {}
+inline void usartSpiBegin() { SPI.begin(); }
+inline uint16_t usartSpiReadWord(uint_farptr_t addr) {
+    return pgm_read_word((const uint16_t*)(uintptr_t)addr);
+}
+#endif
+
+// n pixeles de un color, n >= 1
+inline void usartSpiFill(uint16_t color, uint32_t n) {
+    uint8_t hi = color >> 8, lo = color;
+    while (--n) {
+        usartSpiPut(hi);
+        usartSpiPut(lo);
+    }
+    usartSpiPut(hi);
+    usartSpiWrite(lo);
+}
+
+// n pixeles seguidos de la flash (ver AssetBank.h), n >= 1
+inline void usartSpiStream(uint_farptr_t addr, uint16_t n) {
+    while (--n) {
+        uint16_t w = usartSpiReadWord(addr);
+        addr += 2;
+        usartSpiPut(w >> 8);
+        usartSpiPut(w);
+    }
+    uint16_t w = usartSpiReadWord(addr);
+    usartSpiPut(w >> 8);
+    usartSpiWrite(w);
+}
+
+// n pixeles de la RAM (Compositor.h), n >= 1
+inline void usartSpiPixels(const uint16_t* p, uint16_t n) {
+    while (--n) {
+        usartSpiPut(*p >> 8);
+        usartSpiPut(*p++);
+    }
+    usartSpiPut(*p >> 8);
+    usartSpiWrite(*p);
+}
+
+#endif
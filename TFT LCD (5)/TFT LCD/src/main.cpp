@@ -1,12 +1,84 @@
 
 #include "SPI.h"
+// -DDISPLAY_USART: el display va por la USART2 en modo SPI maestro
+// (UsartSpi.h) con el driver de TinyILI9341.h; MOSI al 16 y SCK a XCK2
+#ifdef DISPLAY_USART
+#define DISPLAY_TINY
+#endif
+// -DSCROLL_WORLD: el modo sin fin de lado, con el scroll por hardware
+#ifdef SCROLL_WORLD
+#define ENDLESS
+#endif
+// -DMUSIC: musica de fondo en el canal de las muestras (MusicPlayer.h)
+#ifdef MUSIC
+#define SAMPLE_AUDIO
+#endif
+#ifdef DISPLAY_TINY
+#include "TinyILI9341.h" // driver recortado para el Uno (env:uno)
+#else
 #include "Adafruit_GFX.h"
 #include "Adafruit_ILI9341.h"
-#include "Sprite.h"
+#endif
+#include "AssetBank.h"
+#ifdef RENDER_QUEUE
+#include "RenderQueue.h" // dibujo en segundo plano con la interrupcion del SPI
+#endif
+#ifdef ASSET_RLE
+#include "AssetsRle.h" // los mismos assets comprimidos, generado por tools/gen_rle.py
+#else
+#include "SpriteAnim.h" // cuadros del dino, generado desde Sprite.h
 #include "Cactus.h"
 #include "Moneda.h"
-#include "fondo.h"
-#include "gameoverwin.h"
+#include "SplashArt.h" // fondo.h y gameoverwin.h a media resolucion
+#endif
+#include "GameConfig.h"
+// lo que sigue se puede sacar para que entre en el Uno (env:uno):
+//   -DNO_TILEMAP         el fondo es negro con las lineas de los pisos
+//   -DNO_MEM_MONITOR     sin canario ni "SIN RAM"
+//   -DNO_SCHEDULER       las tareas en orden en loop(), sin medirlas ni dormir
+//   -DNO_FLIGHT_RECORDER sin caja negra (y sin WATCHDOG)
+//   -DNO_LOG             LOG() no hace nada
+#ifndef NO_TILEMAP
+#include "Tilemap.h" // fondo en cuadritos de 8x8, generado por tools/gen_tilemap.py
+#endif
+#include "JumpPhysics.h"
+#ifndef NO_MEM_MONITOR
+#include "MemMonitor.h"
+#endif
+#include "BootProfile.h"
+#ifndef NO_SCHEDULER
+#include "Scheduler.h"
+#endif
+#ifndef NO_FLIGHT_RECORDER
+#include "FlightRecorder.h" // los cuadros que se pasaron del tope
+#endif
+#ifndef NO_LOG
+#include "Log.h" // mensajes binarios por Serial, sin esperar (tools/log_decode.py)
+#else
+#define LOG(id, ...) do { } while (0)
+#endif
+#ifdef INPUT_LATENCY
+#include "InputLatency.h" // del boton a la pantalla
+#endif
+#ifdef STRIP_COMPOSITOR
+#include "Compositor.h" // regiones sucias armadas en RAM de a tiras
+#endif
+#ifdef ENDLESS
+#include "TrackGen.h" // pista del modo sin fin
+#endif
+#ifdef BENCHMARK
+#include "Benchmark.h"
+#endif
+#ifdef SAMPLE_AUDIO
+#include "SampleAudio.h" // efectos con muestras por PWM
+#include "SoundClips.h"  // generado por tools/gen_sound_clips.py
+#endif
+#ifdef MUSIC
+#include "MusicPlayer.h" // la musica sale de resources/music.txt (tools/gen_music.py)
+#endif
+#ifdef SAVE_GAME
+#include "SaveLog.h" // record y partida guardada en la EEPROM
+#endif
 
 #define TFT_DC 7
 #define TFT_CS 6
@@ -14,69 +86,794 @@
 #define TFT_CLK 13
 #define TFT_RST 10
 #define TFT_MISO 12
+#ifdef SAMPLE_AUDIO
+#define BUZZER_PIN SAMPLE_PIN // tiene que ser OC2B (SampleAudio.h)
+#else
 #define BUZZER_PIN 15
+#endif
+// en el Uno el 18 (A4) no tiene interrupcion, el env:uno pasa -DbotonRight=2
+#ifndef botonRight
 #define botonRight 18
-
-const int XMAX = 240;
-const int YMAX = 320;
+#endif
+
+// Con -DTFT_HW_SPI el Mega usa el SPI por hardware (MOSI 51, SCK 52, MISO 50
+// en vez de 11, 13 y 12) en vez del SPI por software de adafruit. Con el SPI
+// por hardware Display manda los pixeles directo a SPDR (SpiPump.h); con
+// DISPLAY_USART el mismo camino los deja en el buffer de la USART
+#if (defined(DISPLAY_TINY) || defined(TFT_HW_SPI)) && !defined(NO_SPI_PUMP)
+#define DISPLAY_SPDR
+#endif
+
+// -DRENDER_QUEUE: lo que se dibuja en cada cuadro va a una cola que vacia la
+// interrupcion del SPI (RenderQueue.h); necesita el SPI por hardware y que
+// los sprites esten sin comprimir, porque la cola los copia tal cual
+#if defined(RENDER_QUEUE) && (!(defined(DISPLAY_TINY) || defined(TFT_HW_SPI)) || defined(ASSET_RLE) || defined(DISPLAY_USART))
+#error "RENDER_QUEUE necesita DISPLAY_TINY o TFT_HW_SPI y no funciona con ASSET_RLE ni DISPLAY_USART"
+#endif
+
+// -DSTRIP_COMPOSITOR: el dino y lo que se borra se arman con el fondo y lo
+// que haya debajo en un buffer de 3.8 KB (Compositor.h), asi que solo en el
+// Mega; la cola no puede mandar desde la RAM y de lado no hay mapa de fondo
+#if defined(STRIP_COMPOSITOR) && ((defined(__AVR__) && RAMEND < 0x21FF) || defined(RENDER_QUEUE) || defined(SCROLL_WORLD) || defined(NO_TILEMAP))
+#error "STRIP_COMPOSITOR necesita la RAM del Mega y el mapa de fondo, y no funciona con RENDER_QUEUE ni SCROLL_WORLD"
+#endif
+
+// el watchdog lo arma y lo atiende FlightRecorder.h
+#if defined(WATCHDOG) && defined(NO_FLIGHT_RECORDER)
+#error "WATCHDOG esta en FlightRecorder.h: no funciona con NO_FLIGHT_RECORDER"
+#endif
+
+#define MAX_SCALED_WIDTH 64 // ancho maximo de una imagen para drawRGBBitmapScaled (fila en RAM)
+#ifndef REPORT_TICKS
+#define REPORT_TICKS 200 // cada cuantos ticks se manda por Serial el uso de RAM y del SPI
+#endif
+// con -DMEM_HUD ademas se muestra arriba de la pantalla (para depurar)
+#if defined(MEM_HUD) && defined(NO_MEM_MONITOR)
+#error "MEM_HUD necesita MemMonitor.h"
+#endif
 
 // Clase para manejar el display
 class Display { 
     // esta clase encapsula todo lo que se puede hacer en la pantalla
     // sin tner que escribir muchas veces el mismo codigo , solop llamo funciones 
 private:
+#ifdef DISPLAY_TINY
+    TinyILI9341 screen; // SPI por hardware, mismas funciones que la de adafruit
+#else
     Adafruit_ILI9341 screen;// es un atributo, una isntancia de la libreria adafruit 
     // que es la que nos ayuda a graficar todo;
+#endif
+    
+    // Entre beginFrame() y endFrame() todo va en una sola transaccion SPI
+    // con CS abajo; cada funcion solo abre su ventana (CASET, PASET, RAMWR).
+    // Afuera de un cuadro cada funcion abre y cierra la suya como antes.
+    bool inFrame;
+    uint16_t windows;        // ventanas abiertas en el cuadro (3 comandos cada una)
+    uint16_t transactions;   // veces que se bajo CS en el cuadro
+    uint16_t lastWindows;
+    uint16_t lastTransactions;
+    
+    // tamaño de la pantalla (cambia si se acuesta) y columnas donde se puede
+    // dibujar: clipRect recorta a esto
+    int16_t screenW, screenH;
+    int16_t clipX0, clipX1;
+#ifdef SCROLL_WORLD
+    bool worldView; // las x son del mundo que corre (ver setWorldView)
+#endif
+#ifdef INPUT_LATENCY
+    bool stampArmed;  // la proxima ventana anota la hora (stampNextWindow)
+    uint32_t stampUs;
+#endif
+#ifdef STRIP_COMPOSITOR
+    StripCompositor compositor;
+#endif
+    
+#ifdef RENDER_QUEUE
+    // el texto lo pone Display en la cola, asi que lleva su propio cursor
+    int16_t cursorX, cursorY;
+    uint16_t textColor;
+    uint8_t textSize;
+#endif
     
 public:
     // constructoir de la clase 
-    Display() : screen(TFT_CS, TFT_DC, TFT_MOSI, TFT_CLK, TFT_RST, TFT_MISO) {}
+#if defined(DISPLAY_TINY) || defined(TFT_HW_SPI)
+    Display() : screen(TFT_CS, TFT_DC, TFT_RST),
+#else
+    Display() : screen(TFT_CS, TFT_DC, TFT_MOSI, TFT_CLK, TFT_RST, TFT_MISO),
+#endif
+                inFrame(false), windows(0), transactions(0), lastWindows(0), lastTransactions(0),
+                screenW(XMAX), screenH(YMAX), clipX0(0), clipX1(XMAX)
+#ifdef SCROLL_WORLD
+                , worldView(false)
+#endif
+#ifdef INPUT_LATENCY
+                , stampArmed(false), stampUs(0)
+#endif
+    {}
     
     void init() {
         screen.begin(); // este metodo se usa oara inicual la pantalla
+#ifdef RENDER_QUEUE
+        renderQueue.begin(TFT_CS, TFT_DC);
+        cursorX = 0;
+        cursorY = 0;
+        textColor = ILI9341_WHITE;
+        textSize = 1;
+#endif
+    }
+    
+#ifdef RENDER_QUEUE
+    // con la cola no se deja CS abajo todo el cuadro: la cola lo baja cuando
+    // tiene trabajo. Al empezar un cuadro se espera a que el anterior haya
+    // salido entero y se toman sus cuentas
+    void beginFrame() {
+        renderQueue.fence();
+        lastWindows = windows + renderQueue.windows;
+        lastTransactions = transactions + renderQueue.transactions;
+        windows = 0;
+        transactions = 0;
+        renderQueue.windows = 0;
+        renderQueue.transactions = 0;
+    }
+    
+    void endFrame() {
+        // la cola sigue mandando mientras el juego revisa colisiones
+    }
+#else
+    // todo lo que se dibuje hasta endFrame() comparte una transaccion
+    void beginFrame() {
+        windows = 0;
+        transactions = 0;
+        beginWrite();
+        inFrame = true;
+    }
+    
+    void endFrame() {
+        inFrame = false;
+        screen.endWrite();
+        lastWindows = windows;
+        lastTransactions = transactions;
+    }
+#endif
+    
+    // espera a que la pantalla termine lo pendiente (solo hace falta con la cola)
+    void fence() {
+#ifdef RENDER_QUEUE
+        renderQueue.fence();
+#endif
+    }
+    
+#ifdef INPUT_LATENCY
+    // anota micros() al abrir la proxima ventana, cuando ya salio su RAMWR;
+    // con la cola, cuando la interrupcion la empieza
+    void stampNextWindow() {
+#ifdef RENDER_QUEUE
+        renderQueue.stampNext();
+#else
+        stampArmed = true;
+        stampUs = 0;
+#endif
+    }
+    
+    // la hora de esa ventana, 0 si todavia no se abrio
+    uint32_t windowStamp() {
+#ifdef RENDER_QUEUE
+        return renderQueue.stamped();
+#else
+        return stampUs;
+#endif
+    }
+#endif
+    
+    // comandos y transacciones del ultimo cuadro, por Serial
+    void reportFrame(Print& out) {
+        out.print(F("spi cmds="));
+        out.print(lastWindows * 3);
+        out.print(F(" cs="));
+        out.println(lastTransactions);
     }
     
     void fillScreen(uint16_t color) {
-        screen.fillScreen(color);// llena la pantalla de color , lo bueno es que si 
+        fillRect(0, 0, screenW, screenH, color);// llena la pantalla de color , lo bueno es que si 
         // llamamos este metodo podemo susar cualquier color
     }
     
     void fillRect(int x, int y, int w, int h, uint16_t color) {
-        screen.fillRect(x, y, w, h, color);
+#ifdef SCROLL_WORLD
+        if (inWorld(x, w, [&](int mx) { fillRect(mx, y, w, h, color); })) {
+            return;
+        }
+#endif
+#if defined(RENDER_QUEUE)
+        int cx0, cy0, cx1, cy1;
+        if (clipRect(x, y, w, h, cx0, cy0, cx1, cy1)) {
+            renderQueue.fill(x + cx0, y + cy0, cx1 - cx0, cy1 - cy0, color);
+        }
+#elif defined(DISPLAY_SPDR)
+        // una ventana y todos los pixeles seguidos por SPDR (SpiPump.h)
+        int cx0, cy0, cx1, cy1;
+        if (!beginClippedWindow(x, y, w, h, cx0, cy0, cx1, cy1)) {
+            return;
+        }
+        spiPumpFill(color, (uint32_t)(cx1 - cx0) * (cy1 - cy0));
+        endWindow();
+#else
+        int cx0, cy0, cx1, cy1;
+        if (!clipRect(x, y, w, h, cx0, cy0, cx1, cy1)) {
+            return;
+        }
+        beginWrite();
+        countWindow(); // antes: writeFillRect ya manda todos los pixeles
+        screen.writeFillRect(x + cx0, y + cy0, cx1 - cx0, cy1 - cy0, color);
+        endWindow();
+#endif
     }// dibuja un rectangulo de color lo usamos para eliminar la posicion anmterior del dino
     
     void drawRGBBitmap(int x, int y, const uint16_t* bitmap, int w, int h) {
+        suspendFrame();
         screen.drawRGBBitmap(x, y, bitmap, w, h);
+        resumeFrame();
     }// esta dibuja un sprite con una posicion , y un tamaño de pixeles 
     
+    // dibuja una imagen del banco de assets (AssetBank.h) en una sola ventana,
+    // leyendola en orden con AssetStream (ELPM, o RLE en el Uno); recorta lo
+    // que quede fuera de la pantalla saltando esos pixeles
+    void drawRGBBitmapFar(int x, int y, uint_farptr_t bitmap, int w, int h) {
+#ifdef SCROLL_WORLD
+        if (inWorld(x, w, [&](int mx) { drawRGBBitmapFar(mx, y, bitmap, w, h); })) {
+            return;
+        }
+#endif
+        int cx0, cy0, cx1, cy1;
+#ifdef RENDER_QUEUE
+        if (clipRect(x, y, w, h, cx0, cy0, cx1, cy1)) {
+            renderQueue.blit(x + cx0, y + cy0, cx1 - cx0, cy1 - cy0,
+                             bitmap + 2 * (uint32_t)(cy0 * w + cx0), w - (cx1 - cx0));
+        }
+        return;
+#endif
+        if (!beginClippedWindow(x, y, w, h, cx0, cy0, cx1, cy1)) {
+            return;
+        }
+        AssetStream src(bitmap);
+        src.skip(cy0 * w);
+        for (int py = cy0; py < cy1; py++) {
+            src.skip(cx0);
+#ifdef DISPLAY_SPDR
+            src.pump(cx1 - cx0); // la fila entera directo de la flash a SPDR
+#else
+            for (int px = cx0; px < cx1; px++) {
+                screen.SPI_WRITE16(src.next());
+            }
+#endif
+            src.skip(w - cx1);
+        }
+        endWindow();
+    }
+    
+    // dibuja una imagen del banco agrandada `scale` veces (2 o 3) en una sola
+    // ventana: cada fila se lee una vez a RAM y se repite, pixel por pixel y
+    // fila por fila. Recorta lo que quede fuera de la pantalla
+    void drawRGBBitmapScaled(int x, int y, uint_farptr_t bitmap, int w, int h, uint8_t scale) {
+        drawRGBBitmapScaledRows(x, y, bitmap, w, h, scale, 0, h);
+    }
+    
+    // solo las filas [firstRow, firstRow + rows) de la imagen, donde quedan
+    // cuando se dibuja entera en (x, y): para sacarla de a franjas
+    void drawRGBBitmapScaledRows(int x, int y, uint_farptr_t bitmap, int w, int h, uint8_t scale,
+                                 int firstRow, int rows) {
+        uint16_t row[MAX_SCALED_WIDTH];
+        int cx0, cy0, cx1, cy1;
+        rows = min(rows, h - firstRow);
+        if (w > MAX_SCALED_WIDTH || rows <= 0 ||
+            !beginClippedWindow(x, y + firstRow * scale, w * scale, rows * scale, cx0, cy0, cx1, cy1)) {
+            return;
+        }
+        
+        AssetStream src(bitmap);
+        src.skip(firstRow * w);
+        int dy = 0;
+        for (int sy = 0; sy < rows && dy < cy1; sy++) {
+            for (int sx = 0; sx < w; sx++) {
+                row[sx] = src.next();
+            }
+            for (uint8_t r = 0; r < scale; r++, dy++) {
+                if (dy < cy0 || dy >= cy1) {
+                    continue;
+                }
+                int dx = 0;
+                for (int sx = 0; sx < w; sx++) {
+                    for (uint8_t c = 0; c < scale; c++, dx++) {
+                        if (dx >= cx0 && dx < cx1) {
+                            screen.SPI_WRITE16(row[sx]);
+                        }
+                    }
+                }
+            }
+        }
+        endWindow();
+    }
+    
+    // dibuja un cuadro completo de una animacion: el keyframe con el delta del cuadro encima
+    void drawAnimFrame(int x, int y, const SpriteAnim& anim, uint8_t frame) {
+        pushAnimRegion(x, y, anim, frame, 0, 0, anim.w, anim.h);
+    }
+    
+    // cambia de cuadro sin mover el sprite: solo manda el rectangulo que cambia
+    // entre los dos cuadros (la union de sus deltas)
+    void drawAnimDelta(int x, int y, const SpriteAnim& anim, uint8_t from, uint8_t to) {
+        int rx, ry, rw, rh;
+        if (animChangeRect(anim, from, to, rx, ry, rw, rh)) {
+            pushAnimRegion(x, y, anim, to, rx, ry, rw, rh);
+        }
+    }
+    
     void drawLine(int x0, int y0, int x1, int y1, uint16_t color) {
-        screen.drawLine(x0, y0, x1, y1, color);
+        // las horizontales y verticales (el piso) son un rectangulo de 1 px
+        if (y0 == y1) {
+            fillRect(min(x0, x1), y0, abs(x1 - x0) + 1, 1, color);
+        } else if (x0 == x1) {
+            fillRect(x0, min(y0, y1), 1, abs(y1 - y0) + 1, color);
+        } else {
+            suspendFrame();
+            screen.drawLine(x0, y0, x1, y1, color);
+            resumeFrame();
+        }
     }// dibuja una linea entre dos puntos util para el piso
     
     // estas funciones son para escribir los textos 
     void setTextColor(uint16_t color) {
         screen.setTextColor(color);
+#ifdef RENDER_QUEUE
+        textColor = color;
+#endif
     }
     
     void setTextSize(uint8_t size) {
         screen.setTextSize(size);
+#ifdef RENDER_QUEUE
+        textSize = size > 0 ? size : 1;
+#endif
     }
     
     void setCursor(int x, int y) {
         screen.setCursor(x, y);
+#ifdef RENDER_QUEUE
+        cursorX = x;
+        cursorY = y;
+#endif
+    }
+    
+#ifdef RENDER_QUEUE
+    // con la cola cada letra es un comando
+    void print(const char* text) {
+        while (*text) {
+            queueChar(*text++);
+        }
     }
     
+    void print(int value) {
+        char text[7];
+        itoa(value, text, 10);
+        print(text);
+    }
+    
+    void print(const __FlashStringHelper* text) {
+        const char* p = (const char*)text;
+        char c;
+        while ((c = pgm_read_byte(p++)) != 0) {
+            queueChar(c);
+        }
+    }// textos con F("..."): se quedan en la flash y no gastan RAM
+#else
+    // el texto lo dibuja la libreria con sus propias transacciones, asi que
+    // dentro de un cuadro se suelta la del cuadro mientras tanto
     void print(const char* text) {
+        suspendFrame();
         screen.print(text);
+        resumeFrame();
     }
     
     void print(int value) {
+        suspendFrame();
         screen.print(value);
+        resumeFrame();
     }
     
+    void print(const __FlashStringHelper* text) {
+        suspendFrame();
+        screen.print(text);
+        resumeFrame();
+    }// textos con F("..."): se quedan en la flash y no gastan RAM
+#endif
+    
     void drawRect(int x, int y, int w, int h, uint16_t color) {
-        screen.drawRect(x, y, w, h, color);
+        fillRect(x, y, w, 1, color);
+        fillRect(x, y + h - 1, w, 1, color);
+        if (h > 2) {
+            fillRect(x, y + 1, 1, h - 2, color);
+            fillRect(x + w - 1, y + 1, 1, h - 2, color);
+        }
     }// dibuja un rectangulo para los HUD
+    
+    // dibuja el fondo (Tilemap.h) en el rectangulo (x, y, w, h); asi se borra
+    // un sprite sin romper los pisos ni las estrellas. Una sola ventana: cada
+    // fila sale de las filas de los cuadritos que cruza
+    void restoreBackground(int x, int y, int w, int h) {
+#ifdef STRIP_COMPOSITOR
+        // con el compositor debajo no queda solo el fondo: se vuelve a armar
+        // con lo que siga en la escena (quien borra algo lo saca antes)
+        if (compositor.hasScene()) {
+            composeRegion(x, y, w, h);
+            return;
+        }
+#endif
+#ifdef SCROLL_WORLD
+        // de lado no hay mapa: cielo negro y la linea del piso
+        fillRect(x, y, w, h, ILI9341_BLACK);
+        if (y <= SCROLL_FLOOR_Y && SCROLL_FLOOR_Y < y + h) {
+            fillRect(x, SCROLL_FLOOR_Y, w, 1, ILI9341_WHITE);
+        }
+        return;
+#endif
+#ifdef NO_TILEMAP
+        // sin mapa: negro y la linea de cada piso que cruce el rectangulo
+        fillRect(x, y, w, h, ILI9341_BLACK);
+        for (int i = 0; i < FLOOR_COUNT; i++) {
+            int fy = YMAX - FLOOR_OFFSETS[i];
+            if (y <= fy && fy < y + h) {
+                fillRect(x, fy, w, 1, ILI9341_WHITE);
+            }
+        }
+        return;
+#else
+        int cx0, cy0, cx1, cy1;
+#ifdef RENDER_QUEUE
+        if (clipRect(x, y, w, h, cx0, cy0, cx1, cy1)) {
+            queueBackground(x + cx0, y + cy0, x + cx1, y + cy1);
+        }
+        return;
+#endif
+        if (!beginClippedWindow(x, y, w, h, cx0, cy0, cx1, cy1)) {
+            return;
+        }
+        int x0 = x + cx0, x1 = x + cx1;
+        for (int py = y + cy0; py < y + cy1; py++) {
+            const uint8_t* mapRow = TILEMAP + (py / TILE_SIZE) * TILEMAP_COLS;
+            int row = py % TILE_SIZE;
+            for (int px = x0; px < x1;) {
+                int n = min(x1, (px / TILE_SIZE + 1) * TILE_SIZE) - px; // hasta el borde del cuadrito
+                uint8_t tile = pgm_read_byte(mapRow + px / TILE_SIZE);
+                const uint16_t* src = &TILESET[tile][row * TILE_SIZE + px % TILE_SIZE];
+#ifdef DISPLAY_SPDR
+                spiPumpStream((uintptr_t)src, n);
+#else
+                for (int i = 0; i < n; i++) {
+                    screen.SPI_WRITE16(pgm_read_word(src + i));
+                }
+#endif
+                px += n;
+            }
+        }
+        endWindow();
+#endif
+    }
+    
+    // todo el fondo, una vez al empezar; despues solo se restaura lo que se borra
+    void drawBackground() {
+        restoreBackground(0, 0, XMAX, YMAX);
+    }
+    
+#ifdef STRIP_COMPOSITOR
+    // la escena pone las capas de cada region (StripCompositor::setScene)
+    void setScene(StripScene fn, void* ctx) {
+        compositor.setScene(fn, ctx);
+    }
+    
+    // arma el rectangulo (x, y, w, h) de a tiras en la RAM (fondo y capas de
+    // la escena) y lo manda en una sola ventana: cada pixel sale una vez
+    void composeRegion(int x, int y, int w, int h) {
+        int cx0, cy0, cx1, cy1;
+        if (!clipRect(x, y, w, h, cx0, cy0, cx1, cy1)) {
+            return;
+        }
+        x += cx0;
+        y += cy0;
+        w = cx1 - cx0;
+        h = cy1 - cy0;
+        compositor.begin(x, y, w, h);
+        beginWrite();
+        screen.setAddrWindow(x, y, w, h);
+        countWindow();
+        uint8_t stripRows = compositor.stripRows();
+        for (int py = y; py < y + h; py += stripRows) {
+            uint8_t rows = min(stripRows, y + h - py);
+            const uint16_t* strip = compositor.render(py, rows);
+#ifdef DISPLAY_SPDR
+            spiPumpPixels(strip, w * rows);
+#else
+            for (uint16_t i = 0; i < w * rows; i++) {
+                screen.SPI_WRITE16(strip[i]);
+            }
+#endif
+        }
+        endWindow();
+    }
+#endif
+    
+#ifdef SCROLL_WORLD
+    // Modo de lado: la pantalla se acuesta (rotacion 1, 320x240). Asi las
+    // filas de la memoria del ILI9341, que son las que corre el scroll por
+    // hardware (VSCRDEF/VSCRSADD), quedan como columnas: las primeras
+    // SCROLL_AREA corren y las de la derecha quedan fijas para el HUD
+    void beginScroll() {
+        suspendFrame();
+        screen.setRotation(1);
+        screen.setScrollMargins(0, SCROLL_HUD_W);
+        screen.scrollTo(0);
+        resumeFrame();
+        screenW = SCROLL_W;
+        screenH = SCROLL_H;
+        setWorldView(false);
+    }
+    
+    // de vuelta a la pantalla parada, para las pantallas de fin
+    void endScroll() {
+        suspendFrame();
+        screen.scrollTo(0);
+        screen.setScrollMargins(0, 0);
+        screen.setRotation(0);
+        resumeFrame();
+        screenW = XMAX;
+        screenH = YMAX;
+        setWorldView(false);
+    }
+    
+    // la columna del mundo `x` queda en el borde izquierdo: un solo comando
+    void scrollTo(int x) {
+        suspendFrame();
+        screen.scrollTo(x & (SCROLL_AREA - 1));
+        resumeFrame();
+    }
+    
+    // con la vista del mundo prendida las x son del mundo: la columna x va a
+    // la x & (SCROLL_AREA - 1) de la memoria, y lo que pasa del final del
+    // area sigue al principio. Apagada son de la pantalla (el HUD)
+    void setWorldView(bool on) {
+        worldView = on;
+        clipX0 = 0;
+        clipX1 = on ? SCROLL_AREA : screenW;
+    }
+    
+    // en la vista del mundo solo se dibuja en las columnas [x0, x1) del
+    // mundo, que no pueden cruzar un multiplo de SCROLL_AREA
+    void setWorldClip(int x0, int x1) {
+        clipX0 = x0 & (SCROLL_AREA - 1);
+        clipX1 = clipX0 + (x1 - x0);
+    }
+#endif
+    
+private:
+    // manda la region (rx, ry, rw, rh) del cuadro `frame` en una sola ventana;
+    // cada pixel sale del delta si cae dentro de el, si no del keyframe.
+    // El keyframe se lee en orden (puede venir en RLE) y lo que no se manda
+    // se salta. Recorta lo que quede fuera de la pantalla
+    void pushAnimRegion(int x, int y, const SpriteAnim& anim, uint8_t frame,
+                        int rx, int ry, int rw, int rh) {
+#ifdef SCROLL_WORLD
+        if (inWorld(x, anim.w, [&](int mx) { pushAnimRegion(mx, y, anim, frame, rx, ry, rw, rh); })) {
+            return;
+        }
+#endif
+        AnimDelta d;
+        memcpy_P(&d, &anim.deltas[frame], sizeof(d));
+        
+        int cx0, cy0, cx1, cy1;
+#ifdef RENDER_QUEUE
+        if (!clipRect(x + rx, y + ry, rw, rh, cx0, cy0, cx1, cy1)) {
+            return;
+        }
+        cx0 += rx; cx1 += rx;
+        cy0 += ry; cy1 += ry;
+        queueAnimRegion(x, y, anim, d, cx0, cy0, cx1, cy1);
+        return;
+#endif
+        if (!beginClippedWindow(x + rx, y + ry, rw, rh, cx0, cy0, cx1, cy1)) {
+            return;
+        }
+        cx0 += rx; cx1 += rx;
+        cy0 += ry; cy1 += ry;
+        AssetStream key((uint_farptr_t)(uintptr_t)anim.key);
+        key.skip(cy0 * anim.w);
+        for (int py = cy0; py < cy1; py++) {
+            key.skip(cx0);
+            bool inDeltaRow = py >= d.y && py < d.y + d.h;
+            for (int px = cx0; px < cx1; px++) {
+                uint16_t color = key.next();
+                if (inDeltaRow && px >= d.x && px < d.x + d.w) {
+                    color = pgm_read_word(d.pixels + (py - d.y) * d.w + (px - d.x));
+                }
+                screen.SPI_WRITE16(color);
+            }
+            key.skip(anim.w - cx1);
+        }
+        endWindow();
+    }
+    
+#ifdef RENDER_QUEUE
+    // la cola solo copia rectangulos de la flash: la region (en coordenadas
+    // del sprite) se parte en el pedazo que sale del delta y hasta cuatro
+    // pedazos del keyframe alrededor
+    void queueAnimRegion(int x, int y, const SpriteAnim& anim, const AnimDelta& d,
+                         int cx0, int cy0, int cx1, int cy1) {
+        int dx0 = max(cx0, (int)d.x);
+        int dy0 = max(cy0, (int)d.y);
+        int dx1 = min(cx1, d.x + d.w);
+        int dy1 = min(cy1, d.y + d.h);
+        if (dx0 >= dx1 || dy0 >= dy1) {
+            queueKeyRect(x, y, anim, cx0, cy0, cx1, cy1);
+            return;
+        }
+        queueKeyRect(x, y, anim, cx0, cy0, cx1, dy0); // arriba
+        queueKeyRect(x, y, anim, cx0, dy0, dx0, dy1); // izquierda
+        renderQueue.blit(x + dx0, y + dy0, dx1 - dx0, dy1 - dy0,
+                         (uintptr_t)(d.pixels + (dy0 - d.y) * d.w + (dx0 - d.x)), d.w - (dx1 - dx0));
+        queueKeyRect(x, y, anim, dx1, dy0, cx1, dy1); // derecha
+        queueKeyRect(x, y, anim, cx0, dy1, cx1, cy1); // abajo
+    }
+    
+#ifndef NO_TILEMAP
+    // el fondo de (x0, y0)-(x1, y1), un pedazo de cuadrito por comando
+    void queueBackground(int x0, int y0, int x1, int y1) {
+        for (int ty = y0 / TILE_SIZE; ty * TILE_SIZE < y1; ty++) {
+            int ry0 = max(y0, ty * TILE_SIZE);
+            int ry1 = min(y1, ty * TILE_SIZE + TILE_SIZE);
+            for (int tx = x0 / TILE_SIZE; tx * TILE_SIZE < x1; tx++) {
+                int rx0 = max(x0, tx * TILE_SIZE);
+                int rx1 = min(x1, tx * TILE_SIZE + TILE_SIZE);
+                uint8_t tile = pgm_read_byte(TILEMAP + ty * TILEMAP_COLS + tx);
+                renderQueue.blit(rx0, ry0, rx1 - rx0, ry1 - ry0,
+                                 (uintptr_t)&TILESET[tile][(ry0 % TILE_SIZE) * TILE_SIZE + rx0 % TILE_SIZE],
+                                 TILE_SIZE - (rx1 - rx0));
+            }
+        }
+    }
+#endif
+    
+    void queueKeyRect(int x, int y, const SpriteAnim& anim, int x0, int y0, int x1, int y1) {
+        if (x0 < x1 && y0 < y1) {
+            renderQueue.blit(x + x0, y + y0, x1 - x0, y1 - y0,
+                             (uintptr_t)(anim.key + y0 * anim.w + x0), anim.w - (x1 - x0));
+        }
+    }
+    
+    // como Adafruit_GFX::write: salto de linea, pasa a la linea siguiente si
+    // no cabe y avanza el cursor. Lo que no esta en FONT_5X7 o no cabe
+    // entero en la pantalla lo dibuja la libreria despues de vaciar la cola
+    void queueChar(char c) {
+        if (c == '\n') {
+            cursorX = 0;
+            cursorY += 8 * textSize;
+            return;
+        }
+        if (c == '\r') {
+            return;
+        }
+        if (cursorX + 6 * textSize > screenW) {
+            cursorX = 0;
+            cursorY += 8 * textSize;
+        }
+        if (c >= ' ' && c <= '~' && cursorX >= 0 && cursorY >= 0 && cursorY + 8 * textSize <= screenH) {
+            renderQueue.glyph(cursorX, cursorY, c, textSize, textColor);
+        } else {
+            renderQueue.fence();
+            screen.setCursor(cursorX, cursorY);
+            screen.write(c);
+        }
+        cursorX += 6 * textSize;
+    }
+#endif
+    
+    // abre la transaccion si no hay un cuadro abierto
+    void beginWrite() {
+        fence(); // con la cola: lo que va directo espera a que se vacie
+        if (!inFrame) {
+            screen.startWrite();
+            transactions++;
+        }
+    }
+    
+    // cierra la transaccion si no hay un cuadro abierto
+    void endWindow() {
+        if (!inFrame) {
+            screen.endWrite();
+        }
+    }
+    
+    // para lo que la libreria dibuja con sus propias transacciones
+    void suspendFrame() {
+        fence();
+        if (inFrame) {
+            screen.endWrite();
+        }
+    }
+    
+    void resumeFrame() {
+        if (inFrame) {
+            screen.startWrite();
+            transactions++;
+        }
+    }
+    
+#ifdef SCROLL_WORLD
+    // en la vista del mundo dibuja con draw(columna de la memoria), y otra
+    // vez una vuelta antes si el dibujo pasa del final del area; false si
+    // la vista esta apagada y las x ya son de la pantalla
+    template <class F>
+    bool inWorld(int x, int w, F draw) {
+        if (!worldView) {
+            return false;
+        }
+        worldView = false;
+        int mx = x & (SCROLL_AREA - 1);
+        draw(mx);
+        if (mx + w > SCROLL_AREA) {
+            draw(mx - SCROLL_AREA);
+        }
+        worldView = true;
+        return true;
+    }
+#endif
+    
+    // recorta el rectangulo (x, y, w, h) a la pantalla (a las columnas
+    // clipX0..clipX1): deja en cx0..cx1, cy0..cy1 la parte visible relativa
+    // a (x, y); false si no se ve nada
+    bool clipRect(int x, int y, int w, int h, int& cx0, int& cy0, int& cx1, int& cy1) {
+        cx0 = max(0, clipX0 - x);
+        cy0 = max(0, -y);
+        cx1 = min(w, clipX1 - x);
+        cy1 = min(h, screenH - y);
+        return cx0 < cx1 && cy0 < cy1;
+    }
+    
+    // como clipRect, y si algo queda visible abre la ventana de escritura.
+    // Quien llama cierra con endWindow()
+    bool beginClippedWindow(int x, int y, int w, int h, int& cx0, int& cy0, int& cx1, int& cy1) {
+        if (!clipRect(x, y, w, h, cx0, cy0, cx1, cy1)) {
+            return false;
+        }
+        beginWrite();
+        screen.setAddrWindow(x + cx0, y + cy0, cx1 - cx0, cy1 - cy0);
+        countWindow();
+        return true;
+    }
+    
+    // despues de abrir una ventana (CASET, PASET y RAMWR)
+    void countWindow() {
+        windows++;
+#ifdef INPUT_LATENCY
+        if (stampArmed) {
+            stampArmed = false;
+            stampUs = micros() | 1;
+        }
+#endif
+    }
+};
+
+// melodias con tone() (sin -DSAMPLE_AUDIO): cada nota suena toneMs y la
+// siguiente empieza stepMs despues. Las toca SoundManager::update()
+struct ToneNote {
+    uint16_t hz;
+    uint16_t toneMs;
+    uint16_t stepMs;
+};
+
+// tone() corta la nota anterior: 500 Hz un momento y despues 250
+const ToneNote GAMEOVER_NOTES[] PROGMEM = { { 500, 800, 100 }, { 250, 800, 800 } };
+const ToneNote VICTORY_NOTES[] PROGMEM = {
+    { 400, 80, 100 }, { 500, 80, 100 }, { 600, 80, 100 }, { 700, 80, 100 },
+    { 800, 80, 100 }, { 900, 80, 100 }, { 1000, 80, 100 }
 };
 
 // Clase para manejar sonidos
@@ -84,33 +881,96 @@ class SoundManager {
 private:
     int buzzerPin;// es una propiedad privada que va a guardar el numero del pin donde esta el buzzer 
     // es privado para usarse solo dentro de esta clase
+    const ToneNote* melody; // nota que sigue, 0 si no hay melodia
+    uint8_t notesLeft;
+    unsigned long nextNoteMs;
+    
+    void playMelody(const ToneNote* notes, uint8_t count) {
+        melody = notes;
+        notesLeft = count;
+        nextNoteMs = millis();
+        update(); // la primera nota ya
+    }
+    
 public:
-    SoundManager(int pin) : buzzerPin(pin) {}// constructor de la clase
+    SoundManager(int pin) : buzzerPin(pin), melody(0), notesLeft(0), nextNoteMs(0) {}// constructor de la clase
+    
+    // la tarea del audio: cambia de nota cuando toca, sin esperar
+    void update() {
+        if (!melody || (long)(millis() - nextNoteMs) < 0) {
+            return;
+        }
+        if (notesLeft == 0) {
+            noTone(buzzerPin);
+            melody = 0;
+            return;
+        }
+        ToneNote n;
+        memcpy_P(&n, melody++, sizeof(n));
+        notesLeft--;
+        tone(buzzerPin, n.hz, n.toneMs);
+        nextNoteMs += n.stepMs;
+    }
+    
+    // con -DSAMPLE_AUDIO los efectos son clips (SoundClips.h) que suenan
+    // solos desde la interrupcion; si no, las melodias las va tocando
+    // update(). Ninguno espera con delay()
+    void begin() {
+#ifdef SAMPLE_AUDIO
+        sampleAudio.begin();
+#endif
+    }
     
     void playCollisionSound() {//choco contra el cactus
+#ifdef SAMPLE_AUDIO
+        sampleAudio.play(&CLIP_HIT);
+        return;
+#endif
         tone(buzzerPin, 300, 200); //pin, Hz, milisegundos
     }
     
     void playCoinSound() {
+#ifdef SAMPLE_AUDIO
+        sampleAudio.play(&CLIP_COIN);
+        return;
+#endif
         tone(buzzerPin, 1000, 150);
     }
     
     void playGameOverSound() {
-        tone(buzzerPin, 500, 800);
-        delay(100);
-        tone(buzzerPin, 250, 800);
-        // se ejecutan dos tonos 
+#ifdef SAMPLE_AUDIO
+        sampleAudio.play(&CLIP_GAMEOVER);
+        return;
+#endif
+        playMelody(GAMEOVER_NOTES, sizeof(GAMEOVER_NOTES) / sizeof(ToneNote)); // dos tonos
     }
     
     void playVictorySound() {
-        for (int freq = 400; freq <= 1000; freq += 100) {
-            tone(buzzerPin, freq, 80);
-            delay(100);
-        }
-        noTone(buzzerPin);
+#ifdef SAMPLE_AUDIO
+        sampleAudio.play(&CLIP_VICTORY);
+        return;
+#endif
+        playMelody(VICTORY_NOTES, sizeof(VICTORY_NOTES) / sizeof(ToneNote)); // de 400 a 1000 Hz
     }
     
+#ifdef MUSIC
+    // la musica sigue sola desde la interrupcion; los efectos le quitan el
+    // canal mientras suenan
+    void startMusic() {
+        musicPlayer.start();
+    }
+    
+    void stopMusic() {
+        musicPlayer.stop();
+    }
+#endif
+    
     void stopSound() {
+#ifdef SAMPLE_AUDIO
+        sampleAudio.stop();
+        return;
+#endif
+        melody = 0;
         noTone(buzzerPin);//detiene cualquier sonido
     }
 };
@@ -159,9 +1019,9 @@ private:
     int lastX, lastY; // guardan la posicion anterior del jugador
     // para qeu se pueda borrar la posicion anterior 
     int frame; // el dino
-    bool isJumping;
-    int jumpHeight;
-    int fallSpeed;// velocidad con la que cae despues de saltar
+    int lastFrame; // cuadro que esta en pantalla
+    int animTicks; // las patitas cambian cada 2 ticks
+    DinoMotion motion; // posicion y velocidad en punto fijo (JumpPhysics.h), x y y salen de aqui
     int currentLevel;
     int* floorLevels;// puntero al array con las alturas de los pisos 
     Display* display;//puntero al display para dibujar o borrar los sprites 
@@ -169,60 +1029,140 @@ private:
 public:
     DinoPlayer(int startX, int startY, int* floors, Display* disp) 
         : GameObject(startX, startY), lastX(startX), lastY(startY), 
-          frame(0), isJumping(false), jumpHeight(58), fallSpeed(13),
-          currentLevel(0), floorLevels(floors), display(disp) {}// tiene su propio constructor
+          frame(0), lastFrame(0), animTicks(0), currentLevel(0), floorLevels(floors), display(disp) {
+        motionPlace(motion, startX, startY);
+    }// tiene su propio constructor
     
     void draw(Display& display) override { //sobreescribe dek metodo draw de l a clase padre
-        // Borrar posición anterior
-        display.fillRect(lastX, lastY, width, height, ILI9341_BLACK);
+#ifdef STRIP_COMPOSITOR
+        composeDraw(display);
+        return;
+#endif
+        // si no se movio (en la pausa del piso nuevo, Game::standStep) solo
+        // se mandan las filas de las patitas que cambian. Moviendose no
+        // sirve: cada pixel de la ventana nueva cambia, y sale el cuadro entero
+        if (x == lastX && y == lastY) {
+            if (frame != lastFrame) {
+                display.drawAnimDelta(x, y, dinoAnim, lastFrame, frame);
+                lastFrame = frame;
+            }
+            return;
+        }
         
-        // Dibujar en nueva posición
-        //los :: significa que Player esta en un mabito global , fuera 
-        // de cualquier espacio o clase 
-        display.drawRGBBitmap(x, y, ::Player[frame], width, height);
+        // Borrar posición anterior: como el sprite nuevo tapa lo que se cruza con
+        // el viejo, solo se borran las franjas que quedan descubiertas, y se
+        // borran con el fondo que tenian debajo (Tilemap.h)
+        int dx = x - lastX;
+        int dy = y - lastY;
+        if (abs(dx) >= width || abs(dy) >= height) {
+            display.restoreBackground(lastX, lastY, width, height);
+        } else {
+            if (dx > 0) display.restoreBackground(lastX, lastY, dx, height);
+            if (dx < 0) display.restoreBackground(x + width, lastY, -dx, height);
+            if (dy > 0) display.restoreBackground(lastX, lastY, width, dy);
+            if (dy < 0) display.restoreBackground(lastX, y + height, width, -dy);
+        }
+        
+        // Dibujar en nueva posición: keyframe + delta del cuadro (SpriteAnim.h)
+        display.drawAnimFrame(x, y, dinoAnim, frame);
         
         // Actualizar última posición
         lastX = x;
         lastY = y;
+        lastFrame = frame;
+    }
+    
+#ifdef STRIP_COMPOSITOR
+    // Con el compositor el dino es la capa de arriba de la escena (addLayer)
+    // y se vuelve a armar lo que cambio: donde estaba y donde esta, juntos si
+    // se tocan. Primero se anota la posicion nueva, asi el lugar viejo sale
+    // sin el dino y con lo que tenia debajo (monedas, cactus, el piso)
+    void composeDraw(Display& display) {
+        if (x == lastX && y == lastY) {
+            int rx, ry, rw, rh;
+            bool changed = frame != lastFrame && animChangeRect(dinoAnim, lastFrame, frame, rx, ry, rw, rh);
+            lastFrame = frame;
+            if (changed) {
+                display.composeRegion(x + rx, y + ry, rw, rh);
+            }
+            return;
+        }
+        int oldX = lastX, oldY = lastY;
+        lastX = x;
+        lastY = y;
+        lastFrame = frame;
+        if (abs(x - oldX) < width && abs(y - oldY) < height) {
+            display.composeRegion(min(x, oldX), min(y, oldY), width + abs(x - oldX), height + abs(y - oldY));
+        } else {
+            display.composeRegion(oldX, oldY, width, height);
+            display.composeRegion(x, y, width, height);
+        }
+    }
+    
+    // el dino como esta en la pantalla
+    void addLayer(StripCompositor& comp) const {
+        comp.addAnim(lastX, lastY, dinoAnim, lastFrame);
+    }
+#endif
+    
+    // el cuadro que sigue de la animacion, sin moverse
+    void animate() {
+        animTicks++;
+        frame = (animTicks >> 1) & 1;// va a cmabiar entre los dos sprites del dino para que 
+        // se vea el movimineto de las patitas
     }
     
     void update() override {
         // Actualizar animación
-        frame = (frame + 1) % 2;// va a cmabiar entre los dos sprites del dino para que 
-        // se vea el movimineto de las patitas
+        animate();
         
-        // Manejar física de salto
-        if (isJumping && y < floorLevels[currentLevel] - height) {
-            display->fillRect(x, y, width, height, ILI9341_BLACK);
-            y += fallSpeed;// si esta saltando y no ha llegado al piso lo hace caer
-            lastY = y;
-        } else {
-            isJumping = false;// si toco el suelo temrina el salto , por lo que cambia su estado 
-            y = floorLevels[currentLevel] - height;// ajista la posiciom exacta ak salto
-        }
+        // Manejar física de salto: sigue la tabla del salto y cae hasta el piso
+        motionFall(motion, toFixed(floorLevels[currentLevel] - height));
+        y = fixedToPx(motion.y);
     }
     
     void moveRight() {
-        x += 10; // se movera solo 10 px esto lo puedo ajustar
+        motionAdvance(motion); // 5 px por tick, un poco mas en el aire (JumpPhysics.h)
+        x = fixedToPx(motion.x);
     }
     
-    void jump() {
-        // si no esta saltando inicia el salto
-        if (!isJumping) {
-            isJumping = true;
-            display->fillRect(x, y, width, height, ILI9341_BLACK);// lo borra de  la pantalla
-            y -= jumpHeight;
-            x += 50;
-            lastY = y;
-            lastX = x;
-        }
+    // true si empezo un salto (no estaba ya en el aire)
+    bool jump() {
+        // si no esta saltando inicia el salto, la subida la hace update()
+        bool started = !motion.jumping;
+        motionJump(motion);
+        return started;
+    }
+    
+    void setPosition(int newX, int newY) {
+        GameObject::setPosition(newX, newY);
+        motionPlace(motion, newX, newY);
     }
     
     void resetPosition() {
-        x = 0;
-        y = floorLevels[currentLevel] - height;// en el suelo del nivek que estaba 
-        isJumping = false;
+        setPosition(0, floorLevels[currentLevel] - height);// en el suelo del nivek que estaba 
     }
+    
+    // como recien construido, para otra partida (Game::resetGame); en otro
+    // piso si se sigue una partida guardada
+    void restart(int level = 0) {
+        currentLevel = level;
+        resetPosition();
+        lastX = x;
+        lastY = y;
+        frame = 0;
+        lastFrame = 0;
+        animTicks = 0;
+    }
+    
+#ifdef SCROLL_WORLD
+    // corre al dino sin tocar el salto (cuando el mundo vuelve atras, ver Game::rebaseWorld)
+    void shiftX(int dx) {
+        motion.x += toFixed(dx);
+        x += dx;
+        lastX += dx;
+    }
+#endif
     // aceder a las propiedades privadas de la clase padrepara cambiar el nivel , retornat el nivel
     // y que continue al siguiente nivel si llego a XMAX
     void setCurrentLevel(int level) {
@@ -238,7 +1178,10 @@ public:
     }
     
     void clearFromScreen() {
-        display->fillRect(x, y, width, height, ILI9341_BLACK);
+#ifdef STRIP_COMPOSITOR
+        return; // el lugar viejo lo vuelve a armar composeDraw
+#endif
+        display->restoreBackground(x, y, width, height);
     }// borra al jugador de la posicion actual para que pase al sgt nivel
 };
 
@@ -248,15 +1191,27 @@ private:
     bool isActive;
     
 public:
-    Obstacle(int startX, int startY) : GameObject(startX, startY), isActive(true) {}
+    Obstacle(int startX = 0, int startY = 0) : GameObject(startX, startY), isActive(true) {}
     
     virtual ~Obstacle() {} // Destructor virtual
     
     void draw(Display& display) override {
         if (isActive) {
-            display.drawRGBBitmap(x, y, spriteCactus, width, height);
+#ifdef STRIP_COMPOSITOR
+            display.composeRegion(x, y, width, height); // ya esta en la escena
+#else
+            display.drawRGBBitmapFar(x, y, ASSET_ADDR(spriteCactus), width, height);
+#endif
+        }
+    }
+    
+#ifdef STRIP_COMPOSITOR
+    void addLayer(StripCompositor& comp) const {
+        if (isActive) {
+            comp.addSprite(x, y, width, height, ASSET_ADDR(spriteCactus));
         }
     }
+#endif
     
     bool isActiveObstacle() const {
         return isActive;
@@ -273,20 +1228,32 @@ private:
     bool isCollected;
     
 public:
-    Coin(int startX, int startY) : GameObject(startX, startY), isCollected(false) {}
+    Coin(int startX = 0, int startY = 0) : GameObject(startX, startY), isCollected(false) {}
     
     virtual ~Coin() {} // Destructor virtual
     
     void draw(Display& display) override {
         if (!isCollected) {
-            display.drawRGBBitmap(x, y, spriteMoneda, width, height);
+#ifdef STRIP_COMPOSITOR
+            display.composeRegion(x, y, width, height);
+#else
+            display.drawRGBBitmapFar(x, y, ASSET_ADDR(spriteMoneda), width, height);
+#endif
         }
     }
     
+#ifdef STRIP_COMPOSITOR
+    void addLayer(StripCompositor& comp) const {
+        if (!isCollected) {
+            comp.addSprite(x, y, width, height, ASSET_ADDR(spriteMoneda));
+        }
+    }
+#endif
+    
     void collect(Display& display) {
         if (!isCollected) {
             isCollected = true;
-            display.fillRect(x, y, width, height, ILI9341_BLACK);
+            display.restoreBackground(x, y, width, height);
             x = -100; // Mover fuera de pantalla
         }
     }
@@ -294,8 +1261,254 @@ public:
     bool isCollectedCoin() const {
         return isCollected;
     }
+    
+    // ya estaba agarrada en la partida guardada: no se dibuja
+    void markCollected() {
+        isCollected = true;
+        x = -100;
+    }
+};
+
+#ifdef ENDLESS
+// Anillo de tamaño fijo: las cosas entran al final en el orden de la pista y
+// se reciclan desde el principio cuando el dino ya las dejo atras, asi la
+// memoria es la misma por mas larga que sea la partida. N potencia de 2
+template <class T, uint8_t N>
+class RecycleRing {
+private:
+    T items[N];
+    uint16_t segments[N]; // tramo de cada una
+    uint8_t first, count;
+    
+public:
+    RecycleRing() : first(0), count(0) {}
+    
+    uint8_t size() const { return count; }
+    bool isFull() const { return count == N; }
+    T& at(uint8_t i) { return items[(first + i) & (N - 1)]; } // 0 es la mas vieja
+    uint16_t segmentAt(uint8_t i) const { return segments[(first + i) & (N - 1)]; }
+    
+    // el lugar que se recicla; quien llama lo llena
+    T& push(uint16_t segment) {
+        uint8_t i = (first + count) & (N - 1);
+        count++;
+        segments[i] = segment;
+        return items[i];
+    }
+    
+    void pop() {
+        first = (first + 1) & (N - 1);
+        count--;
+    }
+    
+    void clear() {
+        first = 0;
+        count = 0;
+    }
 };
 
+// Pista del modo sin fin: lo que saca TrackGen va a un anillo de cactus y a
+// uno de monedas. Cada tick step() hace un solo paso: borra algo de un tramo
+// que ya quedo atras o pone lo siguiente si su tramo ya se ve (los tres
+// pisos son los tramos del dino y los dos que siguen). Asi nunca se dibuja
+// mas de un sprite de la pista por cuadro.
+class EndlessTrack {
+private:
+    TrackGen gen;
+    TrackSpawn pending; // lo siguiente de la pista, esperando a que se vea su tramo
+    RecycleRing<Obstacle, ENDLESS_CACTUS_SLOTS> cactus;
+    RecycleRing<Coin, ENDLESS_COIN_SLOTS> coins;
+    int* floorLevels;
+#ifdef SCROLL_WORLD
+    int32_t worldBase; // lo que ya se resto a las x (Game::rebaseWorld)
+#endif
+    
+    int floorY(uint16_t segment) const {
+        return floorLevels[segment % NUM_LEVELS] - SPRITE_SIZE;
+    }
+    
+    // de lado los tramos van uno detras de otro en el mismo piso; la pista
+    // empieza una pantalla a la derecha del dino
+    int worldX(const TrackSpawn& s) const {
+#ifdef SCROLL_WORLD
+        return (int)((int32_t)s.segment * XMAX + s.x + SCROLL_AREA - worldBase);
+#else
+        return s.x;
+#endif
+    }
+    
+    // si una cosa del tramo `a` puede tocar al dino que va en el tramo `b`
+    static bool sameFloor(uint16_t a, uint16_t b) {
+#ifdef SCROLL_WORLD
+        (void)a;
+        (void)b;
+        return true; // un solo piso
+#else
+        return a == b;
+#endif
+    }
+    
+public:
+    EndlessTrack(int* floors) : floorLevels(floors) {
+        reset();
+    }
+    
+    void reset() {
+#ifdef SCROLL_WORLD
+        worldBase = 0;
+#endif
+        gen.reset(ENDLESS_SEED);
+        pending = gen.next();
+        cactus.clear();
+        coins.clear();
+    }
+    
+    // false si no habia nada que hacer
+    bool step(Display& display, uint16_t playerSegment) {
+        // primero reciclar: lo nuevo puede ir al piso de lo que se borra
+        // (se saca del anillo antes de borrarlo: con el compositor lo que
+        // se borra se arma con lo que sigue en la pista)
+        if (cactus.size() && cactus.segmentAt(0) < playerSegment) {
+            Obstacle old = cactus.at(0);
+            cactus.pop();
+            display.restoreBackground(old.getX(), old.getY(), old.getWidth(), old.getHeight());
+            return true;
+        }
+        if (coins.size() && coins.segmentAt(0) < playerSegment) {
+            Coin old = coins.at(0);
+            coins.pop();
+            if (!old.isCollectedCoin()) {
+                display.restoreBackground(old.getX(), old.getY(), old.getWidth(), old.getHeight());
+            }
+            return true;
+        }
+        
+        if (pending.segment >= playerSegment + NUM_LEVELS) {
+            return false; // su piso todavia lo ocupa un tramo de antes
+        }
+        if (pending.kind == TRACK_CACTUS) {
+            if (cactus.isFull()) {
+                return false;
+            }
+            Obstacle& o = cactus.push(pending.segment);
+            o = Obstacle(worldX(pending), floorY(pending.segment));
+            o.draw(display);
+        } else {
+            if (coins.isFull()) {
+                return false;
+            }
+            Coin& c = coins.push(pending.segment);
+            c = Coin(worldX(pending), floorY(pending.segment));
+            c.draw(display);
+        }
+        pending = gen.next();
+        return true;
+    }
+    
+    // los tres primeros tramos, al empezar
+    void fill(Display& display) {
+        while (step(display, 0)) {
+        }
+    }
+    
+    Obstacle* hitCactus(const GameObject& player, uint16_t segment) {
+        for (uint8_t i = 0; i < cactus.size(); i++) {
+            Obstacle& o = cactus.at(i);
+            if (sameFloor(cactus.segmentAt(i), segment) && o.isActiveObstacle() && player.checkCollision(o)) {
+                return &o;
+            }
+        }
+        return 0;
+    }
+    
+#ifdef STRIP_COMPOSITOR
+    void addLayers(StripCompositor& comp) {
+        for (uint8_t i = 0; i < cactus.size(); i++) {
+            cactus.at(i).addLayer(comp);
+        }
+        for (uint8_t i = 0; i < coins.size(); i++) {
+            coins.at(i).addLayer(comp);
+        }
+    }
+#endif
+    
+    Coin* touchedCoin(const GameObject& player, uint16_t segment) {
+        for (uint8_t i = 0; i < coins.size(); i++) {
+            Coin& c = coins.at(i);
+            if (sameFloor(coins.segmentAt(i), segment) && !c.isCollectedCoin() && player.checkCollision(c)) {
+                return &c;
+            }
+        }
+        return 0;
+    }
+    
+#ifdef SCROLL_WORLD
+    // De lado no se dibuja nada al poner o reciclar: lo que sale por la
+    // izquierda se tapa solo con las columnas nuevas, y lo nuevo se dibuja
+    // de a pedazos con drawColumns cuando van apareciendo sus columnas.
+    // Un solo paso por tick, como step(); false si no habia nada que hacer
+    bool scrollStep(int camera) {
+        if (cactus.size() && cactus.at(0).getX() + SPRITE_SIZE <= camera) {
+            cactus.pop();
+            return true;
+        }
+        if (coins.size() && coins.at(0).getX() + SPRITE_SIZE <= camera) {
+            coins.pop();
+            return true;
+        }
+        int x = worldX(pending);
+        if (x >= camera + SCROLL_AREA + SCROLL_LOOKAHEAD) {
+            return false; // todavia lejos
+        }
+        if (pending.kind == TRACK_CACTUS) {
+            if (cactus.isFull()) {
+                return false;
+            }
+            cactus.push(pending.segment) = Obstacle(x, floorY(pending.segment));
+        } else {
+            if (coins.isFull()) {
+                return false;
+            }
+            coins.push(pending.segment) = Coin(x, floorY(pending.segment));
+        }
+        pending = gen.next();
+        return true;
+    }
+    
+    // lo de la pista que cae en las columnas [x0, x1) del mundo; Display
+    // ya tiene puesto el recorte (setWorldClip)
+    void drawColumns(Display& display, int x0, int x1) {
+        for (uint8_t i = 0; i < cactus.size(); i++) {
+            Obstacle& o = cactus.at(i);
+            if (o.getX() < x1 && o.getX() + o.getWidth() > x0) {
+                o.draw(display);
+            }
+        }
+        for (uint8_t i = 0; i < coins.size(); i++) {
+            Coin& c = coins.at(i);
+            if (c.getX() < x1 && c.getX() + c.getWidth() > x0) {
+                c.draw(display);
+            }
+        }
+    }
+    
+    void shiftX(int dx) {
+        worldBase -= dx;
+        for (uint8_t i = 0; i < cactus.size(); i++) {
+            Obstacle& o = cactus.at(i);
+            o.setPosition(o.getX() + dx, o.getY());
+        }
+        for (uint8_t i = 0; i < coins.size(); i++) {
+            Coin& c = coins.at(i);
+            if (!c.isCollectedCoin()) {
+                c.setPosition(c.getX() + dx, c.getY());
+            }
+        }
+    }
+#endif
+};
+#endif
+
 // Clase para niveles
 class Level {
 private:
@@ -303,184 +1516,489 @@ private:
     int speed;
     int cactusCount;
     int coinCount;
-    Obstacle** obstacles;// Como son varios entonces es un array de punteros a la clase obstacle
-    // es un arreglo dinamico, es decir no esta predeterminado si noq ue cuando se inicia el juego se determian
-    //porque en la clase level se define cuenatos quiero y luego se crea el arrgelo dinamico
-    // entonces con el bucle los crea y los va guardando en ese arreglo
-    // el constructor de la clase decidee cuantos cactus se van a crear 
-    Coin** coins;
+    Obstacle* obstacles;// apunta a la fila de cactus de este nivel, que vive dentro de Game
+    // (memoria estatica, sin new); cactusCount dice cuantos de esa fila se usan
+    Coin* coins;
     
 public:
+    Level() : levelNumber(0), speed(0), cactusCount(0), coinCount(0), obstacles(0), coins(0) {}
+    
     Level(int number, int spd, int cactusNum, int coinNum, 
-          Obstacle** obs, Coin** cn) 
+          Obstacle* obs, Coin* cn) 
         : levelNumber(number), speed(spd), cactusCount(cactusNum), 
           coinCount(coinNum), obstacles(obs), coins(cn) {}
     
     void drawObstacles(Display& display) {
         for (int i = 0; i < cactusCount; i++) {
-            obstacles[i]->draw(display);
+            obstacles[i].draw(display);
         }
     }
     
     void drawCoins(Display& display) {
         for (int i = 0; i < coinCount; i++) {
-            coins[i]->draw(display);
+            coins[i].draw(display);
         }
     }
     
-    Obstacle** getObstacles() { return obstacles; }
-    Coin** getCoins() { return coins; }
+#ifdef STRIP_COMPOSITOR
+    void addLayers(StripCompositor& comp) const {
+        for (int i = 0; i < cactusCount; i++) {
+            obstacles[i].addLayer(comp);
+        }
+        for (int i = 0; i < coinCount; i++) {
+            coins[i].addLayer(comp);
+        }
+    }
+#endif
+    
+    Obstacle* getObstacles() { return obstacles; }
+    Coin* getCoins() { return coins; }
     int getCactusCount() const { return cactusCount; }
     int getCoinCount() const { return coinCount; }
     int getSpeed() const { return speed; }
 };
 
+// Tareas del juego (Scheduler.h), en el orden en que las agrega Game::init
+enum GameTask : uint8_t {
+    TASK_INPUT,     // el boton, en cada vuelta
+    TASK_GAME,      // la maquina de estados; jugando, un tick por periodo
+    TASK_AUDIO,     // las notas de las melodias con tone()
+    TASK_TELEMETRY, // los reportes por Serial, una linea por vez
+    TASK_LOG        // lo que haya en el log, lo que quepa en Serial
+};
+
+#define AUDIO_TASK_MS 10
+#define TELEMETRY_TASK_MS 50 // a 9600 baudios salen unos 50 caracteres en ese tiempo
+// una linea de reporte sale solo con el buffer de Serial vacio (lo llena
+// tambien el log): asi no espera nada si mide hasta 63; las de las tareas
+// con contadores de 5 cifras pasan un poco y esperan solo lo que sobra
+#define TELEMETRY_ROOM (SERIAL_TX_BUFFER_SIZE - 1)
+
+// Estados del juego (Game::gameTask). Ninguno espera con delay(): la tarea
+// del juego ve si ya toca cambiar de estado o correr un tick y vuelve
+enum GameState : uint8_t {
+    STATE_TITLE,
+    STATE_PLAYING,
+    STATE_LEVEL_TRANSITION, // pausa corta con el letrero del piso nuevo
+    STATE_VICTORY,
+    STATE_GAME_OVER,
+    STATE_HALTED            // sin RAM o despues del benchmark: ya no hace nada
+};
+
 // Clase principal del juego
 class Game {
 private:
     Display display;
     SoundManager soundManager;
-    DinoPlayer* player;
-    Level** levels;
+    DinoPlayer player;
+    Level levels[NUM_LEVELS];
     int currentLevel;
     int lives;
     int score;
-    int floorLevels[4];
-    bool gameRunning;
-    
-    // Obstáculos y monedas para cada nivel
-    Obstacle* cactusLevel1[2];
-    Obstacle* cactusLevel2[3];
-    Obstacle* cactusLevel3[4];
-    
-    Coin* coinsLevel1[2];
-    Coin* coinsLevel2[3];
-    Coin* coinsLevel3[4];
+    int floorLevels[FLOOR_COUNT];
+    GameState state;
+    bool entered;            // ya se hizo lo de entrar al estado (enterState)
+    unsigned long stateStart; // millis() al entrar
+    uint16_t frameMs;        // periodo de la tarea del juego (0 fuera del juego)
+    bool buttonDown;         // como estaba el boton la vuelta anterior
+    bool pressed;            // se apreto y la tarea del juego todavia no lo vio
+    uint8_t standTicks;      // ticks del dino corriendo en el lugar (standStep)
+#ifndef NO_MEM_MONITOR
+    MemMonitor memMonitor; // pila y heap (MemMonitor.h)
+#endif
+    uint16_t ticks;
+    uint8_t reportStep;    // linea de telemetria que sigue, 0 si no hay nada
+#ifndef NO_SCHEDULER
+    Scheduler scheduler;   // las tareas de abajo (Scheduler.h)
+#else
+    // millis() en que toca cada tarea con periodo (ver run())
+    uint32_t gameDue, audioDue, telemetryDue;
+#endif
+    BootProfile boot;      // tiempos del arranque, por Serial (BootProfile.h)
+    uint8_t titleStep;     // el pedazo del titulo que sigue (drawTitleStep)
+    bool booted;           // ya corrio finishBoot()
+    bool prepared;         // la partida nueva ya esta armada (prepareGame)
+#ifdef ENDLESS
+    EndlessTrack track; // en vez de los niveles de GameConfig.h
+    uint16_t segment;   // tramo de la pista en el que va el dino
+#endif
+#ifdef SCROLL_WORLD
+    int camera;         // columna del mundo en el borde izquierdo de la pantalla
+    int segmentEnd;     // x del mundo donde empieza el tramo siguiente
+    int hudLives, hudScore; // lo que muestra el HUD, para redibujarlo solo si cambia
+#endif
+    
+    // Obstáculos y monedas para cada nivel (la distribucion esta en GameConfig.h).
+    // Todo el juego vive en memoria estatica, sin new: lo que ocupa en RAM se
+    // sabe al linkear y tools/check_budget.py lo revisa
+    Obstacle cactus[NUM_LEVELS][MAX_OBJECTS];
+    Coin coins[NUM_LEVELS][MAX_OBJECTS];
     
 public:
-    Game() : soundManager(BUZZER_PIN), currentLevel(0), lives(3), score(0), gameRunning(true) {
+    Game() : soundManager(BUZZER_PIN),
+             player(0, YMAX - FLOOR_OFFSETS[0] - SPRITE_SIZE, floorLevels, &display),
+             currentLevel(0), lives(START_LIVES), score(0),
+             state(STATE_TITLE), entered(false), stateStart(0), frameMs(0),
+             buttonDown(false), pressed(false), standTicks(0), ticks(0), reportStep(0),
+             titleStep(0), booted(false), prepared(false)
+#ifdef ENDLESS
+             , track(&floorLevels[0]), segment(0)
+#endif
+#ifdef SCROLL_WORLD
+             , camera(0), segmentEnd(0), hudLives(-1), hudScore(-1)
+#endif
+    {
         // Inicializar niveles del piso
-        floorLevels[0] = YMAX - 60;
-        floorLevels[1] = YMAX - 160;
-        floorLevels[2] = YMAX - 260;
-        floorLevels[3] = YMAX - 32;
-        
-        // Crear jugador
-        player = new DinoPlayer(0, floorLevels[0] - 32, floorLevels, &display);
+        for (int i = 0; i < FLOOR_COUNT; i++) {
+#ifdef SCROLL_WORLD
+            floorLevels[i] = SCROLL_FLOOR_Y; // de lado hay un solo piso
+#else
+            floorLevels[i] = YMAX - FLOOR_OFFSETS[i];
+#endif
+        }
         
         initializeGameObjects();
         initializeLevels();
     }
     
-    ~Game() {
-        delete player;
-        for (int i = 0; i < 3; i++) {
-            delete levels[i];
-        }
-        delete[] levels;
-        
-        // Limpiar obstáculos y monedas
-        for (int i = 0; i < 2; i++) {
-            delete cactusLevel1[i];
-            delete coinsLevel1[i];
-        }
-        for (int i = 0; i < 3; i++) {
-            delete cactusLevel2[i];
-            delete coinsLevel2[i];
+    void initializeGameObjects() {
+        // los cactus y monedas de cada nivel van sobre el piso de ese nivel
+        for (int i = 0; i < NUM_LEVELS; i++) {
+            LevelLayout layout;
+            memcpy_P(&layout, &LEVEL_LAYOUTS[i], sizeof(layout));
+            for (int j = 0; j < layout.cactusCount; j++) {
+                cactus[i][j] = Obstacle(layout.cactusX[j], floorLevels[i] - SPRITE_SIZE);
+            }
+            for (int j = 0; j < layout.coinCount; j++) {
+                coins[i][j] = Coin(layout.coinX[j], floorLevels[i] - SPRITE_SIZE);
+            }
         }
-        for (int i = 0; i < 4; i++) {
-            delete cactusLevel3[i];
-            delete coinsLevel3[i];
+    }
+    
+    void initializeLevels() {
+        for (int i = 0; i < NUM_LEVELS; i++) {
+            LevelLayout layout;
+            memcpy_P(&layout, &LEVEL_LAYOUTS[i], sizeof(layout));
+            levels[i] = Level(layout.number, layout.speed, layout.cactusCount,
+                              layout.coinCount, cactus[i], coins[i]);
         }
     }
     
-    void initializeGameObjects() {
-        // Crear obstáculos nivel 1
-        cactusLevel1[0] = new Obstacle(100, floorLevels[0] - 32);
-        cactusLevel1[1] = new Obstacle(200, floorLevels[0] - 32);
-        
-        // Crear obstáculos nivel 2
-        cactusLevel2[0] = new Obstacle(30, floorLevels[1] - 32);
-        cactusLevel2[1] = new Obstacle(170, floorLevels[1] - 32);
-        cactusLevel2[2] = new Obstacle(200, floorLevels[1] - 32);
-        
-        // Crear obstáculos nivel 3
-        cactusLevel3[0] = new Obstacle(30, floorLevels[2] - 32);
-        cactusLevel3[1] = new Obstacle(170, floorLevels[2] - 32);
-        cactusLevel3[2] = new Obstacle(200, floorLevels[2] - 32);
-        cactusLevel3[3] = new Obstacle(220, floorLevels[2] - 32);
-        
-        // Crear monedas nivel 1
-        coinsLevel1[0] = new Coin(80, floorLevels[0] - 32);
-        coinsLevel1[1] = new Coin(180, floorLevels[0] - 32);
+    // solo lo que hace falta para el primer pixel del titulo; lo demas lo
+    // hace finishBoot() cuando el titulo ya esta en la pantalla
+    void init() {
+#ifndef NO_FLIGHT_RECORDER
+        flightRecorder.begin(); // y el watchdog, con -DWATCHDOG
+#endif
+        display.init();
+        boot.mark(BOOT_DISPLAY);
+#ifdef SAVE_GAME
+        saveLog.load(); // antes del titulo, que muestra el record
+#endif
+#ifdef STRIP_COMPOSITOR
+        // lo que hay en la pantalla, para el compositor: cactus, monedas y el dino encima
+        display.setScene([](StripCompositor& comp, void* game) {
+            ((Game*)game)->addLayers(comp);
+        }, this);
+#endif
         
-        // Crear monedas nivel 2
-        coinsLevel2[0] = new Coin(60, floorLevels[1] - 32);
-        coinsLevel2[1] = new Coin(140, floorLevels[1] - 32);
-        coinsLevel2[2] = new Coin(210, floorLevels[1] - 32);
+#ifndef NO_SCHEDULER
+        // periodo, prioridad (0 la mas alta) y tope en us de cada tarea
+        scheduler.add(F("boton"), [](void* game) { ((Game*)game)->inputTask(); }, this, 0, 0, 100);
+        scheduler.add(F("juego"), [](void* game) { ((Game*)game)->gameTask(); }, this, 0, 1, FRAME_MS_BASE * 1000UL);
+        scheduler.add(F("audio"), [](void* game) { ((Game*)game)->soundManager.update(); }, this,
+                      AUDIO_TASK_MS, 2, 200);
+        scheduler.add(F("telemetria"), [](void* game) { ((Game*)game)->telemetryTask(); }, this,
+                      TELEMETRY_TASK_MS, 3, 2000);
+#ifndef NO_LOG
+        scheduler.add(F("log"), [](void* game) { ((Game*)game)->logTask(); }, this, 0, 3, 500);
+#endif
+#else
+        gameDue = audioDue = telemetryDue = millis();
+#endif
         
-        // Crear monedas nivel 3
-        coinsLevel3[0] = new Coin(70, floorLevels[2] - 32);
-        coinsLevel3[1] = new Coin(130, floorLevels[2] - 32);
-        coinsLevel3[2] = new Coin(190, floorLevels[2] - 32);
-        coinsLevel3[3] = new Coin(220, floorLevels[2] - 32);
-    }
-    
-    void initializeLevels() {
-        levels = new Level*[3];
-        levels[0] = new Level(1, 2, 2, 2, (Obstacle**)cactusLevel1, (Coin**)coinsLevel1);
-        levels[1] = new Level(2, 3, 3, 3, (Obstacle**)cactusLevel2, (Coin**)coinsLevel2);
-        levels[2] = new Level(3, 4, 4, 4, (Obstacle**)cactusLevel3, (Coin**)coinsLevel3);
+        sei();
+        setState(STATE_TITLE); // la pantalla de inicio sale en la primera vuelta de la tarea del juego
     }
     
-    void init() {
+    // el resto del arranque, que no dibuja nada
+    void finishBoot() {
+        booted = true;
         Serial.begin(9600);
-        Serial.println("Serial inicializado");
+        Serial.println(F("Serial inicializado")); // despues de un cuelgue sigue el registro
         
         attachInterrupt(digitalPinToInterrupt(botonRight), []() {
-            // Callback para salto - se maneja en el loop principal
+            // despierta a la CPU (Scheduler.h); el salto lo ve inputTask()
+#ifdef INPUT_LATENCY
+            inputLatency.edge();
+#endif
         }, RISING);
         
+        soundManager.begin();
+    }
+    
+    // otra partida sin reset: todo a como lo deja el constructor y la
+    // pantalla de juego desde cero. display.init() no se vuelve a llamar
+    void resetGame() {
+        prepareGame();
+        drawPlayfield();
+    }
+    
+    // lo de resetGame que no toca la pantalla; en el titulo se hace
+    // mientras se ve el dibujo
+    void prepareGame() {
+        prepared = true;
+        lives = START_LIVES;
+        score = 0;
+        currentLevel = 0;
+        initializeGameObjects(); // cactus activos y monedas sin agarrar
+        initializeLevels();
+        player.restart();
+#ifdef ENDLESS
+        track.reset();
+        segment = 0;
+#endif
+#ifdef SCROLL_WORLD
+        hudLives = -1;
+        hudScore = -1;
+#endif
+#ifdef SAVE_GAME
+        restoreGame();
+#endif
+    }
+    
+#ifdef SAVE_GAME
+    // el record y, por niveles, la partida como va (SaveLog.h). Solo se
+    // copia a RAM: la EEPROM la va escribiendo la interrupcion
+    void saveGame(bool inGame) {
+        SaveRecord r = saveLog.last();
+        if (score > (int)r.highScore) {
+            r.highScore = score;
+        }
+        r.flags = 0;
+#ifndef ENDLESS
+        if (inGame) {
+            static_assert(NUM_LEVELS * MAX_OBJECTS <= 16, "las monedas no caben en SaveRecord::coins");
+            r.flags = SAVE_IN_GAME;
+            r.level = currentLevel;
+            r.lives = lives;
+            r.score = score;
+            r.coins = 0;
+            for (int l = 0; l < NUM_LEVELS; l++) {
+                for (int i = 0; i < MAX_OBJECTS; i++) {
+                    if (coins[l][i].isCollectedCoin()) {
+                        r.coins |= 1u << (l * MAX_OBJECTS + i);
+                    }
+                }
+            }
+        }
+#endif
+        saveLog.save(r);
+        LOG(LOG_SAVE, r.level, r.lives, r.score);
+    }
+    
+    // sigue la partida guardada, si hay; prepareGame ya dejo todo como nuevo
+    void restoreGame() {
+        const SaveRecord& s = saveLog.last();
+        if (!(s.flags & SAVE_IN_GAME) || s.level >= NUM_LEVELS || s.lives == 0 || s.lives > START_LIVES) {
+            return;
+        }
+        currentLevel = s.level;
+        lives = s.lives;
+        score = s.score;
+        for (int l = 0; l < NUM_LEVELS; l++) {
+            for (int i = 0; i < MAX_OBJECTS; i++) {
+                if (s.coins & (1u << (l * MAX_OBJECTS + i))) {
+                    coins[l][i].markCollected();
+                }
+            }
+        }
+        player.restart(currentLevel);
+    }
+    
+    // arriba del titulo: el record y si hay una partida para seguir
+    void drawSaveInfo() {
+        const SaveRecord& s = saveLog.last();
+        if (s.highScore) {
+            display.setTextSize(2);
+            display.setCursor(10, 10);
+            display.print(F("Record "));
+            display.print(s.highScore);
+        }
+        if (s.flags & SAVE_IN_GAME) {
+            display.setTextSize(1);
+            display.setCursor(10, 34);
+            display.print(F("Sigue en el nivel "));
+            display.print(s.level + 1);
+        }
+    }
+#endif
+    
+    void drawPlayfield() {
+#ifdef SCROLL_WORLD
+        startScroll();
+#else
+        display.drawBackground(); // los pisos vienen en el fondo
+#ifdef ENDLESS
+        track.fill(display);
+#elif !defined(STRIP_COMPOSITOR)
+        drawAllObstacles(); // con el compositor ya salieron con el fondo
+#endif
+#endif
+#ifdef MUSIC
+        soundManager.startMusic();
+#endif
+    }
+    
+#ifdef BENCHMARK
+    // env:bench: en vez de jugar mide el display y manda los tiempos por Serial
+    void benchmark() {
+        Serial.begin(9600);
         display.init();
-        showStartScreen();
-        
-        display.fillScreen(ILI9341_BLACK);
-        drawFloor();
-        drawAllObstacles();
-        
-        sei();
+        runDisplayBenchmarks(display, Serial, dinoAnim, ASSET_ADDR(spriteCactus), ASSET_ADDR(splashFondo));
+        setState(STATE_HALTED);
+    }
+#endif
+    
+    // la pantalla de inicio de a pedazos, uno por vuelta de gameTask(): el boton
+    // se lee entre pedazo y pedazo, asi que se puede saltar antes de que
+    // termine de salir. El blanco no pasa por debajo del dibujo, que son
+    // 7296 pixeles que se mandarian dos veces. false si ya no queda nada
+    bool drawTitleStep(uint8_t step) {
+        const int splashX = XMAX / 2 - 32, splashY = 130, splashW = 64, splashH = 114;
+        const int bandRows = 8; // filas del dibujo (sin agrandar) por pedazo
+        const uint8_t bands = (57 + bandRows - 1) / bandRows;
+        if (step == 0) {
+            display.fillRect(0, 0, XMAX, splashY, ILI9341_WHITE);
+            display.setTextColor(ILI9341_RED);
+            display.setTextSize(6);
+            display.setCursor(XMAX / 2 - 80, 70);
+            display.print(F("DINO"));
+#ifdef SAVE_GAME
+            drawSaveInfo();
+#endif
+            return true;
+        }
+        if (step <= bands) {
+            int row = (step - 1) * bandRows;
+            int y = splashY + row * 2;
+            int h = min(bandRows, 57 - row) * 2;
+            display.fillRect(0, y, splashX, h, ILI9341_WHITE);
+            display.fillRect(splashX + splashW, y, XMAX - splashX - splashW, h, ILI9341_WHITE);
+            display.drawRGBBitmapScaledRows(splashX, splashY, ASSET_ADDR(splashFondo), 32, 57, 2, row, bandRows);
+            return true;
+        }
+        if (step == bands + 1) {
+            display.fillRect(0, splashY + splashH, XMAX, YMAX - splashY - splashH, ILI9341_WHITE);
+            return true;
+        }
+        return false;
     }
     
-    void showStartScreen() {
-        display.fillScreen(ILI9341_WHITE);
-        
-        display.setTextColor(ILI9341_RED);
-        display.setTextSize(6);
-        display.setCursor(XMAX / 2 - 80, 70);
-        display.print("DINO");
-        
-        display.drawRGBBitmap(XMAX / 2 - 32, 130, spriteFondo, 64, 114);
-        
-        delay(3000);
+    // del titulo al juego: lo que no se alcanzo a hacer mientras se veia
+    void startGame() {
+        if (!booted) {
+            finishBoot();
+        }
+        if (!prepared) {
+            prepareGame();
+        }
+        drawPlayfield();
+        boot.mark(BOOT_READY);
+        setState(STATE_PLAYING);
+    }
+    
+#ifdef SCROLL_WORLD
+    // se acuesta la pantalla y se dibuja la primera vista del mundo entera;
+    // despues solo se dibujan las columnas que van apareciendo
+    void startScroll() {
+        display.beginScroll();
+        display.fillRect(SCROLL_AREA, 0, SCROLL_HUD_W, SCROLL_H, 0x03E0);
+        camera = 0;
+        segmentEnd = SCROLL_AREA + XMAX;
+        player.setPosition(SCROLL_DINO_X, floorLevels[0] - SPRITE_SIZE);
+        while (track.scrollStep(camera)) {
+        }
+        display.setWorldView(true);
+        drawWorldColumns(0, SCROLL_AREA);
     }
     
-    void drawFloor() {
-        display.setTextColor(ILI9341_WHITE);
-        display.setTextSize(2);
-        
-        for (int i = 0; i < 4; i++) {
-            display.drawLine(0, floorLevels[i], XMAX, floorLevels[i], ILI9341_WHITE);
+    // la camara sigue al dino: se corre el scroll por hardware (un comando)
+    // y solo se dibujan las columnas que aparecen por la derecha, que en la
+    // memoria son las que se acaban de ir por la izquierda
+    void scrollWorld() {
+        int target = player.getX() - SCROLL_DINO_X;
+        if (target <= camera) {
+            return;
+        }
+        display.scrollTo(target);
+        drawWorldColumns(camera + SCROLL_AREA, target + SCROLL_AREA);
+        camera = target;
+        if (camera >= segmentEnd) {
+            segment++; // para la velocidad
+            segmentEnd += XMAX;
+        }
+    }
+    
+    // fondo y pista de las columnas [x0, x1) del mundo
+    void drawWorldColumns(int x0, int x1) {
+        int wrap = (x0 | (SCROLL_AREA - 1)) + 1; // el recorte no puede cruzar el final del area
+        if (x1 > wrap) {
+            drawWorldColumns(x0, wrap);
+            x0 = wrap;
         }
+        display.setWorldClip(x0, x1);
+        display.restoreBackground(x0, 0, x1 - x0, SCROLL_H);
+        track.drawColumns(display, x0, x1);
+        display.setWorldView(true); // quita el recorte
     }
     
+    // las x del mundo vuelven atras SCROLL_REBASE para que quepan en un int;
+    // como es multiplo de SCROLL_AREA en la memoria no se mueve nada
+    void rebaseWorld() {
+        camera -= SCROLL_REBASE;
+        segmentEnd -= SCROLL_REBASE;
+        player.shiftX(-SCROLL_REBASE);
+        track.shiftX(-SCROLL_REBASE);
+    }
+#endif
+    
     void drawHUD() {
+#ifdef SCROLL_WORLD
+        // de lado el HUD es la franja fija de la derecha, y como no se borra
+        // con nada solo se redibuja cuando cambia
+        if (lives == hudLives && score == hudScore) {
+            return;
+        }
+        hudLives = lives;
+        hudScore = score;
+        display.setWorldView(false);
+        display.fillRect(SCROLL_AREA, 0, SCROLL_HUD_W, 72, 0x03E0);
+        display.setTextColor(ILI9341_WHITE);
+        display.setTextSize(1);
+        display.setCursor(SCROLL_AREA + 4, 8);
+        display.print(F("Vidas"));
+        for (int i = 0; i < START_LIVES; i++) {
+            if (i < lives) {
+                display.fillRect(SCROLL_AREA + 4 + i * 12, 20, 10, 10, ILI9341_RED);
+            } else {
+                display.drawRect(SCROLL_AREA + 4 + i * 12, 20, 10, 10, ILI9341_WHITE);
+            }
+        }
+        display.setCursor(SCROLL_AREA + 4, 44);
+        display.print(F("Puntos"));
+        display.setCursor(SCROLL_AREA + 4, 56);
+        display.print(score);
+        display.setWorldView(true);
+        return;
+#endif
         display.fillRect(0, YMAX - 20, XMAX, 16, 0x03E0);
         display.setTextColor(ILI9341_WHITE);
         display.setTextSize(1);
         
         display.setCursor(5, YMAX - 18);
-        display.print("Vidas: ");
-        for (int i = 0; i < 3; i++) {
+        display.print(F("Vidas: "));
+        for (int i = 0; i < START_LIVES; i++) {
             if (i < lives) {
                 display.fillRect(60 + i * 12, YMAX - 18, 10, 10, ILI9341_RED);
             } else {
@@ -489,67 +2007,129 @@ public:
         }
         
         display.setCursor(140, YMAX - 18);
-        display.print("Puntos: ");
+        display.print(F("Puntos: "));
         display.print(score);
+        
+#ifdef MEM_HUD
+        MemStats mem = memMonitor.measure();
+        display.restoreBackground(0, 0, XMAX, 10);
+        display.setCursor(5, 1);
+        display.print(F("RAM libre "));
+        display.print(mem.minFree);
+        display.print(F(" pila "));
+        display.print(mem.stackPeak);
+#endif
+    }
+    
+#ifdef STRIP_COMPOSITOR
+    void addLayers(StripCompositor& comp) {
+#ifdef ENDLESS
+        track.addLayers(comp);
+#else
+        for (int i = 0; i < NUM_LEVELS; i++) {
+            levels[i].addLayers(comp);
+        }
+#endif
+        player.addLayer(comp);
     }
+#endif
     
     void drawAllObstacles() {
-        levels[0]->drawObstacles(display);
-        levels[0]->drawCoins(display);
-        levels[1]->drawObstacles(display);
-        levels[1]->drawCoins(display);
-        levels[2]->drawObstacles(display);
-        levels[2]->drawCoins(display);
+        for (int i = 0; i < NUM_LEVELS; i++) {
+            levels[i].drawObstacles(display);
+            levels[i].drawCoins(display);
+        }
     }
     
     void checkCollisions() {
-        Level* level = levels[currentLevel];
+#ifdef ENDLESS
+        Obstacle* hit = track.hitCactus(player, segment);
+        if (hit) {
+            soundManager.playCollisionSound();
+            lives--;
+            LOG(LOG_HIT, player.getX(), lives);
+#ifdef SCROLL_WORLD
+            hit->deactivate(); // de lado el dino no vuelve atras: ese cactus ya no cuenta
+#else
+            player.resetPosition();
+#endif
+        }
+        Coin* coin = track.touchedCoin(player, segment);
+        if (coin) {
+            soundManager.playCoinSound();
+            score += COIN_POINTS;
+            LOG(LOG_COIN, score);
+            coin->collect(display);
+        }
+#else
+        Level& level = levels[currentLevel];
         
         // Verificar colisiones con obstáculos
-        Obstacle** obstacles = level->getObstacles();
-        for (int i = 0; i < level->getCactusCount(); i++) {
-            if (obstacles[i]->isActiveObstacle() && player->checkCollision(*obstacles[i])) {
+        Obstacle* obstacles = level.getObstacles();
+        for (int i = 0; i < level.getCactusCount(); i++) {
+            if (obstacles[i].isActiveObstacle() && player.checkCollision(obstacles[i])) {
                 soundManager.playCollisionSound();
                 lives--;
-                player->resetPosition();
+                LOG(LOG_HIT, player.getX(), lives);
+                player.resetPosition();
                 break;
             }
         }
         
         // Verificar colisiones con monedas
-        Coin** coins = level->getCoins();
-        for (int i = 0; i < level->getCoinCount(); i++) {
-            if (!coins[i]->isCollectedCoin() && player->checkCollision(*coins[i])) {
+        Coin* coins = level.getCoins();
+        for (int i = 0; i < level.getCoinCount(); i++) {
+            if (!coins[i].isCollectedCoin() && player.checkCollision(coins[i])) {
                 soundManager.playCoinSound();
-                score += 10;
-                coins[i]->collect(display);
+                score += COIN_POINTS;
+                LOG(LOG_COIN, score);
+                coins[i].collect(display);
             }
         }
         
         // Verificar condiciones de fin de juego
-        if (score >= 80) {
-            showVictoryScreen();
-            gameRunning = false;
+        if (score >= WIN_SCORE) {
+            setState(STATE_VICTORY);
         }
+#endif
         
         if (lives <= 0) {
-            showGameOverScreen();
-            gameRunning = false;
+            setState(STATE_GAME_OVER);
         }
     }
     
     void checkLevelProgression() {
-        if (player->isAtRightEdge()) {
-            if (currentLevel < 2) {
-                player->clearFromScreen();
+#ifdef ENDLESS
+#ifdef SCROLL_WORLD
+        return; // de lado no hay pisos: el mundo corre (scrollWorld)
+#endif
+        // sin fin: del ultimo piso se vuelve al primero con el tramo siguiente
+        if (player.isAtRightEdge()) {
+            player.clearFromScreen();
+            segment++;
+            currentLevel = segment % NUM_LEVELS;
+            LOG(LOG_FLOOR, currentLevel, score);
+            player.setCurrentLevel(currentLevel);
+            player.setPosition(0, floorLevels[currentLevel] - SPRITE_SIZE);
+        }
+        return;
+#endif
+        if (player.isAtRightEdge()) {
+            if (currentLevel < NUM_LEVELS - 1) {
+                player.clearFromScreen();
                 currentLevel++;
-                player->setCurrentLevel(currentLevel);
-                player->setPosition(0, floorLevels[currentLevel] - 32);
+                LOG(LOG_FLOOR, currentLevel, score);
+                player.setCurrentLevel(currentLevel);
+                player.setPosition(0, floorLevels[currentLevel] - SPRITE_SIZE);
+                setState(STATE_LEVEL_TRANSITION);
             }
         }
     }
     
     void showVictoryScreen() {
+#ifdef MUSIC
+        soundManager.stopMusic();
+#endif
         display.fillScreen(ILI9341_BLACK);
         soundManager.playVictorySound();
         
@@ -557,17 +2137,21 @@ public:
         display.setTextSize(5);
         
         display.setCursor((XMAX - (3 * 30)) / 2, YMAX / 2 - 50);
-        display.print("YOU");
+        display.print(F("YOU"));
         
         display.setCursor((XMAX - (3 * 30)) / 2, YMAX / 2);
-        display.print("WIN");
-        
-        display.drawRGBBitmap(XMAX / 2 - 32, YMAX / 2 + 60, spriteGameover, 64, 114);
+        display.print(F("WIN"));
         
-        delay(3000);
+        display.drawRGBBitmapScaled(XMAX / 2 - 32, YMAX / 2 + 60, ASSET_ADDR(splashGameover), 32, 57, 2);
     }
     
     void showGameOverScreen() {
+#ifdef MUSIC
+        soundManager.stopMusic();
+#endif
+#ifdef SCROLL_WORLD
+        display.endScroll();
+#endif
         display.fillScreen(ILI9341_BLACK);
         soundManager.playGameOverSound();
         
@@ -576,74 +2160,445 @@ public:
         int textWidth = 60;
         
         display.setCursor(XMAX / 2 - textWidth, YMAX / 2 - 50);
-        display.print("GAME");
+        display.print(F("GAME"));
         
         display.setCursor(XMAX / 2 - textWidth, YMAX / 2);
-        display.print("OVER");
-        
-        display.drawRGBBitmap(XMAX / 2 - 32, YMAX / 2 + 60, spriteGameover, 64, 114);
+        display.print(F("OVER"));
         
-        delay(3000);
+        display.drawRGBBitmapScaled(XMAX / 2 - 32, YMAX / 2 + 60, ASSET_ADDR(splashGameover), 32, 57, 2);
     }
     
-    void handleInput() {
-        // Aquí manejarías la entrada del botón de salto
-        // En el código original usas interrupciones, puedes mantener esa lógica
-        if (digitalRead(botonRight) == HIGH) {
-            player->jump();
+    // el dino ya esta en el piso nuevo; el letrero va sobre el HUD, que el
+    // siguiente tick vuelve a dibujar
+    void showLevelBanner() {
+        display.beginFrame();
+        player.draw(display);
+        display.fillRect(0, YMAX - 20, XMAX, 16, 0x03E0);
+        display.setTextColor(ILI9341_YELLOW);
+        display.setTextSize(1);
+        display.setCursor(XMAX / 2 - 20, YMAX - 18);
+        display.print(F("Nivel "));
+        display.print(currentLevel + 1);
+        display.endFrame();
+    }
+    
+    // durante el letrero el dino corre en el lugar, a los ticks del piso
+    // nuevo. Es el unico momento en que cambia de cuadro sin moverse, y
+    // entonces solo salen las filas de las patitas (DinoPlayer::draw)
+    void standStep(unsigned long inState) {
+        unsigned long tickMs = FRAME_MS_BASE - getSpeed() * FRAME_MS_PER_SPEED;
+        if (inState / tickMs <= standTicks) {
+            return;
+        }
+        standTicks++;
+        player.animate();
+        display.beginFrame();
+        player.draw(display);
+        display.endFrame();
+    }
+    
+    // si la pila llego cerca del heap se para el juego antes de que pise
+    // las variables; cada REPORT_TICKS manda por Serial el uso de RAM y
+    // cuantos comandos y transacciones SPI llevo el ultimo cuadro
+    void checkMemory() {
+#ifndef NO_MEM_MONITOR
+        if (!memMonitor.check()) {
+            memMonitor.report(Serial);
+            LOG(LOG_NO_RAM, memMonitor.measure().minFree);
+#ifdef SCROLL_WORLD
+            display.endScroll();
+#endif
+            display.fillScreen(ILI9341_BLACK);
+            display.setTextColor(ILI9341_RED);
+            display.setTextSize(3);
+            display.setCursor(20, YMAX / 2 - 20);
+            display.print(F("SIN RAM"));
+            setState(STATE_HALTED);
+            return;
+        }
+#endif
+        if (++ticks >= REPORT_TICKS) {
+            ticks = 0;
+            reportStep = 1; // lo manda la tarea de telemetria
         }
     }
     
-    void update() {
-        if (!gameRunning) {
+    // una linea por vez: nunca se llena el buffer de Serial (64 bytes), asi
+    // que print() no se queda esperando a que salga
+    void telemetryTask() {
+        if (!booted) {
+            return; // todavia no hay Serial
+        }
+#ifndef NO_FLIGHT_RECORDER
+        if (Serial.available() && Serial.read() == 'v') {
+            flightRecorder.requestDump();
+        }
+#endif
+        if (Serial.availableForWrite() < TELEMETRY_ROOM) {
+            return; // la linea que toca sale en otra vuelta
+        }
+        switch (reportStep) {
+        case 0:
+#ifndef NO_FLIGHT_RECORDER
+            if (flightRecorder.dumping()) {
+                flightRecorder.dumpLine(Serial);
+            }
+#endif
+            return;
+        case 1:
+#ifndef NO_MEM_MONITOR
+            memMonitor.report(Serial);
+#endif
+            break;
+        case 2:
+            display.reportFrame(Serial);
+            break;
+        case 3:
+#ifdef SAMPLE_AUDIO
+            sampleAudio.report(Serial);
+#endif
+            break;
+        case 4:
+#ifndef NO_SCHEDULER
+            scheduler.reportDuty(Serial);
+#endif
+            break;
+        case 5:
+#ifdef INPUT_LATENCY
+            inputLatency.report(Serial);
+#endif
+            break;
+        default: // y una por tarea
+#ifndef NO_SCHEDULER
+            scheduler.reportTask(Serial, reportStep - 6);
+            if (reportStep - 5 == scheduler.size()) { // era la ultima
+                reportStep = 0;
+                return;
+            }
+#else
+            reportStep = 0;
             return;
+#endif
         }
+        reportStep++;
+    }
+    
+    // true solo en la vuelta en que se aprieta el boton
+    bool readButton() {
+        bool down = digitalRead(botonRight) == HIGH;
+        bool edge = down && !buttonDown;
+        buttonDown = down;
+        return edge;
+    }
+    
+#ifndef NO_LOG
+    // el log sale cuando ya hay Serial (finishBoot); hasta entonces espera en el anillo
+    void logTask() {
+        if (booted) {
+            logger.drain(Serial);
+        }
+    }
+#endif
+    
+    // en cada vuelta: un toque corto entre dos ticks no se pierde
+    void inputTask() {
+        if (readButton()) {
+            pressed = true;
+        }
+    }
+    
+    void handleInput() {
+#ifndef NO_FLIGHT_RECORDER
+        flightRecorder.phase(PHASE_INPUT);
+#endif
+        // salta si se apreto desde el tick anterior o si lo tiene apretado
+        if (pressed || buttonDown) {
+            bool jumped = player.jump();
+            if (jumped) {
+                LOG(LOG_JUMP, player.getX(), player.getY());
+            }
+#ifdef INPUT_LATENCY
+            if (pressed) {
+                inputLatency.pressed(jumped);
+            }
+#endif
+        }
+        pressed = false;
+    }
+    
+    void update() {
+        // Actualizar jugador (draw borra lo que quede de la posicion anterior)
+#ifndef NO_FLIGHT_RECORDER
+        flightRecorder.phase(PHASE_PLAYER);
+#endif
+        player.update();
+        player.moveRight();
         
-        // Limpiar posición anterior del jugador
-        display.fillRect(player->getX(), player->getY(), 32, 32, ILI9341_BLACK);
-        
-        // Actualizar jugador
-        player->update();
-        player->moveRight();
-        
-        // Dibujar todo
-        player->draw(display);
-        drawFloor();
+        // Dibujar todo, en una sola transaccion SPI
+#ifndef NO_FLIGHT_RECORDER
+        flightRecorder.phase(PHASE_DRAW);
+#endif
+        display.beginFrame();
+#ifdef SCROLL_WORLD
+        scrollWorld();
+#endif
+#ifdef INPUT_LATENCY
+        if (inputLatency.armed()) {
+            display.stampNextWindow(); // la primera del salto (InputLatency.h)
+        }
+#endif
+        player.draw(display);
         drawHUD();
         
         // Verificar colisiones y progresión de nivel
+#ifndef NO_FLIGHT_RECORDER
+        flightRecorder.phase(PHASE_COLLIDE);
+#endif
         checkCollisions();
-        checkLevelProgression();
+        if (state == STATE_PLAYING) { // si perdio o gano ya no avanza
+            checkLevelProgression();
+        }
+#ifndef NO_FLIGHT_RECORDER
+        flightRecorder.phase(PHASE_TRACK);
+#endif
+#if defined(SCROLL_WORLD)
+        track.scrollStep(camera); // sin dibujar: lo nuevo sale con sus columnas
+        if (camera >= SCROLL_REBASE) {
+            rebaseWorld();
+        }
+#elif defined(ENDLESS)
+        track.step(display, segment); // a lo mas un sprite de la pista por cuadro
+#endif
+        display.endFrame();
+#ifdef INPUT_LATENCY
+        if (inputLatency.waiting()) {
+            inputLatency.collect(display.windowStamp()); // con la cola puede ser el cuadro siguiente
+        }
+#endif
+#ifndef NO_FLIGHT_RECORDER
+        flightRecorder.phase(PHASE_SAVE);
+#endif
+#if defined(SAVE_GAME) && !defined(ENDLESS)
+        // cada vida, moneda o piso queda guardado (sin fin solo el record, al final)
+        const SaveRecord& saved = saveLog.last();
+        if ((state == STATE_PLAYING || state == STATE_LEVEL_TRANSITION) &&
+            (!(saved.flags & SAVE_IN_GAME) || saved.level != currentLevel ||
+             saved.lives != lives || saved.score != score)) {
+            saveGame(true);
+        }
+#endif
+        boot.mark(BOOT_FIRST_FRAME);
+        boot.report(Serial); // solo la primera vez
+        checkMemory();
+        if (state == STATE_PLAYING) {
+            setFramePeriod(); // la velocidad cambia con el piso o el tramo
+        }
+    }
+    
+    // jugando la tarea del juego corre un tick por periodo, segun la
+    // velocidad del nivel, y tiene todo el periodo de tope; fuera del juego
+    // corre en cada vuelta
+    void setFramePeriod() {
+        uint16_t ms = state == STATE_PLAYING ? FRAME_MS_BASE - getSpeed() * FRAME_MS_PER_SPEED : 0;
+        if (ms != frameMs) {
+            frameMs = ms;
+#ifndef NO_SCHEDULER
+            scheduler.setPeriod(TASK_GAME, ms, (ms ? ms : FRAME_MS_BASE) * 1000UL);
+#else
+            gameDue = millis() + ms;
+#endif
+        }
+    }
+    
+    // el cambio se hace en la siguiente vuelta de gameTask(), fuera del cuadro
+    void setState(GameState next) {
+        LOG(LOG_STATE, (uint8_t)next);
+        state = next;
+        entered = false;
+        setFramePeriod(); // jugando, el primer tick sale un periodo despues
+#ifndef NO_SCHEDULER
+        scheduler.stayAwake();
+#endif
+    }
+    
+    // lo que se hace una vez al entrar a cada estado
+    void enterState() {
+        switch (state) {
+        case STATE_TITLE:
+            titleStep = 0; // se dibuja de a pedazos en gameTask()
+            prepared = false;
+            break;
+        case STATE_PLAYING:
+            break;
+        case STATE_LEVEL_TRANSITION:
+            standTicks = 0;
+            showLevelBanner();
+            break;
+        case STATE_VICTORY:
+#ifdef SAVE_GAME
+            saveGame(false); // el record, y ya no hay partida que seguir
+#endif
+            showVictoryScreen();
+            break;
+        case STATE_GAME_OVER:
+#ifdef SAVE_GAME
+            saveGame(false);
+#endif
+            showGameOverScreen();
+            break;
+        case STATE_HALTED:
+            break;
+        }
+    }
+    
+#ifdef NO_SCHEDULER
+    // sin Scheduler.h: true si toca la tarea de periodo `periodMs` (0: en
+    // cada vuelta); si se atraso un periodo entero no corre para alcanzar
+    static bool due(uint32_t& at, uint16_t periodMs, uint32_t now) {
+        if ((int32_t)(now - at) < 0) {
+            return false;
+        }
+        at += periodMs;
+        if ((int32_t)(now - at) >= 0) {
+            at = now + periodMs;
+        }
+        return true;
+    }
+#endif
+    
+    // una vuelta de loop(): las tareas que tocan (Scheduler.h)
+    void run() {
+#ifndef NO_FLIGHT_RECORDER
+        flightRecorder.feed();
+#endif
+#ifndef NO_SCHEDULER
+        scheduler.run();
+#else
+        // las mismas tareas en el orden de sus prioridades, sin medirlas ni dormir
+        uint32_t now = millis();
+        inputTask();
+        if (due(gameDue, frameMs, now)) {
+            gameTask();
+        }
+        if (due(audioDue, AUDIO_TASK_MS, now)) {
+            soundManager.update();
+        }
+        if (due(telemetryDue, TELEMETRY_TASK_MS, now)) {
+            telemetryTask();
+        }
+#ifndef NO_LOG
+        logTask();
+#endif
+#endif
+    }
+    
+    // la maquina de estados. Nunca se queda esperando: los cambios de estado
+    // van por tiempo (millis) y el boton lo lee inputTask()
+    void gameTask() {
+        // el tope del planificador; si se pasa queda en la caja negra
+#ifndef NO_FLIGHT_RECORDER
+        uint32_t budgetUs = (frameMs ? frameMs : FRAME_MS_BASE) * 1000UL;
+        flightRecorder.frameBegin(state);
+#endif
+        if (!entered) {
+            entered = true;
+            stateStart = millis();
+            enterState();
+        }
+        unsigned long inState = millis() - stateStart;
+        bool press = pressed;
+        if (state != STATE_PLAYING) {
+            pressed = false; // jugando lo usa handleInput()
+#ifdef INPUT_LATENCY
+            inputLatency.pressed(false); // y su flanco, que no empieza ningun salto
+#endif
+        }
         
-        // Delay basado en la velocidad del nivel
-        delay(100 - levels[currentLevel]->getSpeed() * 10);
+        switch (state) {
+        case STATE_TITLE:
+            if (press || inState >= (unsigned long)TITLE_MS) {
+                if (press) {
+                    boot.skip();
+                }
+                startGame();
+            } else if (drawTitleStep(titleStep)) {
+                titleStep++;
+#ifndef NO_SCHEDULER
+                scheduler.stayAwake(); // el pedazo que sigue sin dormir
+#endif
+            } else if (!booted) {
+                boot.mark(BOOT_TITLE);
+                finishBoot();
+#ifndef NO_SCHEDULER
+                scheduler.stayAwake();
+#endif
+            } else if (!prepared) {
+                prepareGame(); // el nivel queda armado, solo falta dibujarlo
+            }
+            break;
+        case STATE_PLAYING:
+            handleInput();
+            update();
+            break;
+        case STATE_LEVEL_TRANSITION:
+            if (inState >= (unsigned long)LEVEL_TRANSITION_MS) {
+                setState(STATE_PLAYING);
+            } else {
+                standStep(inState);
+            }
+            break;
+        case STATE_VICTORY:
+        case STATE_GAME_OVER:
+            if (press && inState >= (unsigned long)END_GUARD_MS) {
+                resetGame(); // otra partida enseguida, sin pasar por el titulo
+                setState(STATE_PLAYING);
+            } else if (inState >= (unsigned long)END_SCREEN_MS) {
+                setState(STATE_TITLE);
+            }
+            break;
+        case STATE_HALTED:
+            break;
+        }
+#ifndef NO_FLIGHT_RECORDER
+        if (flightRecorder.frameEnd(budgetUs)) {
+            const FlightRecord& slow = flightRecorder.newest();
+            LOG(LOG_OVERRUN, slow.totalUs, slow.phase);
+        }
+#endif
+    }
+    
+    int getSpeed() const {
+#ifdef ENDLESS
+        // cada ENDLESS_SEGMENTS_PER_SPEED tramos un poco mas rapido
+        return min(ENDLESS_MAX_SPEED, ENDLESS_START_SPEED + segment / ENDLESS_SEGMENTS_PER_SPEED);
+#else
+        return levels[currentLevel].getSpeed();
+#endif
     }
     
-    bool isRunning() const {
-        return gameRunning;
+    GameState getState() const {
+        return state;
     }
 };
 
 // Variables globales
-Game* game;
+Game game; // estatico: el constructor no toca el hardware, eso lo hace init()
 
 void jumpInterrupt() {
-    if (game) {
-        // Aquí puedes acceder al jugador a través del juego si lo haces público
-        // o crear un método público en Game para manejar el salto
-    }
+    // Aquí puedes acceder al jugador a través del juego si lo haces público
+    // o crear un método público en Game para manejar el salto
 }
 
 void setup() {
-    game = new Game();
-    game->init();
+#ifdef BENCHMARK
+    game.benchmark();
+    return;
+#endif
+    game.init();
 }
 
 void loop() {
-    if (game->isRunning()) {
-        game->handleInput(); // <-- Agrega esta línea
-        game->update();
-    }
+    game.run();
 }
 
 
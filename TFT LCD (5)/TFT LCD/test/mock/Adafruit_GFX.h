@@ -0,0 +1,37 @@
+#ifndef _ADAFRUIT_GFX_H
+#define _ADAFRUIT_GFX_H
+
+// Adafruit GFX de mentira: solo lo que llama src/main.cpp. Dibuja en el
+// panel de mentira (MockPanel.h); las letras son bloques de 5x7
+#include <Arduino.h>
+
+class Adafruit_GFX : public Print {
+public:
+    Adafruit_GFX(int16_t w, int16_t h);
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h);
+    void drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h);
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void fillScreen(uint16_t color);
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+    void setTextColor(uint16_t color);
+    void setTextColor(uint16_t color, uint16_t bg);
+    void setTextSize(uint8_t size);
+    void setCursor(int16_t x, int16_t y);
+    int16_t getCursorX();
+    int16_t getCursorY();
+    void setRotation(uint8_t r);
+    int16_t width();
+    int16_t height();
+    size_t write(uint8_t c);
+
+protected:
+    uint8_t rotation;
+    int16_t cursorX, cursorY;
+    uint8_t textSize;
+    uint16_t textColor;
+};
+
+#endif
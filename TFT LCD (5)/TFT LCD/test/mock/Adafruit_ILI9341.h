@@ -0,0 +1,54 @@
+#ifndef _ADAFRUIT_ILI9341H_
+#define _ADAFRUIT_ILI9341H_
+
+// Adafruit ILI9341 de mentira: las ventanas y los pixeles van directo al
+// panel de mentira (MockPanel.h), sin pasar por SPI.transfer
+#include <Adafruit_GFX.h>
+#include <SPI.h>
+
+#define ILI9341_TFTWIDTH 240
+#define ILI9341_TFTHEIGHT 320
+#define ILI9341_CASET 0x2A
+#define ILI9341_PASET 0x2B
+#define ILI9341_RAMWR 0x2C
+#define ILI9341_VSCRDEF 0x33
+#define ILI9341_MADCTL 0x36
+#define ILI9341_VSCRSADD 0x37
+
+#define ILI9341_BLACK 0x0000
+#define ILI9341_BLUE 0x001F
+#define ILI9341_GREEN 0x07E0
+#define ILI9341_RED 0xF800
+#define ILI9341_YELLOW 0xFFE0
+#define ILI9341_WHITE 0xFFFF
+
+class Adafruit_ILI9341 : public Adafruit_GFX {
+public:
+    Adafruit_ILI9341(int8_t cs, int8_t dc, int8_t mosi, int8_t sclk, int8_t rst = -1, int8_t miso = -1);
+    Adafruit_ILI9341(int8_t cs, int8_t dc, int8_t rst = -1);
+    void begin(uint32_t freq = 0);
+    void setRotation(uint8_t r);
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void startWrite();
+    void endWrite();
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void writePixel(int16_t x, int16_t y, uint16_t color);
+    void writeColor(uint16_t color, uint32_t n);
+    void writePixels(uint16_t* colors, uint32_t n, bool block = true, bool bigEndian = false);
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void writeCommand(uint8_t cmd);
+    void sendCommand(uint8_t cmd, const uint8_t* data = 0, uint8_t n = 0);
+    void spiWrite(uint8_t b);
+    void SPI_WRITE16(uint16_t color);
+    void SPI_CS_LOW();
+    void SPI_CS_HIGH();
+    void SPI_DC_LOW();
+    void SPI_DC_HIGH();
+    void setScrollMargins(uint16_t top, uint16_t bottom);
+    void scrollTo(uint16_t y);
+};
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+// Arduino de mentira para correr el firmware en la PC (env:native, pio
+// test). Lo justo para compilar src/main.cpp y los .h: el tiempo lo
+// avanza la prueba (mockMs, mockUs), el boton es mockButton y Serial sale
+// por stderr, a 9600 baudios segun mockUs. La implementacion esta en ArduinoMock.h, que cada prueba
+// incluye una vez (cada prueba es un solo .cpp).
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <avr/interrupt.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#define _BV(b) (1 << (b))
+#define bit(b) (1UL << (b))
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define clockCyclesPerMicrosecond() (F_CPU / 1000000L)
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define constrain(a, lo, hi) ((a) < (lo) ? (lo) : ((a) > (hi) ? (hi) : (a)))
+
+// todos los pines estan en PORTB: el bit es el pin % 8 (DC = 7 da 0x80)
+#define digitalPinToInterrupt(p) ((p) == 18 ? 5 : ((p) == 2 ? 0 : -1))
+#define digitalPinToPort(p) (p)
+#define digitalPinToBitMask(p) (1 << ((p) % 8))
+#define portOutputRegister(p) (&PORTB)
+#define portInputRegister(p) (&PINB)
+#define portModeRegister(p) (&DDRB)
+
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper*)(s))
+#define PSTR(s) (s)
+
+extern unsigned long mockMs, mockUs; // millis() y micros()
+extern int mockButton;               // lo que lee digitalRead() de cualquier pin
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+void pinMode(uint8_t pin, uint8_t mode);
+int analogRead(uint8_t pin);
+void attachInterrupt(uint8_t n, void (*fn)(void), int mode);
+void detachInterrupt(uint8_t n);
+void tone(uint8_t pin, unsigned int hz, unsigned long ms = 0);
+void noTone(uint8_t pin);
+long random(long hi);
+long random(long lo, long hi);
+void randomSeed(unsigned long seed);
+
+inline char* itoa(int v, char* s, int) {
+    sprintf(s, "%d", v);
+    return s;
+}
+
+class Print {
+public:
+    virtual size_t write(uint8_t c) = 0;
+    size_t write(const uint8_t* buf, size_t n);
+    int availableForWrite();
+
+    size_t print(const char* s);
+    size_t print(const __FlashStringHelper* s);
+    size_t print(char c);
+    size_t print(int v, int base = 10);
+    size_t print(unsigned int v, int base = 10);
+    size_t print(long v, int base = 10);
+    size_t print(unsigned long v, int base = 10);
+    size_t print(double v, int digits = 2);
+
+    size_t println();
+    size_t println(const char* s);
+    size_t println(const __FlashStringHelper* s);
+    size_t println(char c);
+    size_t println(int v, int base = 10);
+    size_t println(unsigned int v, int base = 10);
+    size_t println(long v, int base = 10);
+    size_t println(unsigned long v, int base = 10);
+    size_t println(double v, int digits = 2);
+};
+
+#define SERIAL_TX_BUFFER_SIZE 64
+
+// sale por stderr. El buffer de salida es el del core (63 bytes) y se
+// vacia a 9600 baudios con mockUs; un byte que lo encuentra lleno es uno
+// que en la placa haria esperar a write(), y se cuenta en mockSerialBlocked
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud);
+    int available();
+    int read();
+    size_t write(uint8_t c);
+    int availableForWrite();
+    void flush();
+    operator bool();
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+extern long mockSerialBlocked;
+
+#endif
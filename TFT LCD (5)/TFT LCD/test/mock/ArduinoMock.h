@@ -0,0 +1,342 @@
+#ifndef ArduinoMock_h
+#define ArduinoMock_h
+
+// Lo que hace el Arduino de mentira (Arduino.h, SPI.h, avr/, Adafruit).
+// Cada prueba es un solo .cpp y lo incluye una vez, despues de lo que
+// prueba.
+
+#include <stdarg.h>
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_ILI9341.h>
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+#include "MockPanel.h"
+
+volatile uint8_t SREG, SPCR, SPSR, SPDR, PORTB, PINB, DDRB, PORTD, PIND, DDRD,
+    PORTE, PINE, DDRE, PORTH, DDRH, PORTJ, DDRJ, GPIOR0, MCUSR, WDTCSR, SMCR, RAMPZ,
+    EECR, EEDR, EIMSK, EICRA, EICRB, EIFR, TCCR0A, TCCR0B, TCNT0, OCR0A, TCCR1A, TCCR1B,
+    TCCR2A, TCCR2B, TCNT2, OCR2A, OCR2B, ASSR, TIMSK0, TIMSK1, TIMSK2, TIFR1, TIFR2,
+    UCSR0A, UCSR0B, UCSR0C, UDR0, UCSR1A, UCSR1B, UCSR1C, UDR1,
+    UCSR2A, UCSR2B, UCSR2C, UDR2, UCSR3A, UCSR3B, UCSR3C, UDR3;
+volatile uint16_t OCR1A, TCNT1, ICR1, EEAR, UBRR0, UBRR1, UBRR2, UBRR3;
+volatile uintptr_t SP;
+
+// los 2 KB de RAM del AVR (MemMonitor.h los recorre)
+extern "C" {
+struct __freelist;
+char mockRam[2048] asm("__heap_start");
+char* __brkval = 0;
+struct __freelist* __flp = 0;
+}
+
+// al arrancar la RAM queda pintada con el canario de MemMonitor.h (0xC5)
+// y la pila empieza cerca del final, como en el AVR
+static struct MockBoot {
+    MockBoot() {
+        memset(mockRam, 0xC5, sizeof(mockRam));
+        SP = (uintptr_t)(mockRam + sizeof(mockRam) - 48);
+    }
+} mockBoot;
+
+unsigned long mockMs = 0, mockUs = 0;
+int mockButton = LOW;
+MockPanel mockPanel;
+void (*mockSpiHook)(uint8_t b) = 0;
+HardwareSerial Serial;
+SPIClass SPI;
+
+// ---- tiempo, pines y lo demas ----
+
+unsigned long millis() { return mockMs; }
+unsigned long micros() { return mockUs; }
+
+void delay(unsigned long ms) {
+    mockMs += ms;
+    mockUs += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) { mockUs += us; }
+int digitalRead(uint8_t) { return mockButton; }
+void digitalWrite(uint8_t, uint8_t) {}
+void pinMode(uint8_t, uint8_t) {}
+int analogRead(uint8_t) { return 0; }
+void attachInterrupt(uint8_t, void (*)(void), int) {}
+void detachInterrupt(uint8_t) {}
+void tone(uint8_t, unsigned int, unsigned long) {}
+void noTone(uint8_t) {}
+long random(long hi) { return rand() % hi; }
+long random(long lo, long hi) { return lo + rand() % (hi - lo); }
+void randomSeed(unsigned long seed) { srand(seed); }
+
+// dormir es esperar la interrupcion que sigue: 100 us
+void set_sleep_mode(int) {}
+void sleep_enable() {}
+void sleep_disable() {}
+void sleep_cpu() {
+    mockUs += 100;
+    if (mockUs / 1000 > mockMs) {
+        mockMs = mockUs / 1000;
+    }
+}
+void sleep_mode() { sleep_cpu(); }
+
+void wdt_enable(int) {}
+void wdt_reset() {}
+void wdt_disable() {}
+
+// ---- Print y Serial ----
+
+size_t Print::write(const uint8_t* buf, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        write(buf[i]);
+    }
+    return n;
+}
+
+int Print::availableForWrite() { return SERIAL_TX_BUFFER_SIZE - 1; }
+
+size_t Print::print(const char* s) {
+    size_t n = 0;
+    while (*s) {
+        n += write(*s++);
+    }
+    return n;
+}
+
+size_t Print::print(const __FlashStringHelper* s) { return print((const char*)s); }
+size_t Print::print(char c) { return write(c); }
+
+static size_t printFormat(Print& out, const char* format, ...) {
+    char buf[32];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    return out.print(buf);
+}
+
+size_t Print::print(int v, int) { return printFormat(*this, "%d", v); }
+size_t Print::print(unsigned int v, int) { return printFormat(*this, "%u", v); }
+size_t Print::print(long v, int) { return printFormat(*this, "%ld", v); }
+size_t Print::print(unsigned long v, int) { return printFormat(*this, "%lu", v); }
+size_t Print::print(double v, int digits) { return printFormat(*this, "%.*f", digits, v); }
+
+size_t Print::println() { return write('\n'); }
+size_t Print::println(const char* s) { return print(s) + println(); }
+size_t Print::println(const __FlashStringHelper* s) { return print(s) + println(); }
+size_t Print::println(char c) { return print(c) + println(); }
+size_t Print::println(int v, int base) { return print(v, base) + println(); }
+size_t Print::println(unsigned int v, int base) { return print(v, base) + println(); }
+size_t Print::println(long v, int base) { return print(v, base) + println(); }
+size_t Print::println(unsigned long v, int base) { return print(v, base) + println(); }
+size_t Print::println(double v, int digits) { return print(v, digits) + println(); }
+
+// el buffer de salida: cuantos bytes quedan y desde cuando sale el primero
+#define MOCK_SERIAL_BYTE_US 1042 // 10 bits a 9600 baudios
+long mockSerialBlocked = 0;
+static unsigned long mockTxLevel = 0, mockTxSince = 0;
+
+static void mockTxDrain() {
+    unsigned long sent = (mockUs - mockTxSince) / MOCK_SERIAL_BYTE_US;
+    if (sent >= mockTxLevel) {
+        mockTxLevel = 0;
+        mockTxSince = mockUs;
+    } else {
+        mockTxLevel -= sent;
+        mockTxSince += sent * MOCK_SERIAL_BYTE_US;
+    }
+}
+
+void HardwareSerial::begin(unsigned long) {}
+int HardwareSerial::available() { return 0; }
+int HardwareSerial::read() { return -1; }
+
+// lleno: en la placa se esperaria a que salga uno; aca el reloj no se mueve
+size_t HardwareSerial::write(uint8_t c) {
+    fputc(c, stderr);
+    mockTxDrain();
+    if (mockTxLevel >= SERIAL_TX_BUFFER_SIZE - 1) {
+        mockSerialBlocked++;
+    } else {
+        mockTxLevel++;
+    }
+    return 1;
+}
+
+int HardwareSerial::availableForWrite() {
+    mockTxDrain();
+    return SERIAL_TX_BUFFER_SIZE - 1 - mockTxLevel;
+}
+void HardwareSerial::flush() {}
+HardwareSerial::operator bool() { return true; }
+
+// ---- SPI: cada byte al panel, con DC de PORTB ----
+
+void SPIClass::begin() {}
+void SPIClass::beginTransaction(SPISettings) {}
+void SPIClass::endTransaction() {}
+void SPIClass::setClockDivider(uint8_t) {}
+
+uint8_t SPIClass::transfer(uint8_t b) {
+    if (mockSpiHook) {
+        mockSpiHook(b);
+    }
+    mockPanel.byte(b, PORTB & mockPanel.dcMask);
+    return 0;
+}
+
+// ---- Adafruit: directo al panel ----
+
+Adafruit_GFX::Adafruit_GFX(int16_t, int16_t)
+    : rotation(0), cursorX(0), cursorY(0), textSize(1), textColor(0xFFFF) {}
+
+int16_t Adafruit_GFX::width() { return rotation & 1 ? MOCK_PANEL_H : MOCK_PANEL_W; }
+int16_t Adafruit_GFX::height() { return rotation & 1 ? MOCK_PANEL_W : MOCK_PANEL_H; }
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+    static const uint8_t madctl[4] = { 0x48, 0x28, 0x88, 0xE8 };
+    rotation = r & 3;
+    mockPanel.madctl = madctl[rotation];
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
+    for (int j = 0; j < h; j++) {
+        for (int i = 0; i < w; i++) {
+            drawPixel(x + i, y + j, bitmap[j * w + i]);
+        }
+    }
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, uint16_t* bitmap, int16_t w, int16_t h) {
+    drawRGBBitmap(x, y, (const uint16_t*)bitmap, w, h);
+}
+
+// solo horizontales y verticales, las que usa el juego
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (y0 == y1) {
+        for (int x = min(x0, x1); x <= max(x0, x1); x++) {
+            drawPixel(x, y0, color);
+        }
+    } else if (x0 == x1) {
+        for (int y = min(y0, y1); y <= max(y0, y1); y++) {
+            drawPixel(x0, y, color);
+        }
+    }
+}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    drawLine(x0, y0, x1, y1, color);
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawLine(x, y, x + w - 1, y, color);
+    drawLine(x, y + h - 1, x + w - 1, y + h - 1, color);
+    drawLine(x, y, x, y + h - 1, color);
+    drawLine(x + w - 1, y, x + w - 1, y + h - 1, color);
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+    for (int y = 0; y < height(); y++) {
+        for (int x = 0; x < width(); x++) {
+            drawPixel(x, y, color);
+        }
+    }
+}
+
+void Adafruit_GFX::drawChar(int16_t, int16_t, unsigned char, uint16_t, uint16_t, uint8_t) {}
+void Adafruit_GFX::setTextColor(uint16_t color) { textColor = color; }
+void Adafruit_GFX::setTextColor(uint16_t color, uint16_t) { textColor = color; }
+void Adafruit_GFX::setTextSize(uint8_t size) { textSize = size; }
+
+void Adafruit_GFX::setCursor(int16_t x, int16_t y) {
+    cursorX = x;
+    cursorY = y;
+}
+
+int16_t Adafruit_GFX::getCursorX() { return cursorX; }
+int16_t Adafruit_GFX::getCursorY() { return cursorY; }
+
+size_t Adafruit_GFX::write(uint8_t c) {
+    if (c == '\n') {
+        cursorX = 0;
+        cursorY += 8 * textSize;
+        return 1;
+    }
+    for (int j = 0; j < 7 * textSize; j++) {
+        for (int i = 0; i < 5 * textSize; i++) {
+            drawPixel(cursorX + i, cursorY + j, textColor);
+        }
+    }
+    cursorX += 6 * textSize;
+    return 1;
+}
+
+Adafruit_ILI9341::Adafruit_ILI9341(int8_t, int8_t, int8_t, int8_t, int8_t, int8_t) : Adafruit_GFX(240, 320) {}
+Adafruit_ILI9341::Adafruit_ILI9341(int8_t, int8_t, int8_t) : Adafruit_GFX(240, 320) {}
+void Adafruit_ILI9341::begin(uint32_t) { setRotation(0); }
+void Adafruit_ILI9341::setRotation(uint8_t r) { Adafruit_GFX::setRotation(r); }
+
+void Adafruit_ILI9341::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x >= 0 && x < width() && y >= 0 && y < height()) {
+        mockPanel.put(x, y, color);
+        mockPanel.pixels++;
+    }
+}
+
+void Adafruit_ILI9341::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int j = 0; j < h; j++) {
+        for (int i = 0; i < w; i++) {
+            drawPixel(x + i, y + j, color);
+        }
+    }
+}
+
+void Adafruit_ILI9341::startWrite() {}
+void Adafruit_ILI9341::endWrite() {}
+// como la de verdad deja DC arriba: lo que siga por SPI.transfer son pixeles
+void Adafruit_ILI9341::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    mockPanel.window(x, y, w, h);
+    PORTB |= mockPanel.dcMask;
+}
+void Adafruit_ILI9341::writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+
+void Adafruit_ILI9341::writeColor(uint16_t color, uint32_t n) {
+    while (n--) {
+        mockPanel.pixel(color);
+    }
+}
+
+void Adafruit_ILI9341::writePixels(uint16_t* colors, uint32_t n, bool, bool) {
+    while (n--) {
+        mockPanel.pixel(*colors++);
+    }
+}
+
+void Adafruit_ILI9341::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { fillRect(x, y, w, h, color); }
+void Adafruit_ILI9341::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { fillRect(x, y, w, 1, color); }
+void Adafruit_ILI9341::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { fillRect(x, y, 1, h, color); }
+void Adafruit_ILI9341::writeCommand(uint8_t cmd) { mockPanel.command(cmd); }
+
+void Adafruit_ILI9341::sendCommand(uint8_t cmd, const uint8_t* data, uint8_t n) {
+    mockPanel.command(cmd);
+    for (uint8_t i = 0; i < n; i++) {
+        mockPanel.byte(data[i], true);
+    }
+}
+
+void Adafruit_ILI9341::spiWrite(uint8_t b) { mockPanel.byte(b, true); }
+void Adafruit_ILI9341::SPI_WRITE16(uint16_t color) { mockPanel.pixel(color); }
+void Adafruit_ILI9341::SPI_CS_LOW() {}
+void Adafruit_ILI9341::SPI_CS_HIGH() {}
+void Adafruit_ILI9341::SPI_DC_LOW() { PORTB &= ~mockPanel.dcMask; }
+void Adafruit_ILI9341::SPI_DC_HIGH() { PORTB |= mockPanel.dcMask; }
+
+void Adafruit_ILI9341::setScrollMargins(uint16_t top, uint16_t bottom) {
+    mockPanel.tfa = top;
+    mockPanel.vsa = MOCK_PANEL_H - top - bottom;
+}
+
+void Adafruit_ILI9341::scrollTo(uint16_t y) { mockPanel.vsp = y; }
+
+#endif
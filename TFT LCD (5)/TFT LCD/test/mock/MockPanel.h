@@ -0,0 +1,160 @@
+#ifndef MockPanel_h
+#define MockPanel_h
+
+#include <stdint.h>
+#include <string.h>
+
+// ILI9341 de mentira: lo que le llega por SPI (SPI.transfer, con DC en
+// PORTB) o de la Adafruit de mentira queda en gram, la memoria del panel
+// en filas y columnas fisicas. Entiende lo que usa el juego:
+//   CASET 0x2A, PASET 0x2B   la ventana
+//   RAMWR 0x2C               pixeles de 16 bits, alto primero
+//   MADCTL 0x36              MV cambia filas por columnas, MX y MY espejan
+//   VSCRDEF 0x33, VSCRSADD 0x37   el scroll vertical por hardware
+// El resto de los comandos se ignora. shown() es lo que se ve en el vidrio
+// (con el scroll); at() es lo mismo parado, como lo dibuja la rotacion 0.
+
+#define MOCK_PANEL_W 240
+#define MOCK_PANEL_H 320
+
+class MockPanel {
+public:
+    uint16_t gram[MOCK_PANEL_H][MOCK_PANEL_W];
+    uint8_t madctl;
+    int tfa, vsa, vsp;  // VSCRDEF y VSCRSADD
+    long pixels;        // los que llegaron con RAMWR, desde reset()
+    long commands;
+    uint8_t dcMask;     // el bit de DC en PORTB (TFT_DC = 7)
+
+    MockPanel() : dcMask(0x80) {
+        reset();
+    }
+
+    void reset() {
+        memset(gram, 0, sizeof(gram));
+        madctl = 0x48;
+        tfa = 0;
+        vsa = MOCK_PANEL_H;
+        vsp = 0;
+        pixels = 0;
+        commands = 0;
+        cmd = 0;
+        argc = 0;
+        x0 = y0 = 0;
+        x1 = MOCK_PANEL_W - 1;
+        y1 = MOCK_PANEL_H - 1;
+        cx = cy = 0;
+        half = false;
+    }
+
+    // un byte del SPI; dc false es un comando
+    void byte(uint8_t b, bool dc) {
+        if (!dc) {
+            command(b);
+            return;
+        }
+        if (cmd == 0x2C) {
+            if (!half) {
+                hi = b;
+                half = true;
+            } else {
+                half = false;
+                pixel(hi << 8 | b);
+            }
+            return;
+        }
+        if (argc < sizeof(args)) {
+            args[argc] = b;
+        }
+        argc++;
+        if (cmd == 0x2A && argc == 4) {
+            x0 = args[0] << 8 | args[1];
+            x1 = args[2] << 8 | args[3];
+        } else if (cmd == 0x2B && argc == 4) {
+            y0 = args[0] << 8 | args[1];
+            y1 = args[2] << 8 | args[3];
+        } else if (cmd == 0x36 && argc == 1) {
+            madctl = args[0];
+        } else if (cmd == 0x33 && argc == 6) {
+            tfa = args[0] << 8 | args[1];
+            vsa = args[2] << 8 | args[3];
+        } else if (cmd == 0x37 && argc == 2) {
+            vsp = args[0] << 8 | args[1];
+        }
+    }
+
+    void command(uint8_t c) {
+        cmd = c;
+        argc = 0;
+        half = false;
+        cx = x0;
+        cy = y0;
+        commands++;
+    }
+
+    // lo mismo que CASET + PASET + RAMWR (la Adafruit de mentira)
+    void window(int x, int y, int w, int h) {
+        x0 = x;
+        x1 = x + w - 1;
+        y0 = y;
+        y1 = y + h - 1;
+        command(0x2C);
+    }
+
+    // el pixel que sigue de la ventana
+    void pixel(uint16_t color) {
+        put(cx, cy, color);
+        pixels++;
+        if (++cx > x1) {
+            cx = x0;
+            cy++;
+        }
+    }
+
+    // (x, y) como los ve el que dibuja, segun MADCTL
+    void put(int x, int y, uint16_t color) {
+        int row = y, col = x;
+        if (madctl & 0x20) {
+            row = x;
+            col = y;
+        }
+        if (madctl & 0x40) {
+            col = MOCK_PANEL_W - 1 - col;
+        }
+        if (madctl & 0x80) {
+            row = MOCK_PANEL_H - 1 - row;
+        }
+        if (row >= 0 && row < MOCK_PANEL_H && col >= 0 && col < MOCK_PANEL_W) {
+            gram[row][col] = color;
+        }
+    }
+
+    // la fila de gram que se ve en la fila `row` del vidrio
+    int scanRow(int row) const {
+        if (row < tfa || row >= tfa + vsa) {
+            return row;
+        }
+        return tfa + ((row - tfa) + (vsp - tfa)) % vsa;
+    }
+
+    uint16_t shown(int row, int col) const {
+        return gram[scanRow(row)][col];
+    }
+
+    // (x, y) en la pantalla parada (rotacion 0, MADCTL 0x48)
+    uint16_t at(int x, int y) const {
+        return shown(y, MOCK_PANEL_W - 1 - x);
+    }
+
+private:
+    uint8_t cmd;
+    uint8_t args[8];
+    uint8_t argc;
+    int x0, x1, y0, y1, cx, cy;
+    uint16_t hi;
+    bool half;
+};
+
+extern MockPanel mockPanel;
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef SPI_h
+#define SPI_h
+
+// cada byte de SPI.transfer() va al panel de mentira (MockPanel.h), que
+// ve DC en PORTB; mockSpiHook, si esta, lo ve antes
+#include <Arduino.h>
+
+#define SPI_MODE0 0
+#define MSBFIRST 1
+
+class SPISettings {
+public:
+    SPISettings() {}
+    SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+public:
+    void begin();
+    void beginTransaction(SPISettings settings);
+    void endTransaction();
+    uint8_t transfer(uint8_t b);
+    void setClockDivider(uint8_t div);
+};
+
+extern SPIClass SPI;
+extern void (*mockSpiHook)(uint8_t b);
+
+#endif
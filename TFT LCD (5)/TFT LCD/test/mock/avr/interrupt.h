@@ -0,0 +1,11 @@
+#ifndef mock_avr_interrupt_h
+#define mock_avr_interrupt_h
+
+// una interrupcion es una funcion comun: la prueba la llama cuando quiere
+#define ISR(v, ...) extern "C" void v(void); void v(void)
+#define ISR_NOBLOCK
+#define ISR_NAKED
+#define cli()
+#define sei()
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef mock_avr_io_h
+#define mock_avr_io_h
+
+// Registros del ATmega2560 como variables comunes (ArduinoMock.h). Leerlos
+// y escribirlos no hace nada por si solo; la prueba mira lo que quedo o
+// los pone a mano (SPSR, MCUSR...). La RAM del chip son los 2 KB de
+// mockRam, que empiezan en __heap_start como en el AVR, y SP es la pila.
+
+#include <stdint.h>
+
+extern volatile uint8_t SREG, SPCR, SPSR, SPDR, PORTB, PINB, DDRB, PORTD, PIND, DDRD,
+    PORTE, PINE, DDRE, PORTH, DDRH, PORTJ, DDRJ, GPIOR0, MCUSR, WDTCSR, SMCR, RAMPZ,
+    EECR, EEDR, EIMSK, EICRA, EICRB, EIFR, TCCR0A, TCCR0B, TCNT0, OCR0A, TCCR1A, TCCR1B,
+    TCCR2A, TCCR2B, TCNT2, OCR2A, OCR2B, ASSR, TIMSK0, TIMSK1, TIMSK2, TIFR1, TIFR2,
+    UCSR0A, UCSR0B, UCSR0C, UDR0, UCSR1A, UCSR1B, UCSR1C, UDR1,
+    UCSR2A, UCSR2B, UCSR2C, UDR2, UCSR3A, UCSR3B, UCSR3C, UDR3;
+extern volatile uint16_t OCR1A, TCNT1, ICR1, EEAR, UBRR0, UBRR1, UBRR2, UBRR3;
+extern volatile uintptr_t SP;
+
+extern "C" char __heap_start; // = mockRam
+extern "C" char* __brkval;
+
+#define RAMSTART 0x200
+#define RAMEND ((uintptr_t)&__heap_start + 2047)
+#define FLASHEND 0x3FFFF
+#define E2END 0xFFF
+
+#define SREG_I 7
+// SPI
+#define SPR0 0
+#define SPR1 1
+#define MSTR 4
+#define SPE 6
+#define SPIE 7
+#define SPI2X 0
+#define WCOL 6
+#define SPIF 7
+// reset y watchdog
+#define PORF 0
+#define EXTRF 1
+#define BORF 2
+#define WDRF 3
+#define WDP0 0
+#define WDP1 1
+#define WDP2 2
+#define WDE 3
+#define WDCE 4
+#define WDP3 5
+#define WDIE 6
+// EEPROM
+#define EERE 0
+#define EEPE 1
+#define EEMPE 2
+#define EERIE 3
+// timers
+#define CS10 0
+#define CS11 1
+#define CS12 2
+#define WGM12 3
+#define WGM13 4
+#define OCIE1A 1
+#define CS20 0
+#define CS21 1
+#define CS22 2
+#define WGM20 0
+#define WGM21 1
+#define WGM22 3
+#define COM2B1 5
+#define COM2A1 7
+#define TOIE2 0
+#define OCIE2A 1
+#define TOV2 0
+// USART (los mismos bits en las cuatro)
+#define UCPOL0 0
+#define UCPHA0 1
+#define UDORD0 2
+#define TXEN0 3
+#define RXEN0 4
+#define UDRIE0 5
+#define UMSEL00 6
+#define UMSEL01 7
+#define UDRE0 5
+#define TXC0 6
+#define TXEN2 3
+#define UMSEL20 6
+#define UMSEL21 7
+#define UDRE2 5
+#define TXC2 6
+#define TXEN3 3
+#define UMSEL30 6
+#define UMSEL31 7
+#define UDRE3 5
+#define TXC3 6
+// interrupciones externas y pines
+#define INT3 3
+#define INTF3 3
+#define PD2 2
+#define PD3 3
+#define PD4 4
+#define PE4 4
+#define PH2 2
+#define SE 0
+
+#endif
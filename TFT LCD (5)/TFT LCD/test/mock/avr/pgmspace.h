@@ -0,0 +1,25 @@
+#ifndef mock_avr_pgmspace_h
+#define mock_avr_pgmspace_h
+
+// en la PC la flash es la misma memoria: PROGMEM no hace nada y las
+// lecturas "lejanas" son punteros comunes
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char*
+typedef uintptr_t uint_farptr_t;
+
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_ptr(p) (*(void* const*)(p))
+#define pgm_read_byte_near pgm_read_byte
+#define pgm_read_word_near pgm_read_word
+#define pgm_read_byte_far(a) (*(const uint8_t*)(uintptr_t)(a))
+#define pgm_read_word_far(a) (*(const uint16_t*)(uintptr_t)(a))
+#define pgm_get_far_address(v) ((uint_farptr_t)(uintptr_t)&(v))
+#define strlen_P strlen
+#define memcpy_P memcpy
+
+#endif
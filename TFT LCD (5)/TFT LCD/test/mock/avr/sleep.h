@@ -0,0 +1,12 @@
+#ifndef mock_avr_sleep_h
+#define mock_avr_sleep_h
+
+// dormir adelanta el reloj 100 us (ArduinoMock.h)
+#define SLEEP_MODE_IDLE 0
+void set_sleep_mode(int mode);
+void sleep_enable();
+void sleep_disable();
+void sleep_cpu();
+void sleep_mode();
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef mock_avr_wdt_h
+#define mock_avr_wdt_h
+
+#define WDTO_500MS 5
+#define WDTO_1S 6
+#define WDTO_2S 7
+void wdt_enable(int timeout);
+void wdt_reset();
+void wdt_disable();
+
+#endif
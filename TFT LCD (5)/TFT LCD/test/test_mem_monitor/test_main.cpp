@@ -0,0 +1,98 @@
+// MemMonitor.h sobre los 2 KB de mockRam: la prueba pinta la RAM como
+// .init1, pone el SP y el tope del heap a mano y ensucia lo que la pila
+// "uso". Las direcciones son relativas a __heap_start (mockRam[0]).
+
+#include <unity.h>
+#include "MemMonitor.h"
+#include "ArduinoMock.h"
+
+void setUp() {
+    memset(mockRam, MEM_CANARY, sizeof(mockRam));
+    SP = (uintptr_t)(mockRam + 1500);
+    __brkval = 0;
+    __flp = 0;
+}
+
+void tearDown() {}
+
+// lo que toco la pila deja de estar pintado: de ahi sale el pico
+void test_stack_peak_and_free() {
+    MemMonitor mem;
+    memset(mockRam + 1600, 0x11, sizeof(mockRam) - 1600);
+    MemStats s = mem.measure();
+    TEST_ASSERT_EQUAL(sizeof(mockRam) - 1600, s.stackPeak);
+    TEST_ASSERT_EQUAL(1600, s.minFree);
+    TEST_ASSERT_EQUAL(0, s.heapUsed);
+    TEST_ASSERT_TRUE(mem.check());
+}
+
+// el pico no baja aunque despues aparezcan bytes con el canario debajo
+// (un byte de la pila que justo valga MEM_CANARY)
+void test_peak_is_kept() {
+    MemMonitor mem;
+    memset(mockRam + 1200, 0x11, sizeof(mockRam) - 1200);
+    mem.measure();
+    memset(mockRam + 1200, MEM_CANARY, 400);
+    MemStats s = mem.measure();
+    TEST_ASSERT_EQUAL(1200, s.minFree);
+}
+
+// con malloc lo libre se cuenta desde el tope mas alto del heap
+void test_heap_top() {
+    MemMonitor mem;
+    memset(mockRam + 1600, 0x11, sizeof(mockRam) - 1600);
+    __brkval = mockRam + 300;
+    MemStats s = mem.measure();
+    TEST_ASSERT_EQUAL(300, s.heapUsed);
+    TEST_ASSERT_EQUAL(1300, s.minFree);
+    __brkval = mockRam + 100;
+    s = mem.measure();
+    TEST_ASSERT_EQUAL(100, s.heapUsed);
+    TEST_ASSERT_EQUAL(1300, s.minFree);
+}
+
+// un byte pisado en la guarda encima del heap es un choque, y queda marcado
+void test_guard_touched() {
+    MemMonitor mem;
+    __brkval = mockRam + 100;
+    TEST_ASSERT_TRUE(mem.check());
+    mockRam[100 + MEM_GUARD - 1] = 0;
+    TEST_ASSERT_FALSE(mem.check());
+    mockRam[100 + MEM_GUARD - 1] = MEM_CANARY;
+    TEST_ASSERT_FALSE(mem.check());
+    TEST_ASSERT_TRUE(mem.hasCollided());
+}
+
+// el SP dentro de la guarda tambien, aunque todavia no haya escrito nada
+void test_stack_pointer_in_guard() {
+    MemMonitor mem;
+    __brkval = mockRam + 100;
+    SP = (uintptr_t)(mockRam + 100 + MEM_GUARD - 1);
+    TEST_ASSERT_FALSE(mem.check());
+}
+
+// un bloque libre de malloc del mismo tamaño que el hueco hasta la pila:
+// el mas grande es la mitad de lo libre
+void test_fragmentation() {
+    MemMonitor mem;
+    SP = (uintptr_t)(mockRam + 1000);
+    __brkval = mockRam + 400;
+    struct __freelist* f = (struct __freelist*)(mockRam + 64);
+    f->sz = 600 - sizeof(size_t);
+    f->nx = 0;
+    __flp = f;
+    MemStats s = mem.measure();
+    TEST_ASSERT_EQUAL(600, s.heapFree);
+    TEST_ASSERT_EQUAL(50, s.fragPct);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_stack_peak_and_free);
+    RUN_TEST(test_peak_is_kept);
+    RUN_TEST(test_heap_top);
+    RUN_TEST(test_guard_touched);
+    RUN_TEST(test_stack_pointer_in_guard);
+    RUN_TEST(test_fragmentation);
+    return UNITY_END();
+}
@@ -0,0 +1,171 @@
+// RenderQueue.h como corre en el AVR (las tandas de la interrupcion, SPDR,
+// SPIF) contra un SPI de mentira: escribir SPDR arranca un byte, que
+// termina despues de unas lecturas de SPSR o cuando "llega" la interrupcion.
+// Se cuenta si se escribe SPDR con un byte saliendo, si DC cambia o CS sube
+// en medio de un byte, y cuantas interrupciones hacen falta. Lo que sale va
+// al panel de mentira para mirar los pixeles.
+
+#include <unity.h>
+#include <Arduino.h>
+#include <SPI.h>
+#include "Font5x7.h"
+#include "MockPanel.h"
+
+static bool shifting = false, spif = false;
+static int collisions = 0, dcBusy = 0, csBusy = 0;
+static long bytesSent = 0, interrupts = 0;
+static uint8_t dcReg = 0, csReg = 0, dcAtWrite = 0;
+
+// el byte que estaba saliendo termina
+static void complete() {
+    if (dcReg != dcAtWrite) {
+        dcBusy++;
+    }
+    if (csReg & 1) {
+        csBusy++;
+    }
+    shifting = false;
+    spif = true;
+}
+
+struct MockSpdr {
+    operator uint8_t() const {
+        spif = false;
+        return 0;
+    }
+    MockSpdr& operator=(uint8_t b) {
+        if (shifting) {
+            collisions++;
+        }
+        spif = false;
+        shifting = true;
+        dcAtWrite = dcReg;
+        bytesSent++;
+        mockPanel.byte(b, dcReg & 1);
+        return *this;
+    }
+};
+
+// cada tercera lectura con un byte saliendo lo termina: esperar SPIF anda
+struct MockSpsr {
+    int reads;
+    operator uint8_t() {
+        if (shifting && ++reads % 3 == 0) {
+            complete();
+        }
+        return spif ? _BV(SPIF) : 0;
+    }
+    MockSpsr& operator=(uint8_t) {
+        return *this;
+    }
+};
+
+static MockSpdr mockSpdr;
+static MockSpsr mockSpsr;
+static uint8_t mockSpcr, mockSreg;
+
+#define SPDR mockSpdr
+#define SPSR mockSpsr
+#define SPCR mockSpcr
+#define SREG mockSreg
+#define __AVR__ 1
+#define private public
+#include "RenderQueue.h"
+#undef private
+#undef __AVR__
+#undef SPDR
+#undef SPSR
+#undef SPCR
+#undef SREG
+#include "ArduinoMock.h"
+
+// hasta que se vacie la cola: el byte en curso termina y, si la
+// interrupcion esta prendida, entra (y SPIF se limpia al entrar)
+static void drain() {
+    while (renderQueue.busy) {
+        if (shifting) {
+            complete();
+        }
+        if (spif && (mockSpcr & _BV(SPIE))) {
+            spif = false;
+            interrupts++;
+            SPI_STC_vect();
+        }
+    }
+}
+
+static const uint16_t image[4 * 3] PROGMEM = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+void setUp() {
+    shifting = spif = false;
+    collisions = dcBusy = csBusy = 0;
+    bytesSent = interrupts = 0;
+    mockPanel.reset();
+    mockPanel.madctl = 0; // gram[y][x]
+    renderQueue.csPort = &csReg;
+    renderQueue.csMask = 1;
+    renderQueue.dcPort = &dcReg;
+    renderQueue.dcMask = 1;
+    mockSpcr = _BV(SPE) | _BV(MSTR) | _BV(SPR0); // como lo deja la libreria
+    renderQueue.fill(0, 0, 32, 32, ILI9341_RED);
+    renderQueue.blit(40, 6, 2, 3, (uint_farptr_t)(uintptr_t)image, 2);
+    renderQueue.glyph(60, 10, 'A', 2, ILI9341_GREEN);
+    drain();
+}
+
+void tearDown() {}
+
+void test_pixels() {
+    TEST_ASSERT_EQUAL_HEX16(ILI9341_RED, mockPanel.gram[0][0]);
+    TEST_ASSERT_EQUAL_HEX16(ILI9341_RED, mockPanel.gram[31][31]);
+    TEST_ASSERT_EQUAL_HEX16(ILI9341_BLACK, mockPanel.gram[32][32]);
+    // la imagen es de 4 de ancho: se copian 2 columnas y se saltan 2
+    for (int j = 0; j < 3; j++) {
+        for (int i = 0; i < 2; i++) {
+            TEST_ASSERT_EQUAL(image[j * 4 + i], mockPanel.gram[6 + j][40 + i]);
+        }
+    }
+    // cada bit de la letra es un cuadrado de 2x2
+    long on = 0;
+    for (int col = 0; col < 5; col++) {
+        uint8_t bits = FONT_5X7[('A' - ' ') * 5 + col];
+        for (int row = 0; row < 8; row++) {
+            uint16_t expect = bits >> row & 1 ? ILI9341_GREEN : ILI9341_BLACK;
+            TEST_ASSERT_EQUAL_HEX16(expect, mockPanel.gram[10 + row * 2 + 1][60 + col * 2 + 1]);
+            on += bits >> row & 1;
+        }
+    }
+    TEST_ASSERT_EQUAL(32 * 32 + 2 * 3 + on * 4, mockPanel.pixels);
+}
+
+// nunca se pisa un byte, y DC y CS no cambian mientras sale uno
+void test_bus_rules() {
+    TEST_ASSERT_EQUAL(0, collisions);
+    TEST_ASSERT_EQUAL(0, dcBusy);
+    TEST_ASSERT_EQUAL(0, csBusy);
+    TEST_ASSERT_TRUE(csReg & 1);
+}
+
+// hasta RENDER_QUEUE_BURST bytes por interrupcion, no uno: a fck/2 la
+// interrupcion tarda mas que el byte
+void test_bytes_per_interrupt() {
+    TEST_ASSERT_TRUE(bytesSent > 2048);
+    TEST_ASSERT_TRUE(interrupts <= bytesSent / 16);
+    TEST_ASSERT_TRUE(interrupts * RENDER_QUEUE_BURST >= bytesSent - RENDER_QUEUE_BURST);
+    TEST_ASSERT_TRUE(interrupts <= bytesSent / RENDER_QUEUE_BURST + 1);
+}
+
+// al terminar el SPI queda como estaba (la interrupcion apagada)
+void test_spi_restored() {
+    TEST_ASSERT_EQUAL_HEX8(_BV(SPE) | _BV(MSTR) | _BV(SPR0), mockSpcr);
+    TEST_ASSERT_FALSE(renderQueue.busy);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_pixels);
+    RUN_TEST(test_bus_rules);
+    RUN_TEST(test_bytes_per_interrupt);
+    RUN_TEST(test_spi_restored);
+    return UNITY_END();
+}
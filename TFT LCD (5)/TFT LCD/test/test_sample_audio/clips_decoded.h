@@ -0,0 +1,816 @@
+#ifndef clips_decoded_h
+#define clips_decoded_h
+
+// Generado por tools/gen_sound_clips.py --fixture, no editar a mano.
+// Lo que tiene que sacar SampleAudio.h de cada clip de SoundClips.h.
+
+#include <stdint.h>
+
+const int8_t CLIP_COIN_DECODED[1120] = {
+    0, 2, 4, 2, -8, -12, -12, -6, 15, 22, 21, 10, -21, -31, -29, -15,
+    27, 41, 38, 20, -33, -49, -47, -25, 38, 58, 56, 31, -42, -66, -65, -37,
+    46, 74, 74, 43, -50, -82, -82, -50, 53, 87, 87, 53, -50, -85, -87, -55,
+    47, 83, 87, 57, -45, -82, -87, -58, 42, 80, 87, 60, -39, -78, -87, -61,
+    37, 76, 86, 62, -34, -74, -86, -64, 32, 72, 86, 65, -29, -70, -85, -66,
+    27, 68, 84, 67, 26, -66, -84, -68, -28, 63, 83, 69, 30, -61, -82, -70,
+    -32, 59, 81, 70, 34, -57, -80, -71, -36, 55, 79, 72, 37, -52, -78, -72,
+    -39, 50, 76, 73, 41, -48, -75, -73, -42, 46, 74, 73, 44, -43, -72, -73,
+    -45, 41, 71, 73, 47, -39, -69, -73, -48, 37, 68, 73, 49, -34, -66, -73,
+    -51, 32, 65, 73, 52, -30, -63, -73, -53, 28, 61, 72, 54, -26, -60, -72,
+    -55, 24, 58, 71, 56, -22, -56, -71, -57, -23, 54, 70, 58, 24, -53, -69,
+    -58, -26, 51, 68, 59, 27, -49, -68, -59, -29, 47, 67, 60, 31, -45, -66,
+    -60, -32, 43, 65, 61, 33, -41, -64, -61, -35, 39, 63, 61, 36, -37, -62,
+    -61, -37, 36, 60, 62, 39, -34, -59, -62, -40, 32, 58, 62, 41, -30, -57,
+    -61, -42, 28, 55, 61, 43, -26, -54, -61, -44, 24, 52, 61, 45, -23, -51,
+    -61, -46, 21, 50, 60, 47, -19, -48, -60, -47, -18, 47, 59, 48, 20, -45,
+    -59, -49, -21, 44, 58, 49, 22, -42, -57, -50, -24, 40, 57, 50, 25, -39,
+    -56, -51, -26, 37, 55, 51, 27, -36, -54, -51, -29, 34, 53, 51, 30, -32,
+    -52, -52, -31, 31, 51, 52, 32, -29, -50, -52, -33, 28, 49, 52, 34, -26,
+    -48, -52, -35, 25, 47, 52, 36, -23, -46, -51, -37, 21, 45, 51, 37, -20,
+    -44, -51, -38, 18, 42, 51, 39, -17, -41, -50, -39, 15, 40, 50, 40, 16,
+    -39, -50, -41, -17, 37, 49, 41, 18, -36, -48, -42, -19, 35, 48, 42, 20,
+    -33, -47, -42, -21, 32, 47, 43, 22, -31, -46, -43, -23, 29, 45, 43, 24,
+    -28, -44, -43, -25, 27, 44, 43, 26, -25, -43, -44, -27, 24, 42, 44, 28,
+    -23, -41, -44, -29, 21, 40, 43, 30, -20, -39, -43, -30, 19, 38, 43, 31,
+    -25, -43, -32, 24, 43, 32, -23, -42, -33, 22, 42, 33, -21, -41, -34, 20,
+    41, 34, -19, -40, -35, 17, 40, 35, -16, -39, -35, 15, 38, 36, -14, -38,
+    -36, 13, 37, 36, -12, -36, -37, -13, 36, 37, 14, -35, -37, -15, 34, 37,
+    15, -33, -37, -16, 33, 37, 17, -32, -37, -18, 31, 37, 19, -30, -37, -19,
+    29, 37, 20, -28, -37, -21, 28, 37, 21, -27, -37, -22, 26, 37, 23, -25,
+    -37, -23, 24, 37, 24, -23, -36, -25, 22, 36, 25, -21, -36, -26, 20, 35,
+    26, -19, -35, -27, 19, 35, 27, -18, -34, -28, 17, 34, 28, -16, -33, -28,
+    15, 33, 29, -14, -32, -29, 13, 32, 29, -12, -31, -30, 11, 31, 30, -11,
+    -30, -30, -10, 30, 30, 11, -29, -30, -12, 29, 31, 12, -28, -31, -13, 27,
+    31, 14, -27, -31, -14, 26, 31, 15, -25, -31, -16, 25, 31, 16, -24, -31,
+    -17, 23, 31, 17, -22, -31, -18, 22, 31, 18, -21, -30, -19, 20, 30, 19,
+    -20, -30, -20, 19, 30, 20, -18, -30, -21, 17, 29, 21, -17, -29, -22, 16,
+    29, 22, -15, -28, -22, 14, 28, 23, -14, -28, -23, 13, 27, 23, -12, -27,
+    -24, 11, 27, 24, -11, -26, -24, 10, 26, 24, -9, -25, -25, 8, 25, 25,
+    9, -24, -25, -9, 24, 25, 10, -23, -25, -10, 23, 25, 11, -22, -25, -11,
+    22, 25, 12, -21, -25, -12, 21, 25, 13, -20, -25, -13, 19, 25, 14, -19,
+    -25, -14, 18, 25, 15, -18, -25, -15, 17, 25, 16, -16, -25, -16, 16, 25,
+    17, -15, -25, -17, 15, 24, 17, -14, -24, -18, 13, 24, 18, -13, -24, -18,
+    12, 23, 19, -12, -23, -19, 11, 23, 19, -10, -22, -19, 10, 22, 20, -9,
+    -22, -20, 9, 21, 20, -8, -21, -20, 7, 21, 20, -7, -20, -20, -7, 20,
+    21, 8, -20, -21, -8, 19, 21, 9, -19, -21, -9, 18, 21, 10, -18, -21,
+    -10, 17, 21, 10, -17, -21, -11, 16, 21, 11, -16, -21, -12, 15, 21, 12,
+    -15, -21, -12, 14, 21, 13, -14, -21, -13, 13, 20, 13, -13, -20, -14, 12,
+    20, 14, -12, -20, -14, 11, 20, 15, -11, -20, -15, 10, 19, 15, -10, -19,
+    -15, 9, 19, 16, -9, -19, -16, 8, 18, 16, -8, -18, -16, 7, 18, 16,
+    -7, -18, -17, 6, 17, 17, -6, -17, -17, -6, 17, 17, 6, -16, -17, -6,
+    16, 17, 7, -16, -17, -7, 15, 17, 8, -15, -17, -8, 15, 17, 8, -14,
+    -17, -9, 14, 17, 9, -13, -17, -9, 13, 17, 10, -13, -17, -10, 12, 17,
+    10, -12, -17, -11, 11, 17, 11, -11, -17, -11, 11, 17, 11, -10, -17, -12,
+    10, 16, 12, -9, -16, -12, 9, 16, 12, -8, -16, -13, 8, 16, 13, -8,
+    -16, -13, 7, 15, 13, -7, -15, -13, 6, 15, 13, -6, -15, -14, 6, 14,
+    14, -5, -14, -14, 5, 14, 14, 5, -14, -14, -5, 13, 14, 5, -13, -14,
+    -6, 13, 14, 6, -12, -14, -6, 12, 14, 7, -12, -14, -7, 12, 14, 7,
+    -11, -14, -8, 11, 14, 8, -11, -14, -8, 10, 14, 8, -10, -14, -9, 10,
+    14, 9, -9, -14, -9, 9, 14, 9, -9, -14, -9, 8, 14, 10, -8, -13,
+    -10, 8, 13, 10, -7, -13, -10, 7, 13, 10, -6, -13, -11, 6, 13, 11,
+    -6, -13, -11, 5, 12, 11, -5, -12, -11, 5, 12, 11, -4, -12, -11, 4,
+    12, 11, -4, -11, -11, -4, 11, 12, 4, -11, -12, -5, 11, 12, 5, -10,
+    -12, -5, 10, 12, 5, -10, -12, -6, 10, 12, 6, -9, -12, -6, 9, 12,
+    6, -9, -12, -6, 9, 12, 7, -8, -12, -7, 8, 12, 7, -8, -11, -7,
+    8, 11, 8, -7, -11, -8, 7, 11, 8, -7, -11, -8, 6, 11, 8, -6,
+    -11, -8, 6, 11, 8, -6, -11, -9, 5, 11, 9, -5, -10, -9, 5, 10,
+    9, -4, -10, -9, 4, 10, 9, -4, -10, -9, 4, 10, 9, -3, -9, -9,
+    -3, 9, 9, 3, -9, -10, -4, 9, 10, 4, -9, -10, -4, 9, 10, 4,
+    -8, -10, -4, 8, 10, 5, -8, -10, -5, 8, 10, 5, -7, -10, -5, 7,
+};
+
+const int8_t CLIP_HIT_DECODED[1600] = {
+    1, 2, 1, 2, 6, 29, 72, 66, 71, 75, 84, 86, 92, 82, 64, 39,
+    45, 19, 23, 20, -7, -1, -27, -15, -12, -34, -30, -27, -54, -48, -74, -54,
+    -51, -34, -56, -61, -57, -41, -53, -31, -5, -17, -26, -9, -3, 14, 18, 21,
+    14, 8, 22, 39, 45, 59, 61, 75, 76, 65, 47, 25, 8, 26, 42, 40,
+    14, 22, -11, 4, 0, -3, -10, -24, -17, -11, -26, -45, -40, -36, -45, -52,
+    -34, -43, -50, -40, -44, -26, -18, 1, -4, 16, 25, 37, 27, 20, 12, 11,
+    21, 16, 20, 29, 27, 29, 25, 36, 22, 45, 37, 43, 38, 34, 37, 39,
+    37, 14, 6, 12, -3, -15, -18, -35, -33, -29, -47, -55, -49, -54, -50, -28,
+    -16, -26, -36, -20, -15, -3, 13, 6, 12, 11, 27, 32, 28, 31, 43, 37,
+    30, 33, 26, 30, 38, 58, 42, 49, 51, 52, 34, 26, 20, 25, 5, -4,
+    -16, -10, -24, -17, -23, -40, -36, -39, -56, -46, -53, -66, -50, -43, -45, -52,
+    -46, -37, -27, -21, -16, -6, -11, -15, -6, 11, 25, 39, 37, 47, 33, 35,
+    25, 42, 54, 57, 64, 54, 58, 40, 32, 26, 31, 19, 3, -9, 1, -9,
+    -1, -12, -5, -23, -14, -7, -5, -12, -9, -6, -3, -11, -15, -12, -24, -34,
+    -20, -22, -20, -6, -4, -10, 0, 3, 2, 12, 27, 23, 32, 39, 41, 34,
+    40, 35, 31, 39, 35, 26, 38, 48, 38, 32, 29, 30, 22, 10, 1, 8,
+    2, 9, -2, -4, -24, -30, -35, -39, -48, -50, -56, -52, -36, -31, -27, -18,
+    -11, -13, -14, -25, -11, -1, 7, 10, 19, 28, 40, 42, 25, 37, 40, 38,
+    36, 29, 21, 28, 34, 26, 37, 44, 50, 46, 38, 31, 24, 30, 34, 35,
+    26, 16, 15, 2, -10, -7, -14, -24, -28, -39, -37, -44, -36, -45, -35, -41,
+    -32, -25, -14, -24, -10, -22, -20, -27, -21, -24, -15, 1, 13, 15, 8, 24,
+    19, 31, 28, 26, 36, 40, 34, 33, 33, 27, 23, 15, 16, 15, 12, 12,
+    8, 4, 10, -1, -13, -11, -18, -19, -14, -7, -5, -4, -15, -21, -35, -37,
+    -39, -43, -44, -31, -27, -18, -20, -14, -10, -9, 0, 1, 2, -3, -7, -5,
+    -1, -4, 4, 8, 11, 9, 11, 25, 37, 31, 35, 41, 36, 32, 29, 33,
+    26, 32, 22, 23, 22, 12, 7, 11, 2, -10, -12, -11, -14, -17, -13, -12,
+    -17, -20, -19, -26, -28, -24, -30, -37, -41, -34, -27, -21, -17, -23, -22, -19,
+    -17, -17, -14, -13, -14, -10, -9, -3, 2, 12, 17, 21, 12, 19, 25, 29,
+    37, 34, 30, 29, 22, 25, 13, 15, 16, 17, 10, 10, 15, 18, 17, 9,
+    5, -4, -2, -16, -26, -25, -32, -25, -19, -23, -17, -22, -18, -25, -18, -20,
+    -24, -23, -26, -30, -25, -18, -8, -3, -7, -4, -11, 3, 10, 9, 14, 18,
+    21, 22, 26, 33, 36, 29, 26, 28, 33, 30, 27, 18, 9, 7, 9, 5,
+    11, 10, 4, 3, 6, -4, 1, -3, 0, -7, -5, -6, -12, -11, -10, -7,
+    -12, -20, -21, -20, -13, -11, -13, -9, -3, -4, -8, -16, -12, -15, -13, -3,
+    -4, 2, 7, 6, 9, 16, 19, 17, 23, 27, 21, 26, 29, 32, 34, 35,
+    32, 31, 32, 31, 23, 27, 24, 26, 20, 19, 16, 9, 5, 6, 0, 2,
+    3, 2, -3, -4, -6, -10, -19, -16, -18, -16, -20, -19, -24, -21, -24, -27,
+    -28, -25, -12, -9, -2, -8, -4, -3, -6, -2, -5, -4, -5, -4, -3, 1,
+    11, 8, 7, 6, 11, 14, 18, 20, 16, 15, 14, 20, 22, 23, 22, 23,
+    23, 15, 3, 0, 2, 0, -1, -2, -7, -11, -6, -11, -8, -11, -10, -13,
+    -12, -11, -14, -17, -18, -15, -21, -22, -23, -18, -17, -19, -12, -9, -7, -5,
+    -1, 0, -1, -4, 2, 1, 4, 9, 6, 9, 13, 9, 14, 19, 18, 17,
+    16, 15, 12, 13, 18, 14, 9, 10, 9, 12, 9, 5, 1, 2, 1, 0,
+    -3, 2, -4, -7, -6, -9, -12, -13, -12, -11, -8, -13, -10, -14, -12, -9,
+    -13, -17, -18, -17, -14, -11, -8, -12, -13, -7, -6, -2, -5, -8, -7, -4,
+    -5, 0, 3, 9, 13, 12, 9, 13, 13, 14, 17, 20, 19, 18, 21, 15,
+    14, 13, 13, 16, 15, 12, 6, 11, 10, 13, 9, 5, 2, 2, 1, 3,
+    2, -1, -7, -6, -3, -6, -9, -10, -12, -11, -11, -12, -13, -16, -13, -8,
+    -12, -13, -11, -12, -12, -11, -12, -12, -11, -7, -6, -3, -4, -3, -5, -2,
+    -3, 0, -1, 2, 8, 9, 10, 11, 14, 15, 14, 11, 14, 15, 16, 15,
+    13, 12, 15, 16, 13, 13, 14, 9, 10, 9, 10, 10, 6, 2, -1, -2,
+    -5, -4, -2, -3, -6, -7, -10, -14, -16, -16, -19, -20, -15, -14, -15, -18,
+    -18, -18, -14, -13, -10, -9, -6, -6, -2, 1, 1, -1, -2, -4, -5, -2,
+    -1, 1, 5, 6, 12, 13, 9, 6, 9, 8, 9, 8, 8, 9, 10, 11,
+    13, 11, 10, 10, 9, 8, 5, 6, 3, 3, 3, 3, 4, 5, 4, 0,
+    -4, -1, 0, -1, -4, -5, -6, -6, -7, -4, -4, -3, -2, -5, -6, -9,
+    -10, -11, -10, -10, -10, -11, -8, -11, -7, -3, -3, -5, -4, -4, -4, -3,
+    1, -3, 3, 2, 1, 1, 0, 1, 4, 10, 11, 11, 10, 10, 9, 7,
+    5, 8, 6, 5, 5, 8, 7, 8, 7, 6, 6, 9, 11, 8, 7, 5,
+    3, 4, 4, 3, 2, -1, -2, -1, -2, -3, -2, -6, -7, -6, -9, -8,
+    -7, -7, -10, -10, -10, -9, -8, -9, -12, -13, -11, -12, -13, -12, -12, -9,
+    -10, -9, -6, -5, -2, -3, -2, -2, -1, -2, 1, 4, 5, 4, 3, 4,
+    3, 4, 5, 8, 10, 7, 8, 8, 7, 7, 9, 8, 7, 7, 8, 9,
+    11, 12, 8, 9, 8, 7, 7, 5, 1, 0, 2, 3, 2, -1, 0, -1,
+    -1, -2, -4, -7, -8, -8, -9, -7, -6, -5, -6, -6, -7, -8, -8, -7,
+    -8, -6, -7, -7, -9, -8, -9, -8, -8, -7, -6, -5, -4, -5, -3, -3,
+    1, 2, 3, 6, 6, 6, 7, 8, 9, 10, 11, 12, 11, 10, 10, 11,
+    10, 10, 9, 8, 5, 6, 3, 4, 3, 1, 2, 5, 4, 3, 4, 3,
+    2, 3, 2, 2, 1, 1, 0, -1, 0, 0, -1, -2, -3, -2, -3, -6,
+    -5, -4, -7, -5, -5, -6, -5, -5, -5, -4, -4, -5, -6, -6, -7, -8,
+    -7, -5, -3, -2, -2, -3, -3, -4, -3, -2, 0, -2, -1, 1, 1, 2,
+    4, 4, 3, 4, 5, 4, 5, 5, 6, 5, 4, 5, 6, 7, 6, 5,
+    6, 7, 6, 5, 5, 4, 5, 7, 6, 5, 5, 6, 7, 5, 3, 3,
+    2, 1, 2, 3, 2, 1, -2, -1, -2, -2, -1, -2, -1, -3, -4, -5,
+    -4, -3, -4, -5, -6, -7, -6, -7, -8, -8, -7, -7, -5, -5, -6, -7,
+    -6, -5, -4, -5, -4, -4, -5, -5, -5, -5, -5, -4, -3, -1, 0, 1,
+    2, 2, 3, 2, 2, 1, 2, 3, 4, 5, 6, 6, 7, 6, 5, 6,
+    5, 3, 3, 4, 4, 5, 6, 7, 8, 7, 7, 6, 5, 3, 3, 3,
+    1, 2, 1, 2, 3, 2, 1, 0, -1, -3, -4, -3, -2, -2, -3, -3,
+    -4, -3, -4, -4, -5, -5, -5, -6, -6, -5, -5, -4, -5, -4, -4, -3,
+    -2, -2, -2, -3, -4, -3, -4, -3, -4, -4, -3, -4, -4, -3, -4, -4,
+    -4, -3, -2, -2, -1, 0, -1, -1, -1, 0, -1, -1, 0, 1, 2, 2,
+    3, 2, 4, 4, 5, 4, 3, 4, 4, 5, 6, 6, 6, 6, 5, 4,
+    5, 5, 4, 4, 5, 4, 3, 2, 3, 2, 1, 2, 1, 1, 0, 0,
+    -1, 0, -1, 0, 0, -1, -2, -3, -3, -3, -3, -3, -3, -4, -3, -3,
+    -4, -4, -3, -2, -2, -2, -3, -4, -3, -3, -3, -3, -3, -2, -3, -4,
+    -3, -4, -3, -3, -4, -4, -5, -4, -3, -1, -1, 0, -1, -1, 0, 0,
+    -1, -1, 0, 1, 1, 2, 3, 4, 4, 3, 3, 3, 3, 2, 2, 2,
+    2, 1, 2, 2, 3, 2, 3, 4, 4, 3, 4, 3, 4, 4, 5, 4,
+    5, 4, 4, 2, 2, 1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0,
+    0, -1, -1, -2, -3, -2, -3, -4, -3, -3, -2, -2, -1, -2, -3, -3,
+    -3, -3, -4, -4, -5, -5, -5, -4, -3, -3, -2, -3, -4, -4, -3, -3,
+    -2, -2, -2, -2, -2, -1, -1, 0, 0, -1, 0, 0, -1, -1, -2, -2,
+    -1, -1, -1, 0, 0, 0, 1, 1, 2, 1, 2, 2, 1, 1, 1, 1,
+    1, 2, 1, 1, 2, 2, 2, 3, 4, 3, 3, 2, 2, 3, 2, 2,
+    2, 2, 3, 2, 2, 3, 3, 3, 2, 2, 2, 2, 3, 2, 2, 1,
+    1, 1, 2, 2, 2, 2, 1, 1, 0, 0, 1, 0, -1, -1, -1, -1,
+    -2, -2, -2, -1, -2, -3, -2, -2, -3, -3, -2, -2, -2, -1, -1, -2,
+    -2, -3, -3, -3, -2, -2, -1, -2, -2, -1, -2, -2, -2, -2, -1, -2,
+    -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0,
+};
+
+const int8_t CLIP_GAMEOVER_DECODED[6000] = {
+    0, 1, 2, 3, 4, 4, 4, 3, -1, -8, -11, -12, -13, -12, -9, -5,
+    9, 16, 18, 22, 21, 20, 14, 8, -7, -26, -31, -27, -30, -28, -22, -12,
+    6, 31, 37, 42, 38, 35, 28, 14, -9, -34, -40, -45, -49, -40, -33, -19,
+    4, 47, 53, 58, 54, 51, 39, 25, 2, -41, -60, -65, -69, -60, -48, -30,
+    18, 43, 62, 77, 73, 70, 53, 35, -13, -56, -75, -80, -84, -81, -64, -42,
+    36, 61, 80, 85, 89, 86, 69, 47, -31, -56, -75, -90, -86, -83, -71, -49,
+    29, 54, 73, 88, 92, 89, 72, 54, 32, -5, -65, -84, -89, -85, -76, -59,
+    -37, 41, 66, 85, 90, 86, 77, 60, 42, -6, -66, -72, -87, -91, -82, -65,
+    -47, 1, 61, 80, 85, 89, 86, 69, 51, 3, -57, -76, -81, -93, -84, -72,
+    -54, -32, 5, 65, 84, 89, 85, 76, 59, 37, -41, -66, -85, -90, -86, -83,
+    -66, -44, 34, 59, 78, 83, 87, 84, 72, 50, 24, -37, -62, -81, -86, -90,
+    -74, -57, -35, 43, 68, 74, 89, 93, 77, 65, 43, -35, -60, -79, -84, -88,
+    -85, -68, -50, -2, 58, 64, 79, 91, 88, 76, 58, 36, -1, -61, -80, -85,
+    -89, -80, -63, -45, 3, 63, 69, 84, 88, 85, 73, 51, 25, -36, -61, -80,
+    -85, -89, -80, -58, -38, 10, 53, 72, 87, 91, 82, 65, 47, -1, -61, -67,
+    -82, -86, -83, -76, -58, -36, 1, 61, 80, 85, 89, 80, 63, 45, -3, -63,
+    -69, -84, -88, -85, -73, -55, -33, 4, 64, 83, 88, 92, 83, 61, 41, -7,
+    -50, -69, -84, -88, -85, -73, -55, -33, 4, 64, 83, 88, 92, 76, 64, 42,
+    -36, -61, -80, -85, -89, -86, -74, -52, -26, 35, 60, 79, 84, 88, 79, 62,
+    44, -4, -64, -70, -85, -89, -86, -74, -56, -34, 3, 63, 82, 87, 91, 82,
+    65, 47, -1, -61, -67, -82, -86, -89, -77, -59, -37, 0, 60, 79, 84, 88,
+    85, 68, 50, 28, -9, -69, -88, -93, -89, -80, -63, -41, 37, 62, 81, 86,
+    90, 87, 75, 57, 35, -2, -62, -81, -86, -90, -81, -69, -47, 31, 56, 75,
+    80, 92, 89, 77, 63, 40, -38, -63, -69, -84, -88, -85, -73, -55, -33, 4,
+    64, 83, 88, 92, 83, 66, 48, 0, -43, -62, -88, -92, -89, -77, -63, -43,
+    30, 55, 74, 89, 93, 84, 77, 59, 37, 0, -60, -79, -84, -88, -85, -73,
+    -55, -33, 4, 64, 83, 88, 92, 83, 66, 48, 0, -43, -62, -88, -92, -89,
+    -77, -63, -43, 30, 55, 74, 89, 93, 90, 78, 60, 38, 1, -59, -78, -83,
+    -87, -84, -72, -58, -35, 43, 68, 74, 89, 93, 84, 72, 54, 32, -5, -65,
+    -84, -89, -85, -82, -70, -52, -30, 7, 67, 86, 91, 87, 84, 67, 49, 1,
+    -42, -75, -80, -92, -89, -82, -64, -48, -11, 49, 68, 83, 87, 90, 78, 64,
+    44, -29, -54, -73, -88, -92, -89, -77, -63, -43, 30, 55, 74, 89, 93, 90,
+    78, 60, 44, 7, -53, -72, -87, -91, -88, -76, -62, -39, 39, 64, 70, 85,
+    89, 86, 79, 61, 39, 2, -58, -77, -82, -86, -89, -77, -63, -40, 38, 63,
+    69, 84, 88, 85, 78, 60, 44, 7, -53, -72, -87, -91, -88, -76, -62, -42,
+    31, 56, 75, 80, 92, 89, 77, 63, 43, -30, -55, -74, -79, -91, -88, -81,
+    -63, -47, -10, 50, 69, 84, 88, 91, 79, 65, 48, -13, -56, -62, -77, -89,
+    -86, -84, -70, -50, -31, 47, 72, 78, 83, 87, 84, 72, 54, 32, -5, -65,
+    -84, -89, -93, -84, -72, -58, -35, 43, 68, 74, 89, 93, 84, 77, 59, 37,
+    0, -60, -79, -84, -88, -85, -78, -64, -44, 29, 54, 73, 78, 90, 87, 80,
+    66, 49, 29, -19, -62, -81, -86, -90, -81, -69, -55, -32, 46, 54, 73, 88,
+    92, 89, 72, 58, 38, -35, -60, -79, -84, -88, -85, -78, -64, -44, 29, 54,
+    73, 78, 90, 87, 80, 70, 50, 31, -47, -72, -78, -83, -87, -84, -72, -58,
+    -35, 43, 51, 70, 85, 89, 86, 79, 65, 45, -28, -53, -72, -77, -89, -86,
+    -84, -70, -50, -31, 47, 55, 74, 89, 93, 84, 77, 59, 37, 0, -60, -79,
+    -84, -88, -85, -78, -68, -48, 25, 50, 69, 84, 88, 91, 84, 74, 57, 37,
+    -11, -54, -73, -88, -92, -89, -77, -63, -46, 15, 58, 64, 79, 91, 88, 81,
+    71, 54, 34, -14, -57, -76, -81, -93, -90, -78, -64, -44, 29, 54, 73, 78,
+    90, 93, 86, 72, 55, 35, -13, -56, -75, -80, -92, -89, -77, -63, -46, 15,
+    40, 73, 78, 90, 93, 86, 72, 58, 36, -25, -50, -69, -84, -88, -85, -78,
+    -68, -48, -29, 49, 57, 76, 91, 87, 84, 77, 63, 43, -30, -55, -74, -79,
+    -91, -88, -81, -71, -54, -34, 14, 57, 76, 81, 93, 90, 78, 64, 47, 27,
+    -21, -64, -83, -88, -92, -89, -77, -59, -43, -6, 54, 73, 78, 90, 87, 85,
+    71, 54, 34, -14, -57, -76, -81, -93, -90, -83, -69, -49, -30, 48, 56, 75,
+    90, 94, 85, 78, 64, 44, -29, -54, -60, -75, -87, -90, -83, -77, -60, -40,
+    8, 51, 70, 85, 89, 92, 85, 71, 57, 35, -26, -51, -70, -85, -89, -86,
+    -84, -70, -53, -33, 15, 58, 77, 82, 86, 89, 82, 68, 51, 31, -17, -60,
+    -79, -84, -88, -85, -78, -68, -48, -29, 49, 57, 76, 91, 87, 90, 78, 64,
+    47, -14, -39, -58, -73, -85, -88, -86, -76, -62, -45, -15, 45, 64, 79, 83,
+    92, 85, 79, 62, 42, -6, -49, -68, -83, -87, -90, -88, -78, -61, -41, 7,
+    50, 69, 74, 86, 89, 87, 77, 63, 46, 16, -44, -63, -78, -90, -87, -85,
+    -79, -62, -42, 6, 49, 68, 83, 87, 90, 88, 78, 64, 47, 17, -43, -62,
+    -77, -89, -92, -85, -79, -65, -48, -30, 18, 61, 80, 85, 89, 86, 79, 69,
+    49, 30, -38, -63, -69, -84, -88, -85, -83, -69, -52, -32, 16, 59, 78, 83,
+    87, 90, 83, 73, 56, 36, -12, -55, -74, -79, -91, -88, -86, -76, -59, -39,
+    9, 52, 71, 76, 88, 91, 84, 78, 61, 49, 1, -42, -61, -76, -88, -91,
+    -89, -79, -65, -48, -30, 18, 61, 80, 85, 89, 92, 80, 70, 53, 33, -15,
+    -58, -77, -82, -86, -89, -87, -73, -59, -42, -12, 48, 67, 82, 86, 89, 87,
+    77, 67, 49, 24, -49, -57, -76, -81, -93, -90, -83, -69, -55, -38, -8, 52,
+    71, 86, 90, 93, 86, 76, 62, 45, 15, -45, -64, -79, -83, -92, -90, -80,
+    -70, -52, -27, 46, 54, 73, 78, 90, 87, 85, 75, 58, 46, -2, -45, -64,
+    -79, -83, -92, -85, -79, -69, -51, -26, 47, 55, 74, 79, 91, 88, 86, 76,
+    59, 39, -9, -52, -71, -76, -88, -91, -89, -79, -69, -51, -26, 34, 59, 78,
+    83, 87, 90, 83, 77, 60, 48, 0, -43, -62, -77, -89, -92, -90, -80, -70,
+    -54, -39, 22, 47, 66, 81, 85, 88, 86, 80, 66, 49, 31, -17, -60, -79,
+    -84, -88, -91, -84, -74, -60, -43, -13, 47, 66, 81, 85, 88, 90, 80, 70,
+    54, 39, -22, -47, -66, -81, -85, -88, -86, -80, -66, -49, -31, 17, 60, 66,
+    81, 85, 88, 86, 76, 62, 45, 27, -21, -64, -70, -85, -89, -86, -84, -74,
+    -60, -43, -13, 47, 66, 81, 85, 88, 90, 84, 70, 58, 40, -8, -51, -70,
+    -75, -87, -90, -88, -82, -68, -56, -38, 10, 53, 72, 77, 89, 92, 85, 79,
+    69, 53, 38, -23, -48, -67, -82, -86, -89, -87, -81, -67, -50, -36, -13, 47,
+    66, 81, 85, 88, 86, 80, 66, 49, 35, 12, -48, -67, -82, -86, -89, -87,
+    -81, -67, -50, -36, -13, 47, 66, 81, 85, 88, 86, 80, 66, 49, 35, 12,
+    -48, -67, -82, -86, -89, -87, -81, -67, -55, -37, 11, 54, 73, 78, 90, 93,
+    86, 80, 70, 54, 39, -22, -47, -66, -81, -85, -88, -86, -84, -70, -58, -40,
+    8, 51, 70, 75, 87, 90, 88, 82, 72, 59, 43, 6, -54, -60, -75, -87,
+    -90, -88, -86, -76, -63, -47, -30, 0, 60, 66, 81, 85, 88, 86, 80, 66,
+    49, 35, 12, -48, -67, -82, -86, -89, -87, -81, -71, -55, -40, 21, 46, 65,
+    80, 84, 87, 89, 83, 73, 60, 44, 27, -3, -63, -69, -84, -88, -91, -84,
+    -78, -64, -52, -34, 14, 57, 63, 78, 90, 93, 86, 80, 70, 57, 41, 4,
+    -56, -62, -77, -81, -90, -88, -86, -76, -63, -47, -30, 0, 60, 66, 81, 85,
+    88, 90, 80, 70, 54, 39, -22, -47, -66, -71, -83, -86, -88, -86, -76, -63,
+    -47, -30, 0, 60, 66, 81, 85, 88, 90, 80, 70, 57, 41, 4, -39, -58,
+    -73, -85, -88, -90, -88, -78, -65, -49, -32, -2, 58, 64, 79, 83, 92, 90,
+    84, 74, 61, 45, 28, -2, -62, -68, -83, -87, -90, -88, -82, -68, -56, -38,
+    10, 53, 59, 74, 86, 89, 91, 85, 78, 67, 53, 36, -25, -50, -69, -74,
+    -86, -89, -87, -85, -75, -62, -46, -29, 1, 61, 67, 82, 86, 89, 87, 85,
+    75, 59, 44, 32, -16, -59, -65, -80, -84, -87, -89, -83, -73, -57, -42, 19,
+    44, 63, 68, 80, 89, 91, 89, 79, 71, 56, 37, -31, -39, -58, -73, -85,
+    -88, -90, -88, -81, -70, -56, -39, 22, 47, 66, 71, 83, 86, 88, 86, 79,
+    68, 54, 40, 3, -40, -59, -74, -86, -89, -91, -89, -79, -68, -54, -40, -3,
+    40, 59, 74, 86, 89, 91, 89, 79, 71, 56, 37, -31, -39, -58, -73, -85,
+    -88, -90, -88, -81, -70, -60, -43, 18, 43, 62, 67, 79, 88, 90, 88, 81,
+    73, 60, 48, 32, -5, -48, -67, -82, -86, -89, -87, -85, -75, -64, -50, -33,
+    28, 53, 72, 77, 81, 90, 92, 86, 79, 68, 54, 37, -24, -49, -68, -73,
+    -85, -88, -90, -88, -81, -70, -56, -42, -5, 38, 57, 72, 84, 87, 89, 91,
+    84, 73, 63, 49, 32, 2, -58, -64, -79, -83, -86, -88, -86, -79, -68, -54,
+    -40, -3, 40, 59, 74, 78, 87, 89, 87, 83, 72, 62, 45, 33, -15, -58,
+    -64, -79, -83, -92, -90, -84, -77, -66, -56, -39, 22, 47, 66, 71, 83, 86,
+    88, 90, 83, 72, 62, 48, 31, 1, -59, -65, -80, -84, -87, -89, -87, -80,
+    -69, -55, -41, -4, 39, 58, 73, 77, 86, 88, 90, 83, 77, 66, 49, 35,
+    12, -48, -67, -72, -84, -87, -89, -87, -83, -72, -62, -48, -31, -1, 59, 65,
+    80, 84, 87, 89, 87, 80, 69, 59, 45, 28, -2, -62, -68, -73, -85, -88,
+    -90, -88, -78, -67, -57, -40, 21, 46, 52, 67, 79, 88, 90, 88, 84, 78,
+    67, 55, 41, 18, -42, -61, -66, -78, -87, -89, -87, -86, -78, -67, -55, -41,
+    -18, 42, 61, 66, 78, 87, 89, 91, 84, 78, 67, 55, 41, 18, -42, -61,
+    -66, -78, -87, -89, -87, -86, -78, -67, -55, -41, -18, 42, 61, 66, 78, 87,
+    89, 91, 84, 78, 69, 55, 43, 13, -47, -53, -68, -80, -83, -90, -88, -87,
+    -79, -70, -60, -44, -29, 32, 57, 63, 78, 82, 91, 89, 87, 80, 72, 61,
+    49, 31, -17, -42, -61, -76, -80, -89, -91, -89, -82, -76, -65, -53, -39, -16,
+    44, 63, 68, 80, 89, 91, 89, 85, 79, 68, 56, 42, 28, -9, -52, -71,
+    -76, -88, -91, -89, -87, -80, -72, -61, -49, -35, -12, 48, 67, 72, 84, 87,
+    89, 91, 84, 78, 67, 55, 41, 18, -42, -61, -66, -78, -87, -89, -91, -87,
+    -81, -74, -64, -49, -37, 11, 54, 60, 75, 79, 88, 90, 88, 84, 78, 69,
+    55, 43, 29, 6, -54, -60, -75, -87, -90, -88, -86, -82, -76, -65, -53, -39,
+    -16, 44, 63, 68, 80, 83, 90, 88, 84, 78, 71, 61, 46, 34, -14, -39,
+    -58, -73, -77, -80, -87, -85, -81, -75, -66, -56, -43, -27, 10, 53, 59, 64,
+    76, 79, 81, 83, 79, 71, 64, 54, 39, 27, -21, -46, -52, -67, -71, -74,
+    -81, -79, -75, -69, -60, -50, -39, -25, -2, 41, 60, 65, 69, 72, 74, 76,
+    72, 66, 57, 47, 36, 26, 3, -40, -46, -61, -65, -68, -75, -73, -69, -63,
+    -56, -46, -41, -29, 19, 44, 50, 55, 59, 68, 70, 68, 67, 61, 54, 47,
+    37, 27, 9, -34, -40, -55, -59, -62, -64, -66, -65, -59, -54, -47, -37, -27,
+    -9, 34, 40, 45, 57, 60, 62, 64, 63, 57, 54, 47, 37, 30, 19, -11,
+    -36, -42, -47, -51, -60, -58, -60, -56, -53, -46, -39, -33, -23, -5, 38, 44,
+    49, 53, 56, 58, 56, 55, 52, 47, 40, 34, 24, 6, -19, -38, -43, -47,
+    -50, -52, -54, -53, -50, -47, -41, -35, -28, -21, 9, 34, 40, 45, 41, 50,
+    52, 50, 49, 46, 43, 36, 30, 23, 17, 2, -31, -36, -40, -43, -45, -47,
+    -46, -45, -42, -38, -32, -25, -19, -4, 15, 30, 34, 37, 39, 41, 45, 44,
+    41, 38, 35, 29, 23, 16, -2, -27, -21, -26, -38, -35, -42, -40, -39, -38,
+    -35, -31, -26, -21, -15, 3, 11, 30, 25, 29, 32, 34, 36, 37, 34, 33,
+    29, 24, 19, 15, 7, -21, -24, -26, -28, -32, -33, -34, -33, -31, -29, -25,
+    -21, -18, -13, -3, 12, 16, 25, 27, 29, 30, 31, 30, 29, 26, 23, 20,
+    17, 12, -6, -14, -20, -15, -19, -22, -24, -26, -25, -24, -23, -22, -19, -15,
+    -11, -8, -1, 15, 17, 19, 20, 23, 24, 23, 22, 21, 20, 17, 14, 11,
+    8, 0, -12, -15, -17, -19, -18, -19, -20, -19, -18, -17, -16, -13, -10, -9,
+    1, 6, 10, 13, 15, 17, 16, 17, 16, 16, 14, 13, 12, 9, 8, 5,
+    -5, -10, -6, -9, -11, -13, -12, -13, -12, -12, -11, -10, -9, -7, -5, -1,
+    6, 7, 8, 8, 9, 9, 9, 9, 9, 8, 7, 6, 5, 4, 3, 2,
+    -2, -3, -4, -5, -6, -6, -6, -6, -5, -5, -4, -4, -3, -2, -2, 1,
+    2, 3, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0, 0,
+    0, 1, 2, 3, 4, 5, 7, 8, 9, 10, 10, 10, 9, 8, 7, 6,
+    2, -12, -14, -16, -20, -21, -24, -25, -27, -27, -26, -24, -22, -19, -16, -11,
+    7, 15, 21, 26, 38, 41, 43, 45, 46, 45, 42, 39, 36, 30, 24, 17,
+    -1, -26, -32, -47, -51, -54, -61, -63, -62, -61, -60, -54, -48, -41, -34, -24,
+    -1, 42, 48, 53, 65, 74, 76, 78, 82, 79, 76, 70, 64, 55, 45, 32,
+    -16, -41, -60, -65, -77, -80, -87, -89, -90, -87, -84, -77, -67, -57, -46, -36,
+    -13, 47, 53, 68, 72, 81, 88, 90, 91, 88, 85, 78, 72, 62, 49, 40,
+    3, -40, -46, -61, -73, -82, -84, -90, -89, -88, -85, -81, -73, -61, -52, -40,
+    -30, -7, 53, 59, 74, 78, 81, 88, 90, 89, 88, 83, 76, 66, 56, 45,
+    35, 12, -48, -54, -69, -73, -82, -89, -91, -90, -89, -84, -77, -71, -61, -48,
+    -39, -2, 41, 47, 62, 74, 77, 84, 90, 91, 90, 85, 81, 73, 61, 52,
+    40, 30, 7, -53, -59, -64, -76, -85, -87, -89, -90, -87, -82, -76, -68, -57,
+    -45, -35, -12, 48, 54, 69, 73, 82, 84, 90, 91, 88, 85, 79, 71, 62,
+    52, 41, 27, 4, -56, -62, -67, -79, -82, -89, -91, -90, -87, -82, -75, -69,
+    -59, -46, -37, 0, 43, 49, 64, 76, 79, 86, 88, 89, 88, 85, 79, 71,
+    62, 52, 41, 27, 4, -56, -62, -67, -79, -82, -89, -91, -90, -87, -84, -77,
+    -67, -57, -46, -36, -13, 47, 53, 68, 72, 81, 88, 90, 91, 90, 87, 80,
+    74, 64, 53, 43, 33, 15, -45, -64, -69, -73, -82, -89, -91, -90, -89, -84,
+    -78, -70, -61, -51, -40, -10, 33, 52, 57, 69, 78, 85, 87, 91, 90, 87,
+    83, 76, 69, 59, 49, 36, -12, -37, -56, -61, -73, -82, -84, -90, -89, -88,
+    -87, -81, -73, -66, -56, -41, -29, 19, 44, 50, 65, 77, 80, 87, 89, 90,
+    89, 86, 79, 73, 63, 52, 42, 28, -9, -52, -58, -63, -75, -84, -86, -88,
+    -89, -88, -85, -78, -72, -62, -51, -41, -27, 10, 53, 59, 74, 78, 81, 88,
+    90, 91, 88, 83, 77, 69, 60, 50, 37, -11, -36, -55, -60, -72, -75, -82,
+    -88, -89, -90, -87, -83, -76, -69, -59, -49, -36, 12, 37, 56, 61, 73, 76,
+    83, 89, 90, 89, 88, 82, 76, 67, 57, 46, 36, 13, -47, -53, -58, -70,
+    -79, -86, -88, -89, -88, -87, -83, -75, -71, -55, -48, -38, -15, 45, 51, 66,
+    70, 79, 86, 88, 89, 90, 87, 83, 76, 69, 59, 49, 36, -12, -37, -56,
+    -61, -73, -76, -83, -89, -90, -89, -88, -82, -76, -69, -59, -44, -40, 8, 33,
+    52, 57, 69, 78, 85, 87, 91, 90, 87, 83, 77, 70, 59, 49, 39, 21,
+    -39, -45, -60, -72, -75, -82, -88, -89, -90, -89, -85, -78, -71, -61, -51, -40,
+    -30, -7, 53, 59, 64, 76, 79, 86, 88, 89, 88, 85, 79, 73, 64, 54,
+    43, 33, 10, -50, -56, -61, -73, -82, -84, -90, -89, -88, -87, -81, -75, -66,
+    -56, -45, -35, -12, 48, 54, 59, 71, 80, 87, 89, 90, 89, 88, 82, 76,
+    69, 59, 44, 40, -8, -33, -52, -57, -69, -78, -85, -87, -91, -90, -89, -85,
+    -78, -71, -61, -51, -40, -30, -7, 53, 59, 64, 76, 79, 86, 88, 89, 90,
+    87, 80, 74, 64, 56, 45, 33, 3, -40, -59, -64, -68, -77, -84, -86, -90,
+    -89, -88, -84, -77, -70, -60, -50, -39, -29, -6, 54, 60, 65, 77, 80, 87,
+    89, 90, 89, 86, 80, 74, 65, 55, 44, 34, 11, -49, -55, -60, -72, -81,
+    -83, -89, -90, -89, -88, -84, -77, -70, -60, -50, -39, -29, -6, 54, 60, 65,
+    77, 80, 87, 89, 90, 89, 86, 80, 74, 65, 55, 44, 34, 11, -49, -55,
+    -60, -72, -81, -83, -89, -90, -89, -88, -84, -78, -71, -60, -50, -40, -29, 1,
+    44, 63, 68, 72, 81, 88, 90, 91, 90, 87, 83, 75, 71, 55, 48, 38,
+    15, -45, -51, -56, -68, -77, -84, -86, -90, -89, -88, -85, -80, -73, -66, -56,
+    -46, -35, -5, 38, 57, 62, 74, 77, 84, 86, 90, 91, 88, 84, 78, 71,
+    63, 54, 44, 31, -17, -42, -61, -66, -70, -79, -86, -88, -89, -90, -87, -83,
+    -77, -70, -62, -51, -39, -29, -6, 54, 60, 65, 77, 80, 87, 89, 90, 89,
+    88, 82, 76, 69, 59, 54, 42, 26, -11, -54, -60, -65, -77, -80, -87, -89,
+    -90, -89, -86, -82, -75, -68, -58, -48, -37, -7, 36, 55, 60, 64, 73, 80,
+    86, 90, 91, 90, 86, 81, 76, 67, 58, 46, 36, 13, -47, -53, -58, -70,
+    -73, -80, -86, -90, -89, -88, -87, -81, -74, -68, -59, -49, -38, -8, 35, 54,
+    59, 71, 74, 81, 87, 88, 89, 90, 86, 81, 76, 67, 58, 51, 37, 27,
+    9, -51, -57, -62, -74, -83, -85, -87, -91, -90, -87, -83, -76, -69, -59, -49,
+    -38, -28, -5, 55, 61, 66, 70, 79, 86, 88, 89, 90, 87, 83, 77, 70,
+    62, 51, 39, 29, 6, -37, -56, -61, -73, -76, -83, -89, -90, -89, -88, -84,
+    -78, -71, -63, -54, -44, -33, -3, 40, 59, 64, 68, 77, 84, 86, 90, 91,
+    88, 85, 80, 73, 66, 56, 46, 35, 5, -38, -44, -59, -71, -74, -81, -87,
+    -88, -89, -88, -87, -82, -75, -68, -58, -48, -40, -29, 8, 51, 57, 62, 74,
+    77, 84, 86, 90, 91, 88, 84, 78, 71, 63, 54, 44, 33, 3, -40, -59,
+    -64, -68, -77, -84, -86, -90, -89, -88, -85, -80, -75, -66, -57, -45, -39, -16,
+    44, 50, 55, 67, 76, 83, 85, 89, 90, 89, 88, 83, 78, 71, 61, 51,
+    43, 32, -5, -48, -54, -59, -71, -80, -82, -88, -89, -90, -89, -85, -80, -75,
+    -66, -57, -45, -39, -16, 44, 50, 55, 67, 76, 83, 85, 89, 90, 89, 88,
+    83, 78, 71, 65, 55, 44, 34, 11, -49, -55, -60, -72, -75, -82, -88, -89,
+    -90, -89, -86, -81, -76, -69, -59, -49, -41, -30, 7, 50, 56, 61, 73, 76,
+    83, 89, 90, 91, 88, 85, 80, 73, 66, 56, 46, 38, 23, -37, -45, -64,
+    -69, -73, -82, -84, -90, -89, -90, -87, -84, -78, -71, -63, -54, -44, -33, -3,
+    40, 46, 61, 65, 74, 81, 87, 88, 89, 90, 87, 84, 77, 68, 61, 55,
+    45, 32, -16, -41, -47, -62, -66, -75, -82, -88, -89, -90, -89, -86, -83, -76,
+    -67, -60, -50, -40, -32, -17, 43, 51, 57, 72, 76, 85, 87, 89, 90, 89,
+    86, 82, 76, 69, 61, 52, 42, 31, 1, -42, -48, -63, -67, -76, -83, -85,
+    -89, -90, -89, -86, -83, -76, -67, -60, -50, -40, -29, 1, 44, 50, 65, 69,
+    78, 85, 87, 88, 89, 90, 86, 83, 76, 67, 60, 50, 40, 32, 17, -43,
+    -51, -57, -72, -76, -85, -87, -89, -90, -89, -86, -82, -77, -70, -61, -52, -45,
+    -31, -8, 35, 54, 59, 71, 74, 81, 87, 88, 89, 90, 87, 84, 78, 72,
+    62, 54, 45, 35, 17, -43, -49, -54, -66, -75, -82, -84, -88, -89, -90, -89,
+    -84, -79, -72, -66, -56, -48, -37, 0, 43, 49, 54, 66, 75, 82, 84, 88,
+    89, 90, 89, 86, 81, 75, 68, 59, 50, 38, 32, 9, -51, -57, -62, -74,
+    -77, -84, -86, -90, -89, -88, -87, -82, -77, -70, -64, -54, -43, -33, -10, 33,
+    52, 57, 69, 72, 79, 85, 89, 90, 91, 88, 85, 79, 73, 66, 58, 49,
+    39, 28, -2, -45, -51, -66, -70, -79, -86, -88, -89, -90, -89, -86, -83, -76,
+    -67, -60, -54, -44, -33, -3, 40, 46, 61, 65, 74, 81, 87, 88, 89, 90,
+    89, 84, 79, 73, 67, 58, 48, 37, 27, 4, -39, -58, -63, -67, -76, -83,
+    -85, -89, -90, -89, -88, -82, -78, -70, -63, -54, -45, -33, -3, 40, 46, 61,
+    65, 74, 81, 83, 87, 90, 91, 88, 85, 81, 75, 69, 60, 50, 42, 31,
+    -6, -49, -55, -60, -72, -75, -82, -84, -88, -89, -90, -89, -84, -79, -73, -67,
+    -58, -48, -40, -29, 8, 51, 57, 62, 74, 77, 84, 86, 90, 91, 90, 87,
+    84, 78, 72, 65, 57, 48, 38, 27, -3, -46, -52, -67, -71, -80, -82, -88,
+    -89, -90, -89, -88, -83, -78, -71, -65, -55, -47, -36, 1, 44, 50, 55, 67,
+    70, 77, 83, 87, 88, 89, 89, 87, 83, 77, 71, 64, 55, 46, 34, 4,
+    -39, -45, -60, -64, -73, -80, -82, -86, -89, -90, -89, -87, -83, -77, -71, -64,
+    -55, -46, -34, -4, 39, 45, 60, 64, 73, 80, 82, 86, 89, 90, 89, 87,
+    83, 79, 71, 67, 58, 46, 36, 26, 8, -52, -58, -63, -67, -76, -83, -85,
+    -89, -90, -89, -88, -85, -79, -73, -66, -58, -49, -39, -28, 2, 45, 51, 66,
+    70, 73, 80, 86, 90, 91, 90, 89, 86, 80, 74, 67, 59, 50, 40, 32,
+    17, -43, -51, -57, -72, -76, -79, -86, -88, -89, -90, -89, -86, -81, -76, -69,
+    -63, -53, -45, -34, 3, 46, 52, 57, 61, 70, 77, 83, 87, 88, 89, 89,
+    87, 83, 79, 72, 65, 55, 48, 37, 27, 4, -39, -58, -63, -67, -76, -83,
+    -85, -89, -90, -89, -88, -85, -80, -74, -69, -60, -51, -44, -34, -11, 32, 51,
+    56, 68, 71, 78, 84, 88, 89, 90, 89, 87, 83, 79, 72, 65, 55, 48,
+    37, 27, 4, -39, -58, -63, -67, -76, -83, -85, -89, -90, -89, -88, -85, -81,
+    -75, -69, -62, -53, -44, -32, -2, 41, 47, 52, 64, 73, 80, 82, 86, 89,
+    90, 89, 87, 84, 80, 73, 67, 58, 51, 40, 30, 7, -36, -55, -60, -64,
+    -73, -80, -82, -89, -90, -89, -89, -87, -83, -79, -72, -65, -55, -48, -40, -29,
+    8, 51, 57, 62, 66, 75, 82, 84, 88, 89, 90, 89, 86, 82, 78, 71,
+    64, 54, 47, 36, 30, 7, -53, -59, -64, -68, -77, -79, -85, -89, -90, -89,
+    -88, -86, -82, -76, -70, -63, -54, -45, -38, -8, 35, 41, 56, 60, 69, 76,
+    82, 86, 87, 90, 90, 88, 86, 82, 75, 69, 62, 55, 45, 35, 27, 12,
+    -48, -56, -62, -67, -79, -82, -84, -86, -90, -89, -88, -87, -82, -77, -70, -64,
+    -54, -46, -37, -27, -9, 51, 57, 62, 66, 75, 82, 84, 88, 89, 90, 89,
+    86, 82, 78, 71, 64, 58, 48, 40, 29, -8, -51, -57, -62, -66, -75, -82,
+    -84, -88, -89, -90, -89, -87, -83, -79, -73, -66, -58, -51, -41, -36, 25, 33,
+    52, 57, 69, 72, 79, 81, 88, 89, 90, 90, 88, 85, 81, 74, 68, 61,
+    54, 44, 34, 16, -44, -50, -55, -59, -68, -75, -81, -85, -88, -89, -90, -89,
+    -86, -82, -78, -72, -65, -56, -47, -40, -30, -7, 36, 55, 60, 64, 73, 80,
+    82, 86, 89, 90, 89, 87, 84, 80, 73, 67, 60, 53, 43, 33, 15, -45,
+    -51, -56, -60, -69, -76, -82, -86, -87, -90, -90, -89, -86, -82, -78, -72, -65,
+    -58, -48, -38, -30, -15, 45, 53, 59, 64, 76, 79, 81, 87, 88, 89, 90,
+    89, 86, 81, 75, 70, 63, 53, 46, 38, 27, -10, -53, -47, -62, -66, -75,
+    -82, -84, -88, -89, -90, -89, -87, -84, -80, -73, -67, -60, -53, -43, -33, -15,
+    45, 51, 56, 60, 69, 76, 82, 86, 87, 90, 90, 89, 87, 83, 79, 73,
+    66, 59, 53, 43, 32, 2, -41, -47, -52, -64, -73, -75, -81, -85, -88, -89,
+    -90, -89, -86, -83, -78, -73, -66, -60, -50, -42, -33, -10, 33, 52, 57, 61,
+    70, 77, 83, 87, 88, 89, 90, 89, 86, 83, 78, 73, 66, 60, 50, 42,
+    33, 10, -33, -52, -57, -61, -70, -77, -79, -86, -87, -90, -90, -89, -87, -83,
+    -79, -73, -68, -59, -50, -43, -33, -10, 33, 52, 57, 61, 70, 77, 79, 86,
+    87, 88, 89, 89, 87, 84, 81, 74, 71, 59, 53, 46, 35, 29, 6, -37,
+    -56, -61, -65, -74, -81, -83, -87, -88, -89, -90, -88, -85, -81, -77, -71, -64,
+    -57, -47, -40, -29, 1, 44, 50, 55, 67, 70, 77, 83, 87, 88, 89, 90,
+    89, 86, 83, 78, 73, 66, 60, 50, 44, 35, 12, -31, -50, -55, -59, -68,
+    -75, -81, -85, -86, -89, -90, -89, -88, -85, -82, -76, -70, -63, -55, -48, -39,
+    -30, 7, 50, 56, 61, 65, 74, 76, 82, 86, 87, 90, 90, 89, 87, 83,
+    79, 73, 68, 61, 51, 44, 36, 21, -39, -47, -53, -58, -70, -73, -80, -82,
+    -86, -89, -90, -90, -88, -86, -82, -78, -72, -65, -58, -52, -42, -34, -19, 41,
+    49, 55, 60, 72, 75, 82, 84, 88, 89, 90, 89, 88, 85, 81, 77, 71,
+    64, 57, 47, 40, 32, 17, -43, -51, -57, -62, -66, -75, -82, -84, -88, -89,
+    -90, -89, -88, -85, -81, -77, -71, -64, -57, -47, -40, -32, -17, 43, 51, 57,
+    62, 66, 75, 82, 84, 88, 89, 90, 89, 88, 85, 81, 77, 71, 64, 57,
+    47, 40, 32, 17, -43, -51, -57, -62, -66, -75, -82, -84, -88, -89, -90, -89,
+    -88, -85, -81, -77, -71, -64, -57, -51, -41, -33, -18, 42, 50, 56, 61, 65,
+    74, 81, 83, 87, 88, 89, 90, 88, 86, 82, 78, 72, 65, 58, 52, 42,
+    34, 19, -41, -49, -55, -60, -64, -73, -80, -82, -86, -89, -90, -90, -89, -87,
+    -83, -79, -73, -68, -61, -55, -45, -37, -30, -20, 37, 45, 51, 66, 70, 79,
+    81, 83, 87, 88, 89, 89, 88, 85, 81, 77, 71, 64, 57, 51, 41, 33,
+    18, -42, -50, -56, -61, -65, -74, -81, -83, -87, -88, -89, -90, -89, -87, -83,
+    -79, -73, -68, -61, -55, -45, -39, -30, -7, 36, 55, 60, 64, 67, 74, 80,
+    84, 87, 88, 89, 90, 88, 85, 82, 77, 71, 66, 59, 53, 43, 35, 20,
+    -40, -48, -54, -59, -63, -72, -79, -81, -85, -88, -89, -90, -89, -88, -85, -82,
+    -76, -70, -63, -57, -50, -43, -33, -10, 33, 39, 54, 58, 67, 74, 76, 83,
+    86, 87, 90, 90, 89, 88, 85, 82, 77, 70, 64, 57, 49, 42, 33, -15,
+    -40, -46, -51, -63, -66, -73, -79, -83, -86, -87, -90, -90, -89, -88, -85, -82,
+    -77, -70, -64, -57, -51, -42, -35, -17, 43, 49, 54, 58, 67, 74, 76, 83,
+    86, 87, 90, 90, 89, 88, 85, 82, 77, 71, 65, 58, 51, 45, 35, 17,
+    -43, -37, -52, -56, -65, -72, -78, -82, -85, -88, -89, -90, -90, -89, -86, -83,
+    -78, -74, -67, -60, -54, -44, -38, -29, -6, 37, 43, 58, 62, 71, 73, 79,
+    83, 86, 89, 90, 90, 89, 88, 85, 79, 76, 69, 63, 56, 50, 41, 34,
+    16, -44, -50, -55, -59, -68, -70, -76, -83, -84, -87, -90, -90, -89, -88, -85,
+    -82, -77, -73, -66, -59, -53, -46, -38, -29, -6, 37, 43, 58, 62, 71, 73,
+    79, 83, 86, 89, 90, 90, 89, 88, 85, 79, 76, 70, 64, 57, 50, 44,
+    34, 16, -27, -46, -51, -55, -64, -71, -77, -81, -84, -87, -88, -90, -90, -89,
+    -86, -83, -80, -76, -69, -62, -56, -49, -41, -34, -24, 33, 41, 47, 62, 66,
+    69, 76, 82, 86, 87, 88, 89, 90, 88, 87, 84, 78, 75, 68, 62, 55,
+    49, 42, 33, -15, -40, -46, -51, -55, -64, -71, -77, -81, -84, -87, -88, -90,
+    -90, -89, -86, -83, -80, -74, -68, -63, -56, -50, -40, -34, -19, 41, 49, 55,
+    60, 64, 73, 75, 81, 85, 86, 89, 90, 90, 89, 88, 85, 79, 76, 70,
+    64, 57, 50, 44, 34, 28, 13, -47, -55, -61, -66, -70, -73, -80, -82, -86,
+    -89, -90, -90, -89, -87, -86, -83, -77, -72, -66, -60, -53, -46, -40, -30, -12,
+    31, 50, 55, 59, 68, 75, 77, 81, 84, 87, 88, 90, 90, 89, 86, 83,
+    80, 74, 68, 63, 56, 50, 43, 35, 20, -40, -48, -54, -59, -63, -72, -74,
+    -80, -84, -87, -88, -89, -90, -89, -88, -85, -82, -77, -73, -67, -60, -54, -47,
+    -40, -30, -7, 36, 42, 57, 61, 64, 71, 77, 81, 84, 87, 88, 90, 90,
+    89, 87, 84, 81, 76, 71, 65, 59, 52, 45, 39, 29, 11, -32, -51, -56,
+    -60, -69, -71, -77, -81, -84, -87, -88, -90, -90, -89, -87, -84, -80, -76, -70,
+    -65, -58, -52, -45, -37, -30, -20, 37, 45, 51, 56, 68, 71, 78, 80, 84,
+    87, 88, 89, 90, 89, 88, 85, 79, 76, 72, 65, 58, 52, 45, 39, 30,
+    7, -36, -42, -57, -61, -64, -71, -77, -81, -84, -87, -88, -90, -90, -89, -87,
+    -85, -81, -77, -71, -66, -60, -54, -47, -40, -34, -11, 32, 38, 53, 57, 66,
+    68, 74, 81, 82, 85, 88, 90, 90, 89, 88, 87, 83, 79, 73, 70, 63,
+    57, 50, 42, 35, 28, -2, -45, -51, -56, -60, -69, -71, -77, -81, -84, -87,
+    -88, -90, -90, -89, -87, -84, -81, -78, -72, -66, -59, -53, -46, -39, -33, -10,
+    33, 39, 54, 58, 61, 68, 74, 78, 84, 85, 88, 90, 90, 90, 88, 86,
+    83, 80, 75, 69, 64, 58, 52, 45, 38, 32, 9, -34, -40, -55, -59, -62,
+    -69, -75, -79, -85, -86, -89, -90, -90, -89, -88, -87, -83, -79, -73, -70, -64,
+    -58, -51, -44, -38, -28, -10, 33, 52, 57, 61, 64, 71, 77, 81, 84, 87,
+    88, 90, 90, 89, 88, 87, 83, 79, 76, 71, 64, 58, 51, 45, 38, 31,
+    1, -42, -48, -53, -57, -66, -68, -74, -81, -82, -85, -88, -90, -90, -90, -88,
+    -86, -83, -80, -76, -72, -65, -58, -52, -45, -39, -32, -22, 35, 43, 49, 54,
+    66, 69, 76, 78, 82, 85, 88, 89, 90, 90, 89, 87, 85, 81, 77, 74,
+    67, 63, 55, 51, 42, 35, 29, 6, -37, -43, -58, -62, -65, -72, -74, -81,
+    -84, -87, -88, -90, -90, -89, -88, -87, -83, -79, -76, -71, -65, -59, -54, -47,
+    -41, -31, -13, 30, 49, 54, 58, 61, 68, 74, 78, 81, 84, 87, 89, 90,
+    90, 89, 88, 85, 82, 79, 75, 68, 65, 58, 51, 45, 38, 32, 17, -43,
+    -51, -45, -60, -64, -67, -74, -76, -83, -84, -87, -88, -90, -90, -89, -88, -87,
+    -83, -79, -73, -70, -63, -57, -50, -44, -39, -32, -2, 41, 47, 52, 56, 65,
+    67, 73, 77, 83, 84, 87, 89, 90, 90, 89, 88, 85, 82, 79, 75, 71,
+    65, 58, 52, 46, 39, 32, 2, -41, -47, -52, -56, -59, -66, -72, -76, -82,
+    -83, -87, -89, -90, -90, -89, -88, -87, -84, -81, -76, -72, -66, -59, -53, -48,
+    -41, -35, -28, -10, 33, 52, 57, 61, 64, 71, 73, 80, 83, 86, 87, 89,
+    90, 90, 89, 88, 85, 82, 78, 74, 69, 64, 58, 52, 45, 38, 32, 9,
+    -34, -40, -45, -57, -60, -67, -73, -77, -80, -83, -87, -89, -90, -90, -90, -89,
+    -88, -85, -79, -76, -72, -67, -62, -55, -49, -42, -36, -29, -19, 38, 46, 52,
+    57, 61, 64, 71, 73, 77, 80, 81, 82, 84, 84, 83, 82, 81, 78, 75,
+    71, 67, 62, 57, 51, 45, 40, 33, 27, 4, -39, -45, -40, -52, -55, -62,
+    -64, -68, -71, -74, -75, -77, -78, -78, -77, -76, -75, -72, -69, -66, -62, -57,
+    -54, -48, -42, -37, -31, -25, -10, 36, 31, 43, 46, 48, 54, 58, 61, 64,
+    67, 69, 70, 71, 71, 71, 70, 69, 66, 65, 62, 58, 55, 50, 44, 41,
+    37, 31, 27, 21, 6, -27, -32, -36, -45, -47, -49, -53, -56, -59, -62, -63,
+    -64, -64, -64, -64, -63, -62, -59, -58, -55, -51, -48, -43, -40, -35, -31, -26,
+    -21, -11, 25, 29, 32, 39, 41, 45, 46, 49, 52, 54, 56, 57, 57, 58,
+    58, 57, 56, 55, 53, 50, 49, 46, 43, 38, 34, 31, 27, 23, 20, 13,
+    -22, -30, -24, -29, -33, -36, -43, -45, -46, -47, -48, -49, -51, -51, -51, -50,
+    -49, -48, -46, -44, -43, -40, -37, -34, -30, -27, -24, -20, -16, 2, 27, 21,
+    26, 30, 33, 35, 37, 38, 39, 40, 43, 43, 44, 44, 44, 44, 43, 42,
+    40, 39, 38, 35, 32, 31, 27, 24, 21, 18, 15, 12, 8, -15, -23, -17,
+    -22, -26, -29, -31, -33, -34, -35, -36, -37, -37, -37, -37, -37, -36, -35, -33,
+    -32, -31, -28, -27, -24, -23, -20, -17, -14, -12, -5, 11, 18, 20, 21, 22,
+    23, 24, 26, 28, 29, 29, 30, 30, 30, 30, 30, 29, 29, 28, 27, 26,
+    24, 22, 21, 19, 17, 16, 13, 12, 9, -1, -6, -10, -13, -15, -17, -18,
+    -19, -20, -21, -22, -23, -23, -24, -24, -23, -23, -23, -22, -21, -20, -19, -18,
+    -17, -16, -15, -13, -11, -10, -8, -7, -3, 7, 8, 9, 10, 12, 13, 14,
+    15, 15, 16, 16, 16, 17, 17, 16, 16, 16, 15, 15, 14, 13, 13, 12,
+    11, 10, 9, 8, 7, 6, 5, 1, -6, -5, -6, -7, -7, -8, -8, -9,
+    -9, -9, -10, -10, -10, -10, -9, -9, -9, -9, -8, -8, -7, -7, -6, -6,
+    -5, -5, -4, -4, -3, -2, -2, 1, 2, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 1, 1, 1, 1, 0, 0,
+};
+
+const int8_t CLIP_VICTORY_DECODED[4000] = {
+    0, 1, 4, 7, 8, 8, 7, 6, 2, -18, -24, -19, -23, -20, -13, 17,
+    25, 31, 36, 40, 37, 25, -5, -30, -49, -54, -58, -55, -43, -29, -6, 54,
+    60, 75, 71, 68, 51, 29, -39, -64, -83, -88, -84, -68, -51, -21, 57, 82,
+    88, 93, 81, 65, 38, -35, -60, -79, -84, -88, -72, -55, -33, 45, 70, 76,
+    91, 87, 71, 49, -12, -55, -74, -89, -85, -76, -59, -37, 41, 66, 85, 90,
+    86, 70, 53, 31, -47, -72, -78, -83, -79, -70, -43, 30, 55, 74, 89, 85,
+    76, 59, 37, -41, -66, -72, -87, -83, -74, -52, -32, 16, 76, 82, 87, 83,
+    67, 45, -16, -59, -78, -83, -87, -78, -56, -36, 12, 55, 74, 89, 85, 69,
+    52, 26, -52, -77, -83, -88, -76, -60, -43, -13, 47, 80, 85, 81, 72, 55,
+    33, -45, -70, -76, -81, -77, -68, -46, 15, 58, 64, 79, 83, 80, 63, 41,
+    -37, -62, -68, -83, -79, -70, -53, -31, 47, 72, 78, 83, 79, 70, 48, -13,
+    -56, -75, -80, -84, -75, -58, -40, 8, 51, 70, 85, 81, 72, 55, 29, -49,
+    -57, -76, -81, -77, -68, -46, 15, 58, 64, 79, 83, 74, 57, 39, -9, -52,
+    -71, -86, -82, -66, -49, -27, 41, 66, 72, 77, 81, 65, 43, -18, -43, -76,
+    -81, -77, -74, -57, -35, 33, 58, 77, 82, 78, 69, 47, 27, -21, -64, -83,
+    -78, -74, -65, -43, 18, 43, 76, 81, 77, 74, 57, 35, -33, -58, -77, -82,
+    -78, -69, -47, -27, 21, 64, 83, 78, 74, 58, 41, 11, -49, -68, -83, -79,
+    -70, -53, -31, 37, 62, 68, 83, 79, 63, 46, 16, -44, -63, -78, -82, -73,
+    -61, -39, 29, 54, 73, 78, 82, 66, 54, 32, -36, -61, -80, -75, -79, -63,
+    -46, -16, 44, 63, 78, 82, 73, 56, 38, -10, -53, -72, -77, -73, -70, -48,
+    -28, 20, 63, 69, 74, 78, 62, 45, 15, -45, -64, -79, -75, -72, -55, -37,
+    11, 54, 73, 78, 74, 65, 48, 26, -42, -67, -73, -78, -74, -58, -41, -11,
+    49, 68, 73, 77, 68, 56, 34, -34, -59, -65, -80, -76, -67, -45, -25, 23,
+    66, 72, 77, 73, 57, 40, 10, -50, -69, -74, -78, -69, -52, -34, 14, 57,
+    76, 81, 77, 61, 44, 26, -22, -65, -71, -76, -72, -56, -39, -9, 51, 70,
+    75, 79, 70, 53, 31, -37, -62, -68, -73, -69, -60, -43, -25, 23, 66, 72,
+    77, 73, 57, 35, -26, -51, -70, -75, -71, -68, -51, -29, 39, 64, 70, 75,
+    71, 62, 40, -21, -46, -65, -70, -74, -71, -54, -36, 12, 55, 61, 76, 72,
+    63, 46, 28, -20, -63, -69, -74, -70, -61, -39, 22, 47, 66, 71, 75, 66,
+    54, 36, -12, -55, -61, -76, -72, -63, -46, -28, 20, 63, 69, 74, 70, 54,
+    37, 7, -53, -59, -74, -70, -67, -50, -32, 16, 59, 65, 70, 74, 58, 46,
+    24, -44, -52, -71, -76, -72, -56, -39, -9, 51, 57, 72, 76, 67, 50, 32,
+    -16, -59, -65, -70, -66, -63, -41, -21, 27, 52, 71, 76, 64, 55, 38, 8,
+    -52, -58, -73, -69, -66, -49, -31, 17, 60, 66, 71, 67, 58, 41, 23, -25,
+    -50, -69, -74, -70, -54, -37, -7, 53, 59, 74, 70, 61, 49, 27, -30, -55,
+    -61, -66, -70, -54, -42, -12, 48, 54, 69, 73, 64, 52, 34, -14, -39, -58,
+    -73, -69, -60, -48, -26, 31, 56, 62, 67, 71, 55, 38, 8, -35, -54, -69,
+    -73, -64, -52, -34, 14, 39, 58, 73, 69, 60, 43, 25, -23, -48, -67, -72,
+    -68, -52, -40, -10, 50, 56, 71, 67, 64, 47, 33, 10, -50, -56, -71, -67,
+    -58, -41, -23, 25, 50, 69, 74, 62, 53, 36, 6, -37, -56, -71, -67, -64,
+    -42, 19, 44, 63, 68, 64, 48, 21, -39, -64, -70, -65, -45, -23, 14, 57,
+    63, 68, 48, 26, -11, -54, -73, -68, -48, -26, 11, 54, 73, 68, 48, 26,
+    -11, -54, -73, -68, -48, -32, 5, 48, 67, 62, 50, 34, -3, -63, -69, -64,
+    -52, -30, 7, 50, 69, 64, 52, 36, -1, -44, -63, -68, -56, -34, 3, 46,
+    65, 70, 58, 36, -1, -44, -63, -68, -56, -40, -3, 40, 59, 64, 60, 38,
+    1, -42, -61, -66, -62, -40, -3, 40, 59, 64, 60, 44, 7, -36, -55, -70,
+    -58, -42, -20, 41, 66, 72, 57, 45, 23, -14, -57, -63, -58, -46, -24, 13,
+    56, 62, 67, 47, 25, -12, -55, -61, -66, -46, -30, 7, 50, 69, 64, 52,
+    30, -7, -50, -69, -64, -52, -30, 7, 50, 69, 64, 52, 30, -7, -50, -69,
+    -64, -52, -36, 1, 44, 63, 68, 56, 34, -3, -46, -65, -60, -56, -40, -3,
+    40, 59, 64, 60, 38, 1, -42, -61, -66, -54, -38, -1, 42, 61, 66, 54,
+    38, 1, -42, -61, -66, -62, -40, -18, 43, 51, 70, 55, 43, 21, -16, -59,
+    -65, -60, -48, -26, 11, 54, 60, 65, 45, 23, -14, -57, -63, -58, -46, -24,
+    13, 56, 62, 57, 45, 29, -8, -51, -57, -62, -50, -28, 9, 52, 58, 63,
+    51, 29, -8, -51, -57, -62, -50, -34, 3, 46, 65, 60, 56, 34, -3, -46,
+    -65, -60, -56, -34, 3, 46, 65, 60, 56, 34, -3, -46, -52, -57, -53, -37,
+    0, 43, 62, 67, 55, 39, 2, -41, -60, -65, -53, -37, -20, 10, 53, 59,
+    54, 42, 20, -17, -60, -66, -61, -41, -25, 12, 55, 61, 56, 44, 22, -15,
+    -58, -64, -59, -47, -25, 12, 55, 61, 56, 44, 28, -9, -52, -58, -63, -51,
+    -29, 8, 51, 57, 62, 50, 28, -9, -52, -58, -63, -51, -29, 8, 51, 57,
+    62, 50, 34, -3, -46, -52, -57, -53, -31, 6, 49, 55, 60, 48, 32, -5,
+    -48, -54, -59, -55, -39, -2, 41, 60, 65, 53, 37, 0, -43, -49, -64, -52,
+    -36, 1, 44, 50, 55, 51, 42, 20, -33, -58, -64, -59, -39, -23, 14, 57,
+    63, 58, 46, 24, -13, -56, -62, -57, -45, -23, 14, 57, 63, 58, 46, 24,
+    -13, -56, -62, -57, -45, -29, 8, 51, 57, 62, 50, 28, -9, -52, -58, -53,
+    -49, -27, 10, 53, 59, 54, 50, 28, -9, -52, -58, -53, -49, -33, 4, 47,
+    53, 58, 46, 30, -7, -50, -56, -61, -49, -33, 4, 47, 53, 58, 54, 38,
+    1, -42, -48, -53, -49, -40, -3, 40, 46, 61, 49, 40, 18, -35, -43, -62,
+    -57, -37, -21, 16, 41, 60, 55, 43, 21, -16, -41, -60, -55, -43, -21, 16,
+    41, 60, 55, 43, 27, -10, -53, -59, -54, -42, -26, 11, 54, 60, 55, 43,
+    27, -10, -53, -59, -54, -42, -26, 11, 36, 55, 60, 48, 32, -5, -48, -54,
+    -59, -47, -31, 6, 49, 55, 60, 48, 32, -5, -48, -54, -59, -47, -31, 6,
+    31, 50, 55, 51, 35, -2, -45, -51, -56, -52, -36, 1, 44, 50, 55, 51,
+    35, 18, -12, -55, -49, -54, -34, -18, 19, 44, 50, 55, 35, 19, -18, -43,
+    -49, -54, -42, -20, 17, 42, 48, 53, 41, 25, -12, -37, -56, -51, -39, -23,
+    14, 39, 58, 53, 41, 25, -12, -37, -56, -51, -47, -25, 12, 37, 56, 51,
+    47, 25, -12, -37, -56, -51, -47, -31, 6, 49, 55, 50, 46, 30, -7, -32,
+    -51, -56, -44, -28, 9, 34, 53, 58, 46, 30, -7, -32, -51, -56, -52, -36,
+    1, 44, 50, 55, 51, 35, -2, -27, -46, -51, -47, -38, -16, 29, 54, 48,
+    53, 41, 19, -18, -43, -49, -54, -42, -20, 17, 42, 48, 53, 41, 19, -18,
+    -43, -49, -44, -24, 24, 49, 55, 50, 30, -18, -43, -49, -44, -32, 16, 41,
+    47, 52, 32, -16, -41, -47, -52, -32, 16, 41, 47, 52, 40, 18, -19, -44,
+    -50, -35, -15, 33, 41, 47, 42, 22, -26, -51, -45, -40, -20, 28, 53, 47,
+    42, 22, -26, -51, -57, -42, -30, 18, 43, 49, 44, 32, -16, -41, -47, -42,
+    -30, 18, 43, 49, 44, 32, -16, -41, -47, -52, -32, 16, 41, 47, 52, 40,
+    18, -19, -44, -50, -35, -15, 33, 41, 47, 42, 22, -26, -51, -45, -40, -20,
+    28, 53, 47, 42, 22, -26, -51, -45, -40, -28, 20, 45, 51, 46, 26, -22,
+    -47, -53, -48, -28, 20, 45, 51, 46, 34, -14, -39, -45, -50, -38, 10, 35,
+    54, 49, 37, 15, -22, -47, -53, -38, -18, 30, 55, 49, 44, 24, -24, -49,
+    -43, -38, -26, 22, 47, 53, 38, 26, -22, -47, -53, -48, -28, 20, 45, 51,
+    46, 26, -22, -47, -53, -48, -28, 20, 45, 51, 46, 34, -14, -39, -45, -50,
+    -38, 10, 35, 41, 46, 34, 18, -19, -44, -50, -35, -15, 33, 41, 47, 42,
+    22, -26, -51, -45, -40, -20, 28, 36, 55, 40, 28, -20, -45, -51, -46, -26,
+    22, 47, 53, 48, 28, -20, -45, -51, -46, -34, 14, 39, 45, 50, 30, -18,
+    -43, -49, -44, -32, 16, 41, 47, 52, 32, 16, -21, -46, -52, -37, -17, 31,
+    39, 45, 40, 20, -28, -36, -42, -37, -25, 23, 48, 54, 39, 27, -21, -46,
+    -52, -47, -27, 21, 46, 52, 47, 27, -21, -46, -52, -47, -27, 15, 40, 46,
+    41, 29, -13, -38, -44, -49, -37, 11, 36, 42, 47, 35, 19, -18, -43, -49,
+    -34, -22, 26, 51, 45, 40, 20, -28, -36, -42, -37, -25, 23, 48, 42, 37,
+    25, -23, -48, -42, -37, -25, 23, 31, 50, 45, 25, -17, -42, -48, -43, -31,
+    17, 42, 48, 43, 31, -17, -42, -48, -43, -31, -15, 22, 47, 41, 36, 16,
+    -32, -40, -46, -41, -21, 27, 35, 41, 36, 24, -24, -49, -43, -38, -26, 22,
+    47, 41, 36, 24, -24, -32, -51, -46, -26, 22, 30, 49, 44, 24, -18, -43,
+    -49, -44, -32, 16, 41, 47, 42, 30, -12, -37, -43, -48, -36, -14, 23, 48,
+    42, 37, 17, -31, -39, -45, -40, -20, 28, 36, 42, 37, 17, -25, -33, -39,
+    -34, -22, 26, 34, 40, 35, 23, -19, -44, -38, -43, -23, 19, 44, 50, 45,
+    25, -17, -42, -48, -43, -31, 17, 25, 44, 39, 27, -15, -40, -46, -41, -29,
+    -13, 24, 49, 43, 38, 18, -30, -38, -44, -39, -19, 29, 37, 43, 38, 18,
+    -24, -32, -38, -33, -21, 21, 46, 40, 35, 23, -19, -44, -38, -43, -23, 19,
+    27, 46, 41, 29, -19, -27, -46, -41, -29, 13, 38, 44, 39, 27, -15, -23,
+    -42, -37, -33, -17, 20, 45, 39, 34, 14, -28, -36, -42, -37, -17, 25, 33,
+    39, 34, 22, -26, -34, -40, -35, -23, 19, 44, 38, 43, 23, -19, -44, -38,
+    -43, -23, 19, 27, 46, 41, 29, -13, -38, -44, -39, -27, 15, 23, 42, 37,
+    33, -15, -23, -42, -37, -33, -17, 20, 45, 39, 34, 14, -28, -36, -42, -37,
+    -17, 25, 33, 39, 34, 22, -20, -45, -39, -34, -22, 20, 28, 47, 42, 22,
+    -20, -28, -47, -42, -22, 20, 28, 47, 42, 30, -18, -26, -45, -40, -28, 14,
+    22, 41, 36, 32, 16, -21, -46, -40, -35, -15, 27, 35, 41, 36, 16, -26,
+    -34, -40, -35, -15, 27, 35, 41, 36, 24, -24, -32, -38, -33, -21, 21, 29,
+    35, 40, 20, -22, -30, -36, -41, -29, 19, 27, 46, 41, 29, -13, -38, -44,
+    -39, -27, 15, 23, 42, 37, 33, 11, -26, -34, -40, -35, -15, 27, 35, 41,
+    26, -19, -44, -38, -23, 22, 47, 41, 15, -30, -38, -32, -17, 28, 36, 30,
+    -17, -25, -44, -29, 16, 41, 35, 30, -23, -31, -37, -22, 23, 31, 37, 22,
+    -31, -39, -33, -18, 27, 35, 29, -18, -26, -45, -30, 15, 40, 34, 29, -24,
+    -32, -38, -23, 22, 47, 41, 15, -30, -38, -32, 15, 40, 34, 29, -16, -41,
+    -35, -30, 23, 31, 37, 22, -23, -31, -37, -22, 23, 31, 37, 11, -26, -45,
+    -30, 15, 40, 34, 29, -16, -41, -35, -20, 25, 33, 39, 24, -21, -46, -40,
+    -14, 31, 39, 33, 7, -30, -36, -31, 14, 39, 33, 28, -17, -42, -36, -21,
+    24, 32, 38, 23, -22, -30, -36, -10, 27, 33, 28, -9, -28, -33, -29, 19,
+    27, 33, 28, -17, -42, -36, -21, 24, 32, 38, 12, -25, -44, -29, -9, 33,
+    41, 35, -12, -37, -43, -28, 17, 42, 36, 21, -24, -32, -38, -23, 22, 30,
+    36, 10, -27, -33, -28, 9, 28, 33, 29, -13, -38, -32, -27, 18, 43, 37,
+    22, -23, -31, -37, -11, 26, 32, 27, 15, -27, -35, -29, 18, 26, 32, 27,
+    -18, -26, -32, -27, 18, 43, 37, 22, -23, -31, -37, -11, 26, 32, 27, -10,
+    -29, -34, -30, 12, 37, 31, 26, -19, -27, -33, -18, 19, 38, 33, 21, -27,
+    -35, -29, -14, 31, 39, 33, -14, -39, -33, -28, 17, 25, 31, 26, -19, -27,
+    -33, -18, 27, 35, 29, 14, -23, -42, -27, -15, 27, 35, 29, -18, -26, -32,
+    -27, 18, 26, 32, 17, -20, -39, -34, -14, 28, 36, 30, 15, -30, -38, -32,
+    15, 23, 42, 27, -18, -26, -32, -27, 18, 26, 32, 17, -20, -39, -34, -14,
+    28, 36, 30, 15, -30, -38, -32, 15, 23, 29, 24, -13, -32, -37, -25, 23,
+    31, 37, 22, -23, -31, -25, -10, 27, 33, 28, -9, -28, -33, -29, 13, 38,
+    32, 27, -18, -26, -32, -17, 20, 39, 34, 14, -28, -36, -30, -15, 30, 38,
+    32, -15, -23, -29, -24, 13, 32, 37, 25, -17, -25, -31, -16, 21, 40, 35,
+    15, -27, -35, -29, 7, 27, 36, 24, -6, -31, -37, -22, 15, 34, 29, 17,
+    -18, -26, -32, -17, 20, 39, 34, 14, -28, -36, -30, 17, 25, 31, 26, -19,
+    -27, -33, -18, 19, 38, 33, 21, -21, -29, -35, -9, 28, 34, 29, 9, -26,
+    -34, -28, 19, 27, 33, 18, -19, -38, -33, -21, 21, 29, 35, 20, -25, -33,
+    -27, -12, 25, 31, 26, -11, -30, -35, -23, 12, 37, 31, 26, -19, -27, -33,
+    -18, 19, 38, 33, 13, -22, -30, -24, -9, 28, 34, 29, -16, -24, -30, -25,
+    12, 31, 36, 16, -19, -27, -33, -18, 19, 38, 33, 13, -22, -30, -24, 12,
+    24, 33, 26, -4, -29, -35, -20, 17, 36, 31, 19, -23, -31, -25, -10, 27,
+    33, 28, 8, -27, -35, -29, 7, 27, 30, 23, -7, -32, -26, -21, 16, 35,
+    30, 18, -24, -32, -26, -11, 26, 32, 27, -10, -29, -34, -22, 13, 21, 27,
+    22, -15, -34, -29, -17, 18, 26, 32, 17, -20, -26, -31, -11, 24, 32, 26,
+    -10, -30, -33, -21, 9, 34, 28, 23, -14, -33, -28, -16, 19, 27, 33, 18,
+    -27, -35, -29, -14, 23, 29, 24, -13, -32, -27, -23, 19, 27, 33, 18, -19,
+    -25, -30, -18, 24, 32, 26, 11, -26, -32, -27, 10, 29, 34, 22, -13, -21,
+    -27, -22, 15, 34, 29, 17, -18, -26, -32, -17, 20, 26, 31, 11, -24, -32,
+    -26, 10, 30, 33, 21, -9, -34, -28, -23, 14, 33, 28, 16, -19, -27, -21,
+    -16, 21, 27, 22, -6, -28, -30, -24, -1, 24, 30, 25, -20, -28, -34, -19,
+    18, 24, 29, 17, -25, -33, -27, -12, 25, 31, 26, -11, -30, -35, -23, 12,
+    20, 26, 21, -16, -35, -30, -18, 24, 32, 26, 11, -26, -32, -27, 10, 29,
+    34, 22, -13, -21, -27, -22, 15, 34, 29, 17, -18, -26, -32, -17, 20, 26,
+    31, 11, -24, -32, -26, 10, 22, 31, 19, -11, -36, -30, -15, 13, 29, 27,
+    17, -6, -31, -25, -10, 18, 27, 25, 11, -12, -37, -18, 8, 28, 31, 19,
+    -11, -36, -30, -15, 22, 28, 23, 11, -18, -33, -29, -13, 24, 32, 26, -10,
+    -22, -31, -19, 11, 19, 25, 20, -17, -23, -28, -16, 19, 27, 21, 16, -21,
+    -27, -22, -10, 25, 33, 27, -9, -29, -26, -19, 11, 19, 25, 20, -17, -23,
+    -28, -16, 19, 27, 21, 16, -21, -27, -22, 6, 22, 29, 23, 0, -25, -31,
+    -16, 12, 28, 30, 16, -7, -32, -26, -11, 17, 26, 24, 10, -13, -21, -27,
+    9, 21, 30, 18, -12, -20, -26, -21, 16, 22, 27, 15, -20, -28, -22, -7,
+    21, 30, 23, -7, -32, -26, -21, 16, 22, 27, 15, -14, -29, -25, -16, 16,
+    24, 30, 15, -22, -28, -23, -11, 24, 32, 26, -10, -22, -25, -18, 12, 20,
+    26, 21, -16, -22, -27, -15, 20, 28, 22, 7, -21, -30, -23, 7, 15, 34,
+    19, -9, -25, -27, -17, 6, 31, 25, 20, -17, -23, -28, -16, 19, 27, 21,
+    6, -22, -25, -23, 7, 32, 26, 21, -16, -22, -27, -15, 14, 29, 25, 16,
+    -16, -24, -30, -15, 22, 28, 23, 11, -24, -32, -26, 10, 22, 25, 18, -12,
+    -20, -26, -21, 16, 22, 27, 15, -20, -28, -22, -7, 21, 30, 23, -7, -15,
+    -34, -19, 9, 25, 27, 17, -6, -31, -25, -20, 17, 23, 28, 16, -19, -27,
+    -21, -6, 22, 25, 23, -7, -32, -26, -21, 16, 22, 27, 15, -14, -29, -25,
+    -16, 16, 24, 30, 15, -22, -28, -23, 5, 21, 28, 22, -1, -26, -32, -17,
+    11, 27, 25, 15, -8, -33, -27, -12, 16, 25, 23, 9, -14, -22, -16, 10,
+    22, 25, 18, -12, -20, -26, -21, 16, 22, 27, 15, -20, -28, -22, -7, 21,
+    24, 22, -8, -16, -22, -17, 11, 20, 27, 17, -6, -31, -25, -20, 17, 23,
+    28, 16, -19, -27, -21, -6, 22, 25, 23, -7, -15, -21, -16, 12, 21, 28,
+    18, -5, -30, -24, -19, 18, 24, 19, 15, -20, -28, -22, -7, 21, 24, 22,
+    -8, -16, -22, -17, 11, 27, 25, 15, -8, -33, -27, -12, 16, 25, 23, 9,
+    -14, -22, -16, 10, 22, 25, 18, -12, -20, -26, -21, 16, 22, 27, 15, -14,
+    -29, -25, -9, 18, 24, 19, 7, -22, -27, -23, 12, 20, 26, 21, -16, -22,
+    -27, -15, 14, 29, 25, 9, -18, -24, -19, -7, 22, 27, 23, -6, -21, -25,
+    -16, 11, 17, 22, 18, -11, -26, -22, -13, 14, 20, 25, 13, -16, -21, -17,
+    -8, 19, 25, 20, -8, -24, -26, -16, 7, 15, 21, 16, -12, -21, -23, -13,
+    10, 18, 24, 9, -19, -22, -20, 6, 14, 20, 15, -13, -22, -24, -18, 5,
+    30, 24, 19, -18, -24, -19, -15, 14, 29, 25, 9, -18, -24, -19, 9, 18,
+    25, 19, -4, -29, -23, -18, 10, 26, 24, 14, -9, -17, -23, -8, 20, 23,
+    21, 7, -16, -24, -18, 8, 20, 23, 16, -10, -18, -24, -19, 18, 24, 19,
+    15, -14, -19, -23, -7, 20, 26, 21, -7, -23, -25, -19, 4, 29, 23, 18,
+    -10, -26, -24, -14, 9, 17, 23, 8, -20, -23, -21, -7, 16, 24, 18, -8,
+    -20, -23, -16, 10, 18, 24, 19, -18, -24, -19, -15, 14, 19, 23, 7, -20,
+    -26, -21, 7, 23, 25, 19, -4, -29, -23, -18, 10, 19, 21, 15, -8, -16,
+    -22, -7, 13, 22, 20, 10, -13, -21, -15, 11, 23, 26, 14, -12, -20, -26,
+    -11, 9, 25, 23, 13, -10, -18, -24, -9, 19, 22, 20, -6, -14, -20, -15,
+    13, 22, 24, 14, -9, -17, -23, -18, 10, 26, 19, 13, -10, -18, -24, -9,
+    19, 22, 20, -6, -14, -20, -15, 13, 22, 24, 14, -9, -17, -23, -8, 12,
+    21, 23, 9, -14, -22, -16, -11, 17, 20, 18, -8, -16, -22, -17, 11, 20,
+    22, 12, -11, -19, -25, -10, 18, 21, 19, 9, -14, -22, -16, 10, 22, 25,
+    18, -8, -16, -22, -17, 11, 20, 22, 12, -11, -19, -25, -10, 18, 21, 19,
+    9, -14, -22, -16, 10, 22, 25, 13, -9, -24, -20, -11, 11, 23, 20, 13,
+    -13, -21, -15, -10, 18, 21, 19, -7, -15, -21, -16, 12, 21, 23, 13, -10,
+    -18, -24, -9, 11, 20, 22, 12, -11, -19, -13, -8, 20, 23, 16, -6, -21,
+    -25, -16, 11, 17, 22, 10, -12, -19, -21, -11, 7, 15, 21, 6, -14, -23,
+    -16, 6, 21, 25, 16, -11, -17, -22, -18, 11, 16, 20, 11, -11, -23, -20,
+    -8, 14, 19, 23, 7, -15, -19, -16, 6, 18, 21, 14, -8, -23, -19, -16,
+    11, 17, 22, 10, -12, -19, -17, -10, 8, 16, 22, 7, -21, -24, -17, 9,
+    17, 23, 18, -10, -19, -21, -11, 12, 20, 26, 11, -17, -20, -18, -8, 15,
+    23, 17, -9, -21, -18, -16, 10, 18, 24, 9, -11, -20, -18, -12, 11, 19,
+    25, 10, -18, -21, -19, -9, 14, 22, 16, -10, -14, -23, -16, 10, 18, 24,
+    9, -11, -20, -18, -12, 11, 19, 13, 8, -12, -21, -19, 7, 15, 21, 16,
+    -12, -21, -19, -13, 10, 18, 24, 9, -11, -20, -18, -8, 15, 23, 17, 12,
+    -16, -19, -17, 9, 17, 23, 18, -10, -19, -21, -11, 12, 20, 14, 9, -11,
+    -20, -18, -8, 15, 23, 17, -9, -13, -22, -15, 7, 22, 18, 15, -12, -18,
+    -23, -11, 11, 18, 20, 10, -8, -16, -22, -7, 13, 22, 15, -7, -22, -18,
+    -15, 7, 19, 22, 10, -12, -17, -21, -12, 15, 21, 16, 12, -17, -22, -18,
+    -9, 18, 24, 19, -9, -18, -20, -14, 9, 17, 23, 8, -12, -21, -19, -9,
+    14, 22, 16, 11, -17, -20, -18, 8, 16, 22, 17, -11, -20, -18, -12, 11,
+    19, 25, 10, -10, -19, -17, -11, 12, 20, 14, 9, -19, -22, -15, 7, 12,
+    16, 13, -9, -21, -18, -11, 11, 16, 20, 11, -11, -23, -20, -8, 14, 19,
+    15, -7, -19, -21, -14, 4, 12, 18, 13, -7, -16, -18, -12, 11, 19, 13,
+    8, -12, -21, -19, -9, 14, 22, 16, -10, -14, -17, -15, 7, 22, 18, 15,
+    -12, -18, -13, -9, 13, 20, 18, 8, -10, -18, -12, 3, 15, 18, 16, -6,
+    -21, -17, -14, 8, 20, 17, 10, -12, -17, -21, -12, 15, 21, 16, 4, -12,
+    -19, -17, 6, 14, 20, 15, -5, -21, -19, -13, 10, 18, 24, 9, -11, -20,
+    -18, -8, 15, 23, 17, 2, -18, -21, -14, 8, 13, 17, 14, -8, -20, -17,
+    -10, 12, 17, 21, 12, -15, -21, -16, -4, 12, 19, 17, -6, -14, -20, -15,
+    5, 14, 21, 11, -9, -15, -20, -8, 14, 21, 19, 9, -9, -17, -11, -6,
+    14, 17, 15, -7, -12, -16, -13, 9, 13, 16, 9, -9, -18, -16, -10, 13,
+    21, 15, 10, -10, -19, -17, 5, 20, 16, 13, -9, -13, -16, -14, 8, 13,
+    17, 8, -14, -18, -15, -8, 14, 19, 15, 6, -16, -20, -17, 5, 17, 20,
+    13, -9, -14, -18, -9, 13, 17, 20, 8, -10, -19, -17, -7, 13, 19, 14,
+    -6, -15, -17, -15, 8, 16, 22, 17, -11, -14, -16, -10, 10, 16, 21, 9,
+    -13, -20, -14, -7, 11, 19, 13, -2, -14, -17, -15, 7, 12, 16, 13, -9,
+    -13, -16, -9, 13, 18, 14, 5, -12, -18, -14, -6, 9, 15, 10, -10, -13,
+    -20, -14, 9, 17, 23, 8, -12, -15, -17, -7, 13, 19, 14, 10, -12, -19,
+    -13, 7, 13, 18, 14, -8, -15, -17, -10, 8, 16, 22, 7, -13, -16, -14,
+    -8, 12, 18, 13, 9, -13, -20, -14, 6, 12, 17, 13, -9, -16, -18, -11,
+    7, 15, 21, 6, -14, -17, -15, -9, 14, 22, 16, -10, -14, -17, -15, 7,
+    12, 16, 13, -9, -13, -16, -9, 9, 18, 16, 10, -13, -21, -15, -10, 10,
+    19, 12, -6, -15, -17, -11, 9, 15, 20, 8, -8, -15, -17, -10, 8, 16,
+    10, 5, -15, -18, -16, 6, 11, 15, 12, -5, -15, -16, -10, 5, 11, 16,
+    12, -10, -17, -15, -8, 10, 18, 12, 7, -13, -16, -14, 4, 13, 15, 13,
+    -7, -13, -18, -14, 8, 15, 17, 10, -8, -16, -10, -5, 15, 18, 16, 6,
+};
+
+#endif
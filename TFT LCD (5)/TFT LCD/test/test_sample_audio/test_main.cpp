@@ -0,0 +1,74 @@
+// SampleAudio.h decodificando los clips de SoundClips.h contra lo que dice
+// el decodificador de tools/gen_sound_clips.py (clips_decoded.h, generado
+// con --fixture): muestra por muestra en OCR2B, a la velocidad original, al
+// doble y con dos voces a la vez. Si cambia el ADPCM de un lado y no del
+// otro, esto falla.
+
+#include <unity.h>
+#include "SampleAudio.h"
+#include "SoundClips.h"
+#include "clips_decoded.h"
+#include "ArduinoMock.h"
+
+// lo que saca la interrupcion en la muestra i con un paso `step`
+static int expected(const int8_t* decoded, long i, uint16_t step) {
+    return decoded[(i + 1) * step / 0x100 - 1] + 128;
+}
+
+static void checkClip(const SoundClip* clip, const int8_t* decoded, long length, uint16_t step) {
+    sampleAudio.play(clip, step);
+    long n = length * 0x100 / step;
+    for (long i = 0; i < n; i++) {
+        sampleAudio.tick();
+        if (OCR2B != expected(decoded, i, step)) {
+            printf("muestra %ld\n", i);
+            TEST_ASSERT_EQUAL(expected(decoded, i, step), OCR2B);
+        }
+    }
+    sampleAudio.tick();
+    TEST_ASSERT_FALSE(sampleAudio.isPlaying());
+    TEST_ASSERT_EQUAL(128, OCR2B); // al terminar queda en silencio
+}
+
+void setUp() {
+    sampleAudio.stop();
+}
+
+void tearDown() {}
+
+void test_pcm8() {
+    checkClip(&CLIP_COIN, CLIP_COIN_DECODED, sizeof(CLIP_COIN_DECODED), 0x100);
+}
+
+void test_adpcm4() {
+    checkClip(&CLIP_HIT, CLIP_HIT_DECODED, sizeof(CLIP_HIT_DECODED), 0x100);
+    checkClip(&CLIP_GAMEOVER, CLIP_GAMEOVER_DECODED, sizeof(CLIP_GAMEOVER_DECODED), 0x100);
+    checkClip(&CLIP_VICTORY, CLIP_VICTORY_DECODED, sizeof(CLIP_VICTORY_DECODED), 0x100);
+}
+
+// al doble se salta una muestra de cada dos, pero el ADPCM las decodifica todas
+void test_double_speed() {
+    checkClip(&CLIP_HIT, CLIP_HIT_DECODED, sizeof(CLIP_HIT_DECODED), 0x200);
+    checkClip(&CLIP_VICTORY, CLIP_VICTORY_DECODED, sizeof(CLIP_VICTORY_DECODED), 0x200);
+}
+
+// dos voces se suman y se recortan a 8 bits
+void test_two_voices() {
+    sampleAudio.play(&CLIP_VICTORY);
+    sampleAudio.play(&CLIP_HIT);
+    for (long i = 0; i < (long)sizeof(CLIP_HIT_DECODED); i++) {
+        sampleAudio.tick();
+        int mix = CLIP_VICTORY_DECODED[i] + CLIP_HIT_DECODED[i];
+        mix = mix < -128 ? -128 : (mix > 127 ? 127 : mix);
+        TEST_ASSERT_EQUAL(mix + 128, OCR2B);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_pcm8);
+    RUN_TEST(test_adpcm4);
+    RUN_TEST(test_double_speed);
+    RUN_TEST(test_two_voices);
+    return UNITY_END();
+}
@@ -0,0 +1,108 @@
+// El modo de lado (SCROLL_WORLD) contra el panel de mentira, que entiende
+// MADCTL, VSCRDEF y VSCRSADD: despues de cada paso de la camara lo que se ve
+// a la derecha del dino tiene que ser el mundo (cielo negro, la linea del
+// piso, los cactus y las monedas que haya ahi), hasta pasar un rebase.
+// test_scroll_world_queue es lo mismo con el driver Tiny y RENDER_QUEUE.
+
+#define SCROLL_WORLD
+
+#include <unity.h>
+#define private public // las pruebas miran la pista y la camara
+#include "main.cpp"
+#undef private
+#include "ArduinoMock.h"
+
+// acostada (rotacion 1) las filas de la memoria son las columnas de la
+// pantalla, asi que el scroll vertical mueve el mundo de lado
+static uint16_t landscape(int x, int y) {
+    return mockPanel.shown(x, y);
+}
+
+// el pixel (x, y) de la pantalla segun la pista
+static uint16_t expected(int x, int y) {
+    EndlessTrack& track = game.track;
+    int wx = game.camera + x;
+    uint16_t color = y == SCROLL_FLOOR_Y ? ILI9341_WHITE : ILI9341_BLACK;
+    for (uint8_t i = 0; i < track.cactus.size(); i++) {
+        Obstacle& o = track.cactus.at(i);
+        int sx = wx - o.getX(), sy = y - o.getY();
+        if (sx >= 0 && sx < 32 && sy >= 0 && sy < 32) {
+            color = pgm_read_word(&spriteCactus[sy * 32 + sx]);
+        }
+    }
+    for (uint8_t i = 0; i < track.coins.size(); i++) {
+        Coin& c = track.coins.at(i);
+        int sx = wx - c.getX(), sy = y - c.getY();
+        if (!c.isCollectedCoin() && sx >= 0 && sx < 32 && sy >= 0 && sy < 32) {
+            color = pgm_read_word(&spriteMoneda[sy * 32 + sx]);
+        }
+    }
+    return color;
+}
+
+// salta los cactus que se acercan; el boton solo esa vuelta de loop()
+static bool jumpNow() {
+    EndlessTrack& track = game.track;
+    for (uint8_t i = 0; i < track.cactus.size(); i++) {
+        Obstacle& o = track.cactus.at(i);
+        int d = o.getX() - game.player.getX();
+        if (o.isActiveObstacle() && d >= 58 && d < 66) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void step(bool press) {
+    mockButton = press ? HIGH : LOW;
+    loop();
+    mockMs++;
+    mockUs += 1000;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_world_matches_after_each_scroll() {
+    while (game.state != STATE_PLAYING && mockMs < 10000) {
+        step(game.state == STATE_TITLE && mockMs % 500 == 0);
+    }
+    TEST_ASSERT_EQUAL(STATE_PLAYING, game.state);
+    // VSCRDEF: corren las primeras SCROLL_AREA columnas, el HUD queda fijo
+    TEST_ASSERT_EQUAL(0, mockPanel.tfa);
+    TEST_ASSERT_EQUAL(SCROLL_AREA, mockPanel.vsa);
+
+    int lastCamera = game.camera;
+    bool rebased = false;
+    long checked = 0;
+    while (!rebased && game.state == STATE_PLAYING && mockMs < 3000000) {
+        game.lives = START_LIVES; // para llegar al rebase aunque choque
+        step(jumpNow());
+        if (game.camera == lastCamera) {
+            continue;
+        }
+        rebased = game.camera < lastCamera;
+        lastCamera = game.camera;
+        for (int x = SCROLL_DINO_X + 48; x < SCROLL_AREA; x++) {
+            for (int y = 0; y < SCROLL_H; y++) {
+                if (landscape(x, y) != expected(x, y)) {
+                    printf("camara %d, (%d, %d)\n", game.camera, x, y);
+                    TEST_ASSERT_EQUAL_HEX16(expected(x, y), landscape(x, y));
+                }
+            }
+        }
+        checked++;
+    }
+    TEST_ASSERT_TRUE(rebased);
+    TEST_ASSERT_TRUE(checked > 100);
+    // el scroll esta donde dice la camara
+    TEST_ASSERT_EQUAL(game.camera & (SCROLL_AREA - 1), mockPanel.vsp);
+}
+
+int main() {
+    setup();
+    UNITY_BEGIN();
+    RUN_TEST(test_world_matches_after_each_scroll);
+    return UNITY_END();
+}
@@ -0,0 +1,5 @@
+// test_scroll_world con el driver Tiny (VSCRDEF y VSCRSADD van por el SPI)
+// y lo de cada cuadro por RenderQueue.h
+#define DISPLAY_TINY
+#define RENDER_QUEUE
+#include "../test_scroll_world/test_main.cpp"
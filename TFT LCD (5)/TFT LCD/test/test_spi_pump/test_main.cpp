@@ -0,0 +1,97 @@
+// El driver Tiny con SpiPump.h (DISPLAY_SPDR): rellenos, sprites de la flash
+// y sprites recortados contra los bordes, pixel por pixel contra el asset sin
+// comprimir. En la PC SpiPump manda byte por byte con SPI.transfer, que va al
+// panel de mentira, asi que esto prueba las ventanas, el recorte y el orden
+// de los bytes; los ciclos contados a mano del AVR solo se ven en la placa
+// (env:bench). test_spi_pump_rle es lo mismo con ASSET_RLE.
+
+#define DISPLAY_TINY
+
+#include <unity.h>
+#define private public // las pruebas dibujan con el Display del juego
+#include "main.cpp"
+#undef private
+#ifdef ASSET_RLE
+// los mismos sprites sin comprimir, para comparar
+namespace raw {
+#include "Cactus.h"
+#include "Moneda.h"
+}
+#else
+namespace raw {
+using ::spriteCactus;
+using ::spriteMoneda;
+}
+#endif
+#include "ArduinoMock.h"
+
+static Display& display = game.display;
+
+// la parte de un sprite de 32x32 dibujado en (x, y) que cae en la pantalla
+// tiene que ser igual al asset, y no se tiene que mandar ningun pixel de mas
+static void checkSprite(int x, int y, const uint16_t* sprite) {
+    long visible = 0;
+    for (int j = 0; j < 32; j++) {
+        for (int i = 0; i < 32; i++) {
+            if (x + i < 0 || x + i >= XMAX || y + j < 0 || y + j >= YMAX) {
+                continue;
+            }
+            visible++;
+            TEST_ASSERT_EQUAL_HEX16(pgm_read_word(&sprite[j * 32 + i]), mockPanel.at(x + i, y + j));
+        }
+    }
+    TEST_ASSERT_EQUAL(visible, mockPanel.pixels);
+}
+
+void setUp() {
+    display.fillScreen(ILI9341_BLACK);
+    mockPanel.pixels = 0;
+}
+
+void tearDown() {}
+
+void test_fill() {
+    display.fillRect(20, 30, 17, 9, ILI9341_RED);
+    for (int y = 29; y <= 39; y++) {
+        for (int x = 19; x <= 37; x++) {
+            bool inside = x >= 20 && x < 37 && y >= 30 && y < 39;
+            TEST_ASSERT_EQUAL_HEX16(inside ? ILI9341_RED : ILI9341_BLACK, mockPanel.at(x, y));
+        }
+    }
+    TEST_ASSERT_EQUAL(17 * 9, mockPanel.pixels);
+}
+
+// un relleno que se sale por la izquierda y por abajo
+void test_fill_clipped() {
+    display.fillRect(-5, YMAX - 4, 10, 10, ILI9341_RED);
+    TEST_ASSERT_EQUAL_HEX16(ILI9341_RED, mockPanel.at(0, YMAX - 1));
+    TEST_ASSERT_EQUAL_HEX16(ILI9341_RED, mockPanel.at(4, YMAX - 4));
+    TEST_ASSERT_EQUAL_HEX16(ILI9341_BLACK, mockPanel.at(5, YMAX - 4));
+    TEST_ASSERT_EQUAL(5 * 4, mockPanel.pixels);
+}
+
+void test_sprite() {
+    display.drawRGBBitmapFar(100, 10, ASSET_ADDR(spriteCactus), 32, 32);
+    checkSprite(100, 10, raw::spriteCactus);
+}
+
+void test_sprite_clipped_left() {
+    display.drawRGBBitmapFar(-9, 60, ASSET_ADDR(spriteMoneda), 32, 32);
+    checkSprite(-9, 60, raw::spriteMoneda);
+}
+
+void test_sprite_clipped_right_top() {
+    display.drawRGBBitmapFar(XMAX - 15, -5, ASSET_ADDR(spriteCactus), 32, 32);
+    checkSprite(XMAX - 15, -5, raw::spriteCactus);
+}
+
+int main() {
+    display.init();
+    UNITY_BEGIN();
+    RUN_TEST(test_fill);
+    RUN_TEST(test_fill_clipped);
+    RUN_TEST(test_sprite);
+    RUN_TEST(test_sprite_clipped_left);
+    RUN_TEST(test_sprite_clipped_right_top);
+    return UNITY_END();
+}
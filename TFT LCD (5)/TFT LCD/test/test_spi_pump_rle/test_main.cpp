@@ -0,0 +1,4 @@
+// test_spi_pump con los assets comprimidos (RleStream::pump: las rachas con
+// spiPumpFill y los literales con spiPumpStream), como en env:uno
+#define ASSET_RLE
+#include "../test_spi_pump/test_main.cpp"
@@ -0,0 +1,64 @@
+// La telemetria (Game::telemetryTask) contra el Serial de mentira, que se
+// vacia a 9600 baudios: jugando un minuto ninguna linea del reporte tiene
+// que esperar a que haya lugar en el buffer.
+
+#include <unity.h>
+#define private public // las pruebas miran el estado del juego
+#include "main.cpp"
+#undef private
+#include "ArduinoMock.h"
+
+// una vuelta de loop() por ms; el boton apretado solo esa vuelta
+static void step(bool press) {
+    mockButton = press ? HIGH : LOW;
+    loop();
+    mockMs++;
+    mockUs += 1000;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+// el modelo: lo que pasa de 63 bytes de una vez espera, y en el tiempo de
+// 63 bytes el buffer queda vacio
+void test_tx_model() {
+    long before = mockSerialBlocked;
+    for (int i = 0; i < 70; i++) {
+        Serial.write('.');
+    }
+    Serial.write('\n');
+    TEST_ASSERT_EQUAL(8, mockSerialBlocked - before);
+    TEST_ASSERT_EQUAL(0, Serial.availableForWrite());
+    mockUs += 63L * MOCK_SERIAL_BYTE_US;
+    TEST_ASSERT_EQUAL(SERIAL_TX_BUFFER_SIZE - 1, Serial.availableForWrite());
+}
+
+// un minuto apretando cada medio segundo: arranca, salta cuando sea,
+// pierde y vuelve a empezar. Los reportes salen enteros y ninguno espera
+void test_reports_never_wait() {
+    while (!game.booted && mockMs < 10000) {
+        step(false);
+    }
+    mockSerialBlocked = 0; // la linea del arranque sale una sola vez
+    int reports = 0;
+    uint8_t lastStep = 0;
+    unsigned long end = mockMs + 60000;
+    while (mockMs < end) {
+        step(mockMs % 500 == 0);
+        if (lastStep != 0 && game.reportStep == 0) {
+            reports++;
+        }
+        lastStep = game.reportStep;
+    }
+    TEST_ASSERT_TRUE(reports >= 4); // uno cada REPORT_TICKS ticks jugando
+    TEST_ASSERT_EQUAL(0, mockSerialBlocked);
+}
+
+int main() {
+    setup();
+    UNITY_BEGIN();
+    RUN_TEST(test_tx_model);
+    RUN_TEST(test_reports_never_wait);
+    return UNITY_END();
+}
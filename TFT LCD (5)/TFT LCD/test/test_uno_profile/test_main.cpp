@@ -0,0 +1,76 @@
+// El juego con lo mismo que pasa env:uno (driver Tiny, assets RLE, boton
+// en el 2 y sin lo opcional), en la PC: se arma el piso sin el mapa de
+// fondo y una partida se puede ganar. Lo que no se ve aqui es si entra en
+// el Uno: eso lo dice tools/check_budget.py al compilar.
+
+#define DISPLAY_TINY
+#define ASSET_RLE
+#define botonRight 2
+#define NO_TILEMAP
+#define NO_MEM_MONITOR
+#define NO_SCHEDULER
+#define NO_FLIGHT_RECORDER
+#define NO_LOG
+
+#include <unity.h>
+#define private public // las pruebas miran el estado del juego
+#include "main.cpp"
+#undef private
+#include "ArduinoMock.h"
+
+// una vuelta de loop() por ms; el boton apretado solo esa vuelta
+static void step(bool press) {
+    mockButton = press ? HIGH : LOW;
+    loop();
+    mockMs++;
+    mockUs += 1000;
+}
+
+// hasta jugando, apretando en el titulo
+static void startPlaying() {
+    while (game.state != STATE_PLAYING && mockMs < 10000) {
+        step(game.state == STATE_TITLE && mockMs % 500 == 0);
+    }
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+// sin Tilemap.h el fondo es negro con la linea blanca de cada piso
+void test_background_without_tilemap() {
+    startPlaying();
+    TEST_ASSERT_EQUAL(STATE_PLAYING, game.state);
+    for (int i = 1; i < FLOOR_COUNT; i++) {
+        int y = YMAX - FLOOR_OFFSETS[i];
+        TEST_ASSERT_EQUAL_HEX16(ILI9341_WHITE, mockPanel.at(XMAX - 4, y));
+        TEST_ASSERT_EQUAL_HEX16(ILI9341_BLACK, mockPanel.at(XMAX - 4, y - 1));
+        TEST_ASSERT_EQUAL_HEX16(ILI9341_BLACK, mockPanel.at(XMAX - 4, y + 1));
+    }
+}
+
+// saltando una vez por piso en los lugares que encontro tools/level_solver.cpp
+void test_game_is_winnable() {
+    const int jumpX[3] = { 35, 100, 75 };
+    int jumped = -1;
+    startPlaying();
+    while (game.state != STATE_VICTORY && game.state != STATE_GAME_OVER && mockMs < 120000) {
+        int floor = game.currentLevel;
+        bool press = game.state == STATE_PLAYING && jumped != floor && game.player.getX() >= jumpX[floor];
+        if (press) {
+            jumped = floor;
+        }
+        step(press);
+    }
+    TEST_ASSERT_EQUAL(STATE_VICTORY, game.state);
+    TEST_ASSERT_EQUAL(WIN_SCORE, game.score);
+    TEST_ASSERT_EQUAL(START_LIVES, game.lives);
+}
+
+int main() {
+    setup();
+    UNITY_BEGIN();
+    RUN_TEST(test_background_without_tilemap);
+    RUN_TEST(test_game_is_winnable);
+    return UNITY_END();
+}
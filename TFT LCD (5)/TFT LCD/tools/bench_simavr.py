@@ -0,0 +1,132 @@
+# Corre el banco de pruebas del display (src/Benchmark.h) en simavr con cada
+# transporte y junta los resultados en una tabla, para elegir el bus mas
+# rapido para las pantallas con muchos pixeles:
+#   bench_sw     SPI por software de adafruit (el cableado de siempre)
+#   bench        SPI por hardware con SpiPump.h
+#   bench_usart  USART2 en modo SPI maestro (UsartSpi.h)
+#
+# Compila cada env con pio, lo corre en simavr (ATmega2560 a 16 MHz) hasta
+# que sale "bench: fin" y lee las lineas que manda por Serial. Los tiempos
+# son los de micros() dentro de la simulacion, asi que solo valen si
+# simavr modela bien el periferico. El avr_uart de simavr no tiene el modo
+# MSPIM (no mira UMSEL): la USART saldria con los tiempos de una UART
+# normal, asi que en simavr los env con -DDISPLAY_USART se saltean. Con
+# --port se sube cada env a la placa y se lee su Serial (hace falta
+# pyserial); asi sale la tabla con los tres buses.
+#
+# Con un env del juego (megaatmega2560, uno, compositor...) lee en cambio la
+# linea "boot ms:" de src/BootProfile.h: cuanto tarda el arranque hasta el
+# primer cuadro (sin apretar el boton, o sea con el titulo entero). Despues
+# espera el primer reporte de telemetria (REPORT_TICKS ticks) y lee la linea
+# "despierto" de src/Scheduler.h: la parte del tiempo que la CPU no estuvo
+# dormida entre cuadros (simavr modela SLEEP_MODE_IDLE).
+#
+# Uso: python tools/bench_simavr.py [--port /dev/ttyACM0] [env ...]
+#      (pio en el PATH, y simavr si no se usa --port)
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+
+root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+
+DEFAULT_ENVS = ["bench_sw", "bench", "bench_usart"]
+MSPIM_ENVS = ["usart", "bench_usart"]  # simavr no los modela
+TIMEOUT_S = 300
+
+ANSI = re.compile(r"\x1b\[[0-9;]*m")
+LINE = re.compile(r"([^\t]+)\tx(\d+)\t(\d+) us\t(\d+) kpx/s")
+BOOT = re.compile(r"(\w+)=(\d+)")
+DUTY = re.compile(r"^despierto (\d+)% de (\d+) ms")
+
+
+def build(env):
+    subprocess.check_call(["pio", "run", "-e", env], cwd=root)
+    return os.path.join(root, ".pio", "build", env, "firmware.elf")
+
+
+def upload(env, port):
+    subprocess.check_call(["pio", "run", "-e", env, "-t", "upload", "--upload-port", port], cwd=root)
+
+
+def simavr_lines(elf):
+    proc = subprocess.Popen(["simavr", "-m", "atmega2560", "-f", "16000000", elf],
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    try:
+        for raw in proc.stdout:
+            yield raw
+    finally:
+        proc.kill()
+
+
+def serial_lines(port):
+    import serial
+    with serial.Serial(port, 9600, timeout=1) as tty:
+        while True:
+            raw = tty.readline()
+            if raw:
+                yield raw
+
+
+def collect(lines):
+    results = {}
+    start = time.time()
+    try:
+        for raw in lines:
+            line = ANSI.sub("", raw.decode(errors="replace")).strip()
+            match = LINE.search(line)
+            if match:
+                results[match.group(1).strip()] = "%s us %s kpx/s" % (match.group(3), match.group(4))
+            if line.startswith("boot ms:"):
+                for name, ms in BOOT.findall(line):
+                    results["boot " + name] = "%s ms" % ms
+            match = DUTY.search(line)
+            if match:
+                results["despierto"] = "%s%%" % match.group(1)
+                break
+            if "bench: fin" in line or time.time() - start > TIMEOUT_S:
+                break
+    finally:
+        lines.close()
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description="tabla del banco de pruebas en simavr o en la placa")
+    parser.add_argument("--port", help="subir cada env a la placa y leer su Serial")
+    parser.add_argument("envs", nargs="*", default=DEFAULT_ENVS)
+    args = parser.parse_args()
+
+    envs = args.envs
+    if not args.port:
+        skipped = [env for env in envs if env in MSPIM_ENVS]
+        for env in skipped:
+            print("bench_simavr: %s se saltea, simavr no modela MSPIM (correrlo con --port)" % env)
+        envs = [env for env in envs if env not in skipped]
+    table = {}
+    names = []
+    for env in envs:
+        if args.port:
+            upload(env, args.port)
+            table[env] = collect(serial_lines(args.port))
+        else:
+            table[env] = collect(simavr_lines(build(env)))
+        for name in table[env]:
+            if name not in names:
+                names.append(name)
+        if not table[env]:
+            print("bench_simavr: %s no mando resultados" % env)
+
+    print("%-20s" % "prueba" + "".join("%18s" % env for env in envs))
+    for name in names:
+        row = "%-20s" % name
+        for env in envs:
+            row += "%18s" % table[env].get(name, "-")
+        print(row)
+
+
+if __name__ == "__main__":
+    main()
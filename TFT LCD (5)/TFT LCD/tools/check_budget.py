@@ -0,0 +1,56 @@
+# Script de PlatformIO (extra_scripts = post:tools/check_budget.py)
+#
+# Despues de linkear imprime cuanto ocupa el firmware y falla el build si se
+# pasa del presupuesto de la placa:
+#  - flash: .text + .data (los valores iniciales de .data tambien van en la
+#    flash) contra upload.maximum_size de la placa (sin el bootloader);
+#  - RAM:   .data + .bss + .noinit contra upload.maximum_ram_size menos
+#    custom_ram_reserve, lo que se deja libre para la pila.
+# Como todo el juego es estatico (sin new), lo que mide el linker es casi
+# todo lo que se usa; lo unico que no se ve aqui es la pila.
+
+import re
+import subprocess
+
+Import("env")
+
+DEFAULT_RAM_RESERVE = 512
+
+
+def section_sizes(elf):
+    out = subprocess.check_output([env.subst("$SIZETOOL"), "-A", elf]).decode()
+    sizes = {}
+    for name, size in re.findall(r"^(\.\w+)\s+(\d+)", out, re.M):
+        sizes[name] = int(size)
+    return sizes
+
+
+def line(name, used, budget):
+    return "check_budget: %-5s %6d / %6d bytes (%5.1f%%)" % (name, used, budget, 100.0 * used / budget)
+
+
+def check_budget(source, target, env):
+    board = env.BoardConfig()
+    flash_budget = int(board.get("upload.maximum_size"))
+    ram_total = int(board.get("upload.maximum_ram_size"))
+    reserve = int(env.GetProjectOption("custom_ram_reserve", DEFAULT_RAM_RESERVE))
+    ram_budget = ram_total - reserve
+
+    sizes = section_sizes(str(target[0]))
+    flash = sizes.get(".text", 0) + sizes.get(".data", 0)
+    ram = sizes.get(".data", 0) + sizes.get(".bss", 0) + sizes.get(".noinit", 0)
+
+    print(line("flash", flash, flash_budget))
+    print(line("RAM", ram, ram_budget) + ", mas %d para la pila" % reserve)
+
+    ok = True
+    if flash > flash_budget:
+        print("check_budget: la flash se pasa por %d bytes" % (flash - flash_budget))
+        ok = False
+    if ram > ram_budget:
+        print("check_budget: la RAM se pasa por %d bytes (baja custom_ram_reserve solo si la pila cabe)" % (ram - ram_budget))
+        ok = False
+    return 0 if ok else 1
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", check_budget)
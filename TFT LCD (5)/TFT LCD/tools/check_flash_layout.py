@@ -0,0 +1,48 @@
+# Script de PlatformIO (extra_scripts = post:tools/check_flash_layout.py)
+#
+# Pide al linker un mapa de memoria y, despues de linkear, revisa donde quedo
+# cada cosa en la flash:
+#  - el PROGMEM normal (se lee con pgm_read_word, direcciones de 16 bits)
+#    tiene que terminar antes de los 64 KB, si no se leeria basura;
+#  - los assets ASSET_FAR (AssetBank.h) estan en .fini7 y se leen con
+#    direcciones de 24 bits, pueden quedar en cualquier parte.
+# Si el PROGMEM normal se pasa, el build falla.
+
+import re
+
+Import("env")
+
+map_path = env.subst("$BUILD_DIR/firmware.map")
+env.Append(LINKFLAGS=["-Wl,-Map," + map_path])
+
+NEAR_LIMIT = 0x10000
+
+
+def check_flash_layout(source, target, env):
+    text = open(map_path).read()
+
+    match = re.search(r"0x([0-9a-fA-F]+)\s+__trampolines_start = \.", text)
+    if match is None:
+        print("check_flash_layout: no encontre __trampolines_start en %s" % map_path)
+        return 1
+    near_end = int(match.group(1), 16)
+
+    bank = [(int(a, 16), int(s, 16))
+            for a, s in re.findall(r"^\s*\.fini7\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)", text, re.M)]
+    bank = [(a, s) for a, s in bank if s > 0]
+
+    print("check_flash_layout: PROGMEM cercano termina en 0x%05X (limite 0x%05X)" % (near_end, NEAR_LIMIT))
+    if bank:
+        start = min(a for a, s in bank)
+        end = max(a + s for a, s in bank)
+        print("check_flash_layout: banco de assets en 0x%05X-0x%05X (%d bytes)" % (start, end, end - start))
+    else:
+        print("check_flash_layout: banco de assets vacio (sin ELPM los assets van con el PROGMEM normal)")
+
+    if near_end > NEAR_LIMIT:
+        print("check_flash_layout: el PROGMEM cercano pasa de 64 KB, mueve assets grandes a ASSET_FAR")
+        return 1
+    return 0
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", check_flash_layout)
@@ -0,0 +1,35 @@
+# Script de PlatformIO (extra_scripts = pre:tools/check_levels.py)
+#
+# Compila tools/level_solver.cpp con el compilador del PC y lo corre antes de
+# cada build, asi cualquier cambio en src/GameConfig.h queda verificado.
+# Con `custom_level_check = strict` un nivel sin solucion detiene el build;
+# con `warn` solo se imprime el reporte. En strict tambien lo detiene no
+# tener con que compilar el verificador.
+
+import os
+import shutil
+import subprocess
+
+Import("env")
+
+project = env.subst("$PROJECT_DIR")
+mode = env.GetProjectOption("custom_level_check", "strict")
+source = os.path.join(project, "tools", "level_solver.cpp")
+binary = os.path.join(env.subst("$BUILD_DIR"), "level_solver")
+
+compiler = shutil.which("c++") or shutil.which("g++") or shutil.which("clang++")
+if compiler is None:
+    if mode == "strict":
+        print("check_levels: no hay compilador de C++ para el PC (custom_level_check = warn para seguir igual)")
+        env.Exit(1)
+    print("check_levels: no hay compilador de C++ para el PC, no se verifican los niveles")
+else:
+    os.makedirs(os.path.dirname(binary), exist_ok=True)
+    subprocess.check_call([compiler, "-O2", "-std=c++11",
+                           "-I", os.path.join(project, "src"), source, "-o", binary])
+    result = subprocess.run([binary])
+    if result.returncode != 0:
+        if mode == "strict":
+            print("check_levels: hay niveles sin solucion (ver reporte arriba)")
+            env.Exit(1)
+        print("check_levels: hay niveles sin solucion, se sigue porque custom_level_check = warn")
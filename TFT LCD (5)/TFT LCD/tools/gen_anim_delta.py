@@ -0,0 +1,80 @@
+# Genera src/SpriteAnim.h a partir de los cuadros de src/Sprite.h.
+#
+# El primer cuadro se guarda entero (keyframe). De cada cuadro siguiente solo
+# se guarda el rectangulo donde cambia respecto al keyframe, asi la animacion
+# ocupa menos flash y cambiar de cuadro sin moverse solo manda esas filas.
+#
+# Uso: python tools/gen_anim_delta.py
+
+import os
+import re
+
+root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+source = os.path.join(root, "src", "Sprite.h")
+target = os.path.join(root, "src", "SpriteAnim.h")
+
+W = H = 32
+NAME = "dino"
+
+text = open(source).read()
+body = text[text.index("PROGMEM = {") + len("PROGMEM = {"):]
+pixels = [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{4}", body)]
+frames = [pixels[i:i + W * H] for i in range(0, len(pixels), W * H)]
+key = frames[0]
+
+
+def words(values, indent="\t"):
+    lines = []
+    for i in range(0, len(values), 16):
+        lines.append(indent + ", ".join("0x%04x" % v for v in values[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+deltas = []
+for f, frame in enumerate(frames):
+    changed = [(i % W, i // W) for i in range(W * H) if frame[i] != key[i]]
+    if not changed:
+        deltas.append((0, 0, 0, 0, None))
+        continue
+    x0 = min(c[0] for c in changed)
+    x1 = max(c[0] for c in changed) + 1
+    y0 = min(c[1] for c in changed)
+    y1 = max(c[1] for c in changed) + 1
+    region = [frame[y * W + x] for y in range(y0, y1) for x in range(x0, x1)]
+    deltas.append((x0, y0, x1 - x0, y1 - y0, region))
+
+out = []
+out.append("#ifndef SpriteAnim_h")
+out.append("#define SpriteAnim_h")
+out.append("")
+out.append("#include \"AssetBank.h\" // AnimDelta y SpriteAnim")
+out.append("")
+out.append("// Generado por tools/gen_anim_delta.py desde Sprite.h, no editar a mano.")
+out.append("// Keyframe completo + un rectangulo por cuadro con lo que cambia.")
+out.append("")
+out.append("const uint16_t %sKey[%d] PROGMEM = {" % (NAME, W * H))
+out.append("\t// keyframe, %dx%dpx" % (W, H))
+out.append(words(key))
+out.append("};")
+for f, (x, y, w, h, region) in enumerate(deltas):
+    if region is None:
+        continue
+    out.append("")
+    out.append("const uint16_t %sDelta%d[%d] PROGMEM = {" % (NAME, f, w * h))
+    out.append("\t// cuadro %d, %dx%dpx en (%d, %d)" % (f, w, h, x, y))
+    out.append(words(region))
+    out.append("};")
+out.append("")
+out.append("const AnimDelta %sDeltas[%d] PROGMEM = {" % (NAME, len(deltas)))
+for f, (x, y, w, h, region) in enumerate(deltas):
+    pointer = "%sDelta%d" % (NAME, f) if region is not None else "0"
+    out.append("    { %d, %d, %d, %d, %s }," % (x, y, w, h, pointer))
+out.append("};")
+out.append("")
+out.append("const SpriteAnim %sAnim = { %sKey, %d, %d, %d, %sDeltas };" % (NAME, NAME, W, H, len(frames), NAME))
+out.append("")
+out.append("#endif")
+
+open(target, "w").write("\n".join(out) + "\n")
+stored = W * H + sum(d[2] * d[3] for d in deltas)
+print("%s: %d cuadros, %d pixeles guardados (antes %d)" % (os.path.relpath(target, root), len(frames), stored, len(pixels)))
@@ -0,0 +1,56 @@
+# Genera src/SplashArt.h: las imagenes grandes de las pantallas de inicio y
+# fin a la mitad de resolucion. Display::drawRGBBitmapScaled las vuelve a
+# agrandar al dibujarlas, asi ocupan la cuarta parte de la flash.
+#
+# Cada bloque de 2x2 pixeles se promedia por canal (RGB565).
+# Uso: python tools/gen_half_res.py
+
+import os
+import re
+
+root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+target = os.path.join(root, "src", "SplashArt.h")
+
+# (archivo fuente, arreglo, ancho, alto, nombre del arreglo nuevo)
+IMAGES = [
+    ("fondo.h", "spriteFondo", 64, 114, "splashFondo"),
+    ("gameoverwin.h", "spriteGameover", 64, 114, "splashGameover"),
+]
+
+
+def read_array(path, name):
+    text = open(path).read()
+    start = text.index(name)
+    body = text[text.index("{", start) + 1:text.index("};", start)]
+    return [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{4}", body)]
+
+
+def average(colors):
+    r = sum((c >> 11) & 0x1F for c in colors) // len(colors)
+    g = sum((c >> 5) & 0x3F for c in colors) // len(colors)
+    b = sum(c & 0x1F for c in colors) // len(colors)
+    return (r << 11) | (g << 5) | b
+
+
+out = ["#ifndef SplashArt_h", "#define SplashArt_h", "", "#include \"AssetBank.h\"", "",
+       "// Generado por tools/gen_half_res.py, no editar a mano.",
+       "// Imagenes a media resolucion en el banco de assets lejano; se dibujan con",
+       "// Display::drawRGBBitmapScaled."]
+for source, name, w, h, half in IMAGES:
+    pixels = read_array(os.path.join(root, "src", source), name)
+    assert len(pixels) == w * h, (source, len(pixels))
+    hw, hh = w // 2, h // 2
+    small = []
+    for y in range(hh):
+        for x in range(hw):
+            block = [pixels[(2 * y + dy) * w + 2 * x + dx] for dy in (0, 1) for dx in (0, 1)]
+            small.append(average(block))
+    out.append("")
+    out.append("const uint16_t %s[%d] ASSET_FAR = {" % (half, hw * hh))
+    out.append("\t// %s de %s, %dx%dpx (original %dx%d)" % (name, source, hw, hh, w, h))
+    for i in range(0, len(small), 16):
+        out.append("\t" + ", ".join("0x%04x" % v for v in small[i:i + 16]) + ",")
+    out.append("};")
+out += ["", "#endif", ""]
+open(target, "w").write("\n".join(out))
+print("%s: %d imagenes" % (os.path.relpath(target, root), len(IMAGES)))
@@ -0,0 +1,32 @@
+# Genera la tabla JUMP_ARC de src/JumpPhysics.h.
+#
+# El salto es una parabola de JUMP_TICKS ticks que sube JUMP_HEIGHT pixeles.
+# Cada entrada es la velocidad vertical del tick en Q8.8 (pixeles * 256,
+# negativo = hacia arriba), tomada en la mitad del tick para que la suma de
+# la tabla vuelva exactamente al piso.
+#
+# Uso: python tools/gen_jump_arc.py [alto] [ticks]
+
+import sys
+
+height = int(sys.argv[1]) if len(sys.argv) > 1 else 58
+ticks = int(sys.argv[2]) if len(sys.argv) > 2 else 20
+
+v0 = 4.0 * height / ticks           # pixeles por tick al despegar
+gravity = 8.0 * height / ticks ** 2 # pixeles por tick^2
+
+arc = [-round(256 * (v0 - gravity * (k + 0.5))) for k in range(ticks)]
+arc[-1] -= sum(arc)                 # cierra el redondeo: termina en el piso
+
+peak = 0
+y = 0
+for v in arc:
+    y += v
+    peak = min(peak, y)
+
+print("// JUMP_HEIGHT = %d, JUMP_TICKS = %d, gravedad = %d (Q8.8), pico = %.2f px"
+      % (height, ticks, round(256 * gravity), -peak / 256.0))
+print("const int16_t JUMP_ARC[JUMP_TICKS] PROGMEM = {")
+for i in range(0, ticks, 10):
+    print("    " + ", ".join("%d" % v for v in arc[i:i + 10]) + ",")
+print("};")
@@ -0,0 +1,151 @@
+# Compila la musica de resources/music.txt a src/MusicData.h (-DMUSIC).
+#
+# Cada fila de un patron es un byte: 0 sigue la nota anterior, 1 es
+# silencio y desde 2 es una nota de MUSIC_STEPS (solo las que se usan). El
+# paso de cada nota es lo que avanza por muestra el oscilador de 16 bits de
+# SampleAudio.h: frecuencia * 65536 / SAMPLE_RATE.
+#
+# Tambien corre como script de PlatformIO (extra_scripts = pre:tools/gen_music.py)
+# y solo reescribe el .h si cambio, para no recompilar de gusto.
+#
+# Uso: python tools/gen_music.py [entrada.txt] [salida.h]
+
+import os
+import sys
+
+RATE = 8000         # SAMPLE_RATE de SampleAudio.h
+ROWS = 16           # filas por patron
+ROWS_PER_BEAT = 4
+WAVE_LEN = 32       # el oscilador usa los 5 bits altos de la fase
+AMP = 40            # mas bajo que los efectos, que se oyen encima
+
+NAMES = ["C-", "C#", "D-", "D#", "E-", "F-", "F#", "G-", "G#", "A-", "A#", "B-"]
+
+
+def wave(name):
+    out = []
+    for i in range(WAVE_LEN):
+        if name == "square":
+            v = 1 if i < WAVE_LEN // 2 else -1
+        elif name == "pulse":
+            v = 1 if i < WAVE_LEN // 4 else -0.6
+        elif name == "triangle":
+            v = 1 - 4 * abs(i / float(WAVE_LEN) - 0.5)
+        else:
+            raise ValueError("onda desconocida: " + name)
+        out.append(int(round(AMP * v)))
+    return out
+
+
+def note_hz(text):
+    if text[:2] not in NAMES or not text[2].isdigit():
+        raise ValueError("nota invalida: " + text)
+    octave = int(text[2])
+    if octave < 2 or octave > 6:
+        raise ValueError("octava fuera de rango: " + text)
+    midi = 12 * (octave + 1) + NAMES.index(text[:2])
+    return 440.0 * 2 ** ((midi - 69) / 12.0)
+
+
+def parse(path):
+    tempo, wave_name = 120, "square"
+    patterns, order, current = {}, [], None
+    for n, line in enumerate(open(path), 1):
+        words = line.split("#")[0].split()
+        if not words:
+            continue
+        try:
+            if words[0] == "tempo":
+                tempo = int(words[1])
+            elif words[0] == "wave":
+                wave_name = words[1]
+            elif words[0] == "pattern":
+                current = patterns.setdefault(words[1], [])
+            elif words[0] == "order":
+                order += words[1:]
+            elif current is not None:
+                current += words
+            else:
+                raise ValueError("fila fuera de un patron")
+        except (ValueError, IndexError) as e:
+            sys.exit("%s:%d: %s" % (path, n, e))
+    for name, rows in patterns.items():
+        if len(rows) != ROWS:
+            sys.exit("%s: el patron %s tiene %d filas, tienen que ser %d" % (path, name, len(rows), ROWS))
+    for name in order:
+        if name not in patterns:
+            sys.exit("%s: el orden usa el patron %s, que no existe" % (path, name))
+    if not order:
+        sys.exit("%s: falta el orden" % path)
+    return tempo, wave_name, patterns, order
+
+
+def compile_music(src):
+    tempo, wave_name, patterns, order = parse(src)
+    names = sorted(patterns)
+    notes = sorted(set(r for p in patterns.values() for r in p if r not in ("---", "===")), key=note_hz)
+    steps = [int(round(note_hz(t) * 65536 / RATE)) for t in notes]
+    row_samples = int(round(RATE * 60.0 / (tempo * ROWS_PER_BEAT)))
+
+    def code(r):
+        if r == "---":
+            return 0
+        if r == "===":
+            return 1
+        return 2 + notes.index(r)
+
+    out = []
+    out.append("#ifndef MusicData_h")
+    out.append("#define MusicData_h")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("// Generado por tools/gen_music.py desde resources/music.txt, no editar a mano.")
+    out.append("")
+    out.append("#define MUSIC_ROW_SAMPLES %d // %d bpm, %d filas por tiempo" % (row_samples, tempo, ROWS_PER_BEAT))
+    out.append("#define MUSIC_ROWS %d" % ROWS)
+    out.append("#define MUSIC_ORDER_LEN %d" % len(order))
+    out.append("")
+    out.append("// onda %s, un ciclo en %d muestras" % (wave_name, WAVE_LEN))
+    out.append("const int8_t MUSIC_WAVE[%d] PROGMEM = {" % WAVE_LEN)
+    out.append("    " + ", ".join(str(v) for v in wave(wave_name)))
+    out.append("};")
+    out.append("")
+    out.append("// paso del oscilador de cada nota (la fila guarda 2 + el indice)")
+    out.append("const uint16_t MUSIC_STEPS[%d] PROGMEM = {" % len(steps))
+    out.append("    " + ", ".join("%d" % s for s in steps) + " // " + " ".join(notes))
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t MUSIC_PATTERNS[%d][MUSIC_ROWS] PROGMEM = {" % len(names))
+    for name in names:
+        out.append("    { " + ", ".join("%d" % code(r) for r in patterns[name]) + " }, // " + name)
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t MUSIC_ORDER[MUSIC_ORDER_LEN] PROGMEM = { "
+               + ", ".join("%d" % names.index(n) for n in order) + " }; // " + " ".join(order))
+    out.append("")
+    out.append("#endif")
+    return "\n".join(out) + "\n"
+
+
+def generate(src, dst):
+    text = compile_music(src)
+    old = open(dst).read() if os.path.exists(dst) else None
+    if text != old:
+        with open(dst, "w") as f:
+            f.write(text)
+        print("gen_music: %s -> %s" % (src, dst))
+
+
+try:
+    Import("env")
+except NameError: # fuera de PlatformIO
+    env = None
+
+if env is not None:
+    project = env.subst("$PROJECT_DIR")
+    generate(os.path.join(project, "resources", "music.txt"), os.path.join(project, "src", "MusicData.h"))
+else:
+    here = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+    generate(sys.argv[1] if len(sys.argv) > 1 else os.path.join(here, "resources", "music.txt"),
+             sys.argv[2] if len(sys.argv) > 2 else os.path.join(here, "src", "MusicData.h"))
@@ -0,0 +1,107 @@
+# Genera src/AssetsRle.h: los mismos assets de Cactus.h, Moneda.h,
+# SplashArt.h y el keyframe de SpriteAnim.h comprimidos con RLE, con los
+# mismos nombres. El env:uno compila con ASSET_RLE y usa este archivo en vez
+# de los originales; AssetStream (AssetBank.h) los descomprime al dibujar.
+#
+# Formato, por palabras de 16 bits: una cabecera h y luego
+#  - si h & 0x8000: una racha de h & 0x7FFF pixeles del color que sigue;
+#  - si no: h pixeles tal cual.
+# Las rachas de menos de 3 pixeles no ahorran nada y van como literales.
+#
+# Uso: python tools/gen_rle.py (despues de gen_anim_delta.py y gen_half_res.py)
+
+import os
+import re
+
+root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+target = os.path.join(root, "src", "AssetsRle.h")
+
+# (archivo, arreglo, ancho, alto, atributo)
+ASSETS = [
+    ("SpriteAnim.h", "dinoKey", 32, 32, "PROGMEM"),
+    ("Cactus.h", "spriteCactus", 32, 32, "ASSET_FAR"),
+    ("Moneda.h", "spriteMoneda", 32, 32, "ASSET_FAR"),
+    ("SplashArt.h", "splashFondo", 32, 57, "ASSET_FAR"),
+    ("SplashArt.h", "splashGameover", 32, 57, "ASSET_FAR"),
+]
+
+MIN_RUN = 3
+MAX_COUNT = 0x7FFF
+
+
+def read_array(path, name):
+    text = open(path).read()
+    start = text.index(name + "[")
+    body = text[text.index("{", start) + 1:text.index("};", start)]
+    return [int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]{4}", body)]
+
+
+def encode(pixels):
+    out = []
+    literal = []
+
+    def flush():
+        if literal:
+            out.append(len(literal))
+            out.extend(literal)
+            del literal[:]
+
+    i = 0
+    while i < len(pixels):
+        j = i
+        while j < len(pixels) and pixels[j] == pixels[i] and j - i < MAX_COUNT:
+            j += 1
+        if j - i >= MIN_RUN:
+            flush()
+            out += [0x8000 | (j - i), pixels[i]]
+            i = j
+        else:
+            literal.append(pixels[i])
+            i += 1
+            if len(literal) == MAX_COUNT:
+                flush()
+    flush()
+    return out
+
+
+def decode(words):
+    pixels = []
+    i = 0
+    while i < len(words):
+        h = words[i]
+        if h & 0x8000:
+            pixels += [words[i + 1]] * (h & 0x7FFF)
+            i += 2
+        else:
+            pixels += words[i + 1:i + 1 + h]
+            i += 1 + h
+    return pixels
+
+
+out = ["#ifndef AssetsRle_h", "#define AssetsRle_h", "", "#include \"AssetBank.h\"", "",
+       "// Generado por tools/gen_rle.py, no editar a mano.",
+       "// Assets comprimidos con RLE para ASSET_RLE (env:uno); se leen con AssetStream."]
+raw_total = packed_total = 0
+for source, name, w, h, attr in ASSETS:
+    pixels = read_array(os.path.join(root, "src", source), name)
+    assert len(pixels) == w * h, (source, name, len(pixels))
+    words = encode(pixels)
+    assert decode(words) == pixels, name
+    raw_total += 2 * len(pixels)
+    packed_total += 2 * len(words)
+    out.append("")
+    out.append("const uint16_t %s[%d] %s = {" % (name, len(words), attr))
+    out.append("\t// %s de %s, %dx%dpx (%d bytes sin comprimir)" % (name, source, w, h, 2 * len(pixels)))
+    for i in range(0, len(words), 16):
+        out.append("\t" + ", ".join("0x%04x" % v for v in words[i:i + 16]) + ",")
+    out.append("};")
+
+# los deltas y la descripcion de la animacion van igual que en SpriteAnim.h
+anim = open(os.path.join(root, "src", "SpriteAnim.h")).read()
+key_end = anim.index("};", anim.index("dinoKey[")) + 2
+tail = anim[key_end:anim.rindex("#endif")].strip("\n")
+out.append(tail)
+out += ["", "#endif", ""]
+
+open(target, "w").write("\n".join(out))
+print("%s: %d bytes (antes %d)" % (os.path.relpath(target, root), packed_total, raw_total))
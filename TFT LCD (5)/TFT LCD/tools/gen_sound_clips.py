@@ -0,0 +1,190 @@
+# Genera src/SoundClips.h: los efectos de sonido de -DSAMPLE_AUDIO como
+# muestras de 8 bits a 8 kHz (src/SampleAudio.h).
+#
+# Los efectos se sintetizan aqui mismo (no hay archivos .wav en el repo):
+# la moneda va en PCM de 8 bits con signo, que suena mas limpia, y los
+# demas en ADPCM de 4 bits (la mitad de flash). El codificador simula al
+# decodificador de SampleAudio.h paso por paso, asi que las tablas
+# ADPCM_STEPS y ADPCM_INDEX tienen que ser las mismas que alla.
+#
+# Uso: python tools/gen_sound_clips.py [--wav carpeta] [--fixture archivo.h] > src/SoundClips.h
+#      (con --wav ademas escribe cada efecto decodificado para escucharlo, y
+#      con --fixture las mismas muestras como arreglos de C para
+#      test/test_sample_audio, que las compara con lo que decodifica
+#      SampleAudio.h)
+
+import math
+import random
+import sys
+import wave
+
+RATE = 8000
+
+ADPCM_STEPS = [1, 2, 3, 4, 5, 6, 8, 10, 13, 16, 20, 26, 33, 42, 54, 70]
+ADPCM_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def clamp(v, lo, hi):
+    return max(lo, min(hi, v))
+
+
+def adpcm_decode_step(code, pred, index):
+    step = ADPCM_STEPS[index]
+    diff = step >> 3
+    if code & 4:
+        diff += step
+    if code & 2:
+        diff += step >> 1
+    if code & 1:
+        diff += step >> 2
+    pred = pred - diff if code & 8 else pred + diff
+    pred = clamp(pred, -128, 127)
+    index = clamp(index + ADPCM_INDEX[code & 7], 0, 15)
+    return pred, index
+
+
+def adpcm_encode(samples):
+    # prueba los 16 codigos y se queda con el que deja al decodificador mas cerca
+    pred, index = 0, 0
+    codes, decoded = [], []
+    for s in samples:
+        best = min(range(16), key=lambda c: abs(adpcm_decode_step(c, pred, index)[0] - s))
+        pred, index = adpcm_decode_step(best, pred, index)
+        codes.append(best)
+        decoded.append(pred)
+    if len(codes) & 1:
+        codes.append(0)
+    data = [codes[i] | (codes[i + 1] << 4) for i in range(0, len(codes), 2)] # bajo primero
+    return data, decoded
+
+
+def envelope(n, attack, decay):
+    return [min(1.0, i / max(1, attack)) * math.exp(-i / decay) for i in range(n)]
+
+
+def tone(freqs, seconds, decay, amp=100, square=0.3):
+    # freqs: lista de (segundos, Hz) que se van tocando en orden
+    n = int(RATE * seconds)
+    out, phase = [], 0.0
+    env = envelope(n, 40, decay * RATE)
+    for i in range(n):
+        t = i / RATE
+        f = freqs[0][1]
+        for start, hz in freqs:
+            if t >= start:
+                f = hz
+        phase += 2 * math.pi * f / RATE
+        s = math.sin(phase)
+        s = (1 - square) * s + square * (1 if s >= 0 else -1)
+        out.append(int(round(amp * env[i] * s)))
+    return out
+
+
+def sweep(f0, f1, seconds, amp=90, square=0.3):
+    n = int(RATE * seconds)
+    out, phase = [], 0.0
+    for i in range(n):
+        f = f0 + (f1 - f0) * i / n
+        phase += 2 * math.pi * f / RATE
+        env = min(1.0, i / 80) * min(1.0, (n - i) / 400)
+        s = math.sin(phase)
+        s = (1 - square) * s + square * (1 if s >= 0 else -1)
+        out.append(int(round(amp * env * s)))
+    return out
+
+
+def thud(seconds):
+    rnd = random.Random(41)
+    n = int(RATE * seconds)
+    out, phase, low = [], 0.0, 0.0
+    for i in range(n):
+        f = 180 - 110 * i / n
+        phase += 2 * math.pi * f / RATE
+        low += 0.25 * (rnd.uniform(-1, 1) - low) # ruido filtrado
+        env = math.exp(-i / (0.06 * RATE))
+        out.append(int(round(110 * env * (0.6 * math.sin(phase) + 0.8 * low))))
+    return out
+
+
+CLIPS = [
+    # nombre, formato, muestras
+    ("CLIP_COIN", "SAMPLE_PCM8", tone([(0, 988), (0.05, 1319)], 0.14, 0.06)),
+    ("CLIP_HIT", "SAMPLE_ADPCM4", thud(0.2)),
+    ("CLIP_GAMEOVER", "SAMPLE_ADPCM4", sweep(500, 250, 0.3) + sweep(250, 125, 0.45)),
+    ("CLIP_VICTORY", "SAMPLE_ADPCM4",
+     tone([(0, 523), (0.08, 659), (0.16, 784), (0.24, 1047)], 0.5, 0.3, amp=90)),
+]
+
+
+def write_wav(path, samples):
+    w = wave.open(path, "wb")
+    w.setnchannels(1)
+    w.setsampwidth(1)
+    w.setframerate(RATE)
+    w.writeframes(bytes((clamp(s, -128, 127) + 128) for s in samples))
+    w.close()
+
+
+def write_fixture(path, clips):
+    f = open(path, "w")
+    f.write("#ifndef clips_decoded_h\n")
+    f.write("#define clips_decoded_h\n\n")
+    f.write("// Generado por tools/gen_sound_clips.py --fixture, no editar a mano.\n")
+    f.write("// Lo que tiene que sacar SampleAudio.h de cada clip de SoundClips.h.\n\n")
+    f.write("#include <stdint.h>\n\n")
+    for name, decoded in clips:
+        f.write("const int8_t %s_DECODED[%d] = {\n" % (name, len(decoded)))
+        for i in range(0, len(decoded), 16):
+            f.write("    " + ", ".join("%d" % s for s in decoded[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+    f.write("#endif\n")
+    f.close()
+
+
+def main():
+    wav_dir = None
+    fixture = None
+    args = sys.argv[1:]
+    while len(args) > 1:
+        if args[0] == "--wav":
+            wav_dir = args[1]
+        elif args[0] == "--fixture":
+            fixture = args[1]
+        args = args[2:]
+
+    print("#ifndef SoundClips_h")
+    print("#define SoundClips_h")
+    print()
+    print("#include <Arduino.h>")
+    print("#include \"SampleAudio.h\"")
+    print()
+    print("// Generado por tools/gen_sound_clips.py, no editar a mano.")
+    print("// Efectos de sonido a %d Hz para SampleAudio.h (-DSAMPLE_AUDIO)." % RATE)
+    print()
+    total = 0
+    decoded_clips = []
+    for name, fmt, samples in CLIPS:
+        samples = [clamp(s, -128, 127) for s in samples]
+        if fmt == "SAMPLE_PCM8":
+            data, decoded = [s & 0xFF for s in samples], samples
+        else:
+            data, decoded = adpcm_encode(samples)
+        total += len(data)
+        decoded_clips.append((name, decoded))
+        if wav_dir:
+            write_wav("%s/%s.wav" % (wav_dir, name.lower()), decoded)
+        print("// %d muestras (%.2f s), %d bytes" % (len(samples), len(samples) / float(RATE), len(data)))
+        print("const uint8_t %s_DATA[%d] PROGMEM = {" % (name, len(data)))
+        for i in range(0, len(data), 16):
+            print("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+        print("};")
+        print("const SoundClip %s PROGMEM = { %s_DATA, %d, %s };" % (name, name, len(samples), fmt))
+        print()
+    print("// en total %d bytes de flash" % total)
+    print()
+    print("#endif")
+    if fixture:
+        write_fixture(fixture, decoded_clips)
+
+
+main()
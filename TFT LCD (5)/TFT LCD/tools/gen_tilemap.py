@@ -0,0 +1,94 @@
+# Genera src/Tilemap.h: el fondo del juego como un mapa de cuadritos de 8x8.
+#  - TILESET: los cuadritos distintos, 64 pixeles RGB565 cada uno;
+#  - TILEMAP: el indice del cuadrito en cada lugar de la pantalla, 30x40
+#    bytes (1200) para 240x320.
+# Display::restoreBackground lee de aqui lo que hay debajo de un sprite para
+# borrarlo, asi que los pisos y el fondo se dibujan una sola vez.
+#
+# Los pisos salen de FLOOR_OFFSETS en GameConfig.h (una linea blanca a la
+# altura de cada piso) y el cielo, arriba del primer piso, lleva unas
+# estrellas tenues en lugares fijos (semilla fija).
+#
+# Uso: python tools/gen_tilemap.py (otra vez si cambian los pisos)
+
+import os
+import random
+import re
+
+root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+config = os.path.join(root, "src", "GameConfig.h")
+target = os.path.join(root, "src", "Tilemap.h")
+
+TILE = 8
+FLOOR_COLOR = 0xFFFF
+STAR_COLORS = [0x8410, 0xC618]  # gris y gris claro
+STAR_CHANCE = 0.05
+SEED = 7
+
+
+def config_int(text, name):
+    return int(re.search(r"const int %s = (\d+);" % name, text).group(1))
+
+
+text = open(config).read()
+xmax = config_int(text, "XMAX")
+ymax = config_int(text, "YMAX")
+offsets = [int(v) for v in re.search(r"FLOOR_OFFSETS\[FLOOR_COUNT\] = \{([^}]*)\}", text).group(1).split(",")]
+floors = [ymax - o for o in offsets]
+cols, rows = xmax // TILE, ymax // TILE
+
+# cuadrito 0: negro; luego una linea por cada fila de pixel donde cae un piso
+tiles = [[0] * (TILE * TILE)]
+names = ["negro"]
+line_tile = {}
+for y in sorted(set(f % TILE for f in floors)):
+    t = [0] * (TILE * TILE)
+    for x in range(TILE):
+        t[y * TILE + x] = FLOOR_COLOR
+    line_tile[y] = len(tiles)
+    tiles.append(t)
+    names.append("piso en la fila %d" % y)
+star_tiles = []
+for i, color in enumerate(STAR_COLORS):
+    t = [0] * (TILE * TILE)
+    t[(2 + 3 * i) * TILE + (5 - 3 * i)] = color
+    star_tiles.append(len(tiles))
+    tiles.append(t)
+    names.append("estrella %d" % (i + 1))
+
+floor_rows = dict((f // TILE, line_tile[f % TILE]) for f in floors)
+rng = random.Random(SEED)
+tilemap = []
+for ty in range(rows):
+    for tx in range(cols):
+        if ty in floor_rows:
+            tilemap.append(floor_rows[ty])
+        elif ty * TILE + TILE <= floors[0] and rng.random() < STAR_CHANCE:
+            tilemap.append(rng.choice(star_tiles))
+        else:
+            tilemap.append(0)
+
+out = ["#ifndef Tilemap_h", "#define Tilemap_h", "", "#include <Arduino.h>", "",
+       "// Generado por tools/gen_tilemap.py, no editar a mano.",
+       "// Fondo del juego en cuadritos de 8x8: TILEMAP dice que cuadrito de",
+       "// TILESET va en cada lugar. Lo dibuja Display::restoreBackground.",
+       "",
+       "#define TILE_SIZE %d" % TILE,
+       "#define TILEMAP_COLS %d" % cols,
+       "#define TILEMAP_ROWS %d" % rows,
+       "",
+       "const uint16_t TILESET[%d][%d] PROGMEM = {" % (len(tiles), TILE * TILE)]
+for t, name in zip(tiles, names):
+    out.append("\t{ // %s" % name)
+    for i in range(0, len(t), TILE):
+        out.append("\t\t" + ", ".join("0x%04x" % v for v in t[i:i + TILE]) + ",")
+    out.append("\t},")
+out.append("};")
+out.append("")
+out.append("const uint8_t TILEMAP[TILEMAP_ROWS * TILEMAP_COLS] PROGMEM = {")
+for ty in range(rows):
+    out.append("\t" + ", ".join("%d" % v for v in tilemap[ty * cols:(ty + 1) * cols]) + ",")
+out.append("};")
+out += ["", "#endif", ""]
+open(target, "w").write("\n".join(out))
+print("%s: %d cuadritos, mapa de %dx%d" % (os.path.relpath(target, root), len(tiles), cols, rows))
@@ -0,0 +1,187 @@
+# Latencia del boton a la pantalla sacada de las señales de simavr, lo mismo
+# que mide el juego con -DINPUT_LATENCY (src/InputLatency.h) pero desde
+# afuera: del flanco de subida del boton al RAMWR de la primera ventana del
+# cuadro en que el dino empieza a subir.
+#
+# Lee un .vcd con cinco señales de un bit: el boton (pin 18, PD3), CS, DC,
+# SCK y MOSI del display. Decodifica el SPI (modo 0, el bit mas alto
+# primero, solo con CS abajo), arma las ventanas con CASET, PASET y RAMWR y
+# agrupa en cuadros las que van en una misma bajada de CS (beginFrame...
+# endFrame). El dino es la primera ventana de SPRITE_SIZE x SPRITE_SIZE de
+# cada cuadro; el salto es el primer cuadro despues del flanco en que esa
+# ventana queda mas arriba que antes del flanco, y la latencia llega hasta
+# el RAMWR de la primera ventana de ese cuadro (la primera de
+# DinoPlayer::draw). Los toques en el aire no hacen saltar y no cuentan: se
+# toma como parado que las dos ultimas ventanas del dino esten a la misma y.
+#
+# Vale para los builds en que cada cuadro es una sola transaccion y el
+# dino es lo primero que se dibuja: no con -DRENDER_QUEUE (la cola baja CS
+# por su cuenta) ni -DSCROLL_WORLD (antes van las columnas nuevas).
+#
+# Los nombres de las señales son los que se les den a simavr al trazarlas
+# (--add-trace nombre=portpin@direccion/mascara); si son otros se pasan con
+# --boton, --cs, --dc, --sck y --mosi.
+#
+# Uso: python tools/latency_vcd.py traza.vcd [--sprite 32] [--boton boton] ...
+
+import argparse
+import sys
+
+RAMWR, CASET, PASET = 0x2C, 0x2A, 0x2B
+BUCKET_MS = 2     # LATENCY_BUCKET_US de InputLatency.h
+BUCKETS = 32
+
+UNITS = {"s": 1e6, "ms": 1e3, "us": 1.0, "ns": 1e-3, "ps": 1e-6, "fs": 1e-9}
+
+
+def read_vcd(path, wanted):
+    """Devuelve {nombre: [(us, valor), ...]} de las señales pedidas."""
+    ids, changes = {}, {name: [] for name in wanted}
+    scale = 1e-3  # 1 ns si no dice
+    t = 0.0
+    tokens = open(path).read().split()
+    i = 0
+    while i < len(tokens):
+        tok = tokens[i]
+        if tok == "$timescale":
+            j = tokens.index("$end", i)
+            text = "".join(tokens[i + 1:j])
+            num = "".join(c for c in text if c.isdigit()) or "1"
+            scale = int(num) * UNITS[text[len(num):]]
+            i = j
+        elif tok == "$var":
+            j = tokens.index("$end", i)
+            code, name = tokens[i + 3], tokens[i + 4]
+            if name in wanted:
+                ids.setdefault(code, []).append(name)
+            i = j
+        elif tok.startswith("$"):
+            if tok not in ("$dumpvars", "$end"):
+                i = tokens.index("$end", i)
+        elif tok.startswith("#"):
+            t = int(tok[1:]) * scale
+        elif tok[0] in "01xzXZ" and tok[1:] in ids:
+            for name in ids[tok[1:]]:
+                changes[name].append((t, 1 if tok[0] == "1" else 0))
+        elif tok[0] in "bB" and i + 1 < len(tokens) and tokens[i + 1] in ids:
+            for name in ids[tokens[i + 1]]:
+                changes[name].append((t, 1 if tok[-1] == "1" else 0))
+            i += 1
+        i += 1
+    for name in wanted:
+        if not changes[name]:
+            sys.exit("latency_vcd: no esta la señal %s en %s" % (name, path))
+    return changes
+
+
+def level_at(trace, t, cursor):
+    """Valor de la señal en t; cursor avanza solo (los t llegan en orden)."""
+    while cursor[0] + 1 < len(trace) and trace[cursor[0] + 1][0] <= t:
+        cursor[0] += 1
+    return trace[cursor[0]][1] if trace[cursor[0]][0] <= t else 0
+
+
+def spi_bytes(sig, names):
+    """(us, dc, byte, cuadro) de cada byte que salio con CS abajo."""
+    events = []
+    for name in ("cs", "sck"):
+        kind = 0 if name == "cs" else 1
+        events += [(t, kind, v) for t, v in sig[names[name]]]
+    events.sort()
+    mosi, dc = [0], [0]
+    out, frame, cs_low, bits, value = [], 0, False, 0, 0
+    last_sck = 0
+    for t, kind, v in events:
+        if kind == 0:
+            if not v and not cs_low:
+                frame += 1
+                bits, value = 0, 0
+            cs_low = not v
+            continue
+        rising = v and not last_sck
+        last_sck = v
+        if not (rising and cs_low):
+            continue
+        value = value << 1 | level_at(sig[names["mosi"]], t, mosi)
+        bits += 1
+        if bits == 8:
+            out.append((t, level_at(sig[names["dc"]], t, dc), value, frame))
+            bits, value = 0, 0
+    return out
+
+
+def windows(data):
+    """(us del RAMWR, cuadro, x0, x1, y0, y1) de cada ventana."""
+    out, cmd, args = [], None, []
+    x0 = x1 = y0 = y1 = 0
+    for t, dc, b, frame in data:
+        if not dc:
+            cmd, args = b, []
+            if b == RAMWR:
+                out.append((t, frame, x0, x1, y0, y1))
+            continue
+        args.append(b)
+        if len(args) == 4 and cmd in (CASET, PASET):
+            a, e = args[0] << 8 | args[1], args[2] << 8 | args[3]
+            if cmd == CASET:
+                x0, x1 = a, e
+            else:
+                y0, y1 = a, e
+    return out
+
+
+def latencies(presses, wins, sprite):
+    # por cuadro: la hora de la primera ventana y la y del dino
+    frames = {}
+    for t, frame, x0, x1, y0, y1 in wins:
+        f = frames.setdefault(frame, [t, None])
+        if f[1] is None and x1 - x0 + 1 == sprite and y1 - y0 + 1 == sprite:
+            f[1] = (t, y0)
+    order = sorted((f[0], f[1][0], f[1][1]) for f in frames.values() if f[1] is not None)
+    out = []
+    for n, press in enumerate(presses):
+        until = presses[n + 1] if n + 1 < len(presses) else float("inf")
+        before = [y for start, dino_t, y in order if dino_t < press]
+        if len(before) < 2 or before[-1] != before[-2]:
+            continue # en el aire (o sin cuadros antes): no salta
+        for start, dino_t, y in order:
+            if start >= until:
+                break
+            if start > press and y < before[-1]:
+                out.append(start - press)
+                break
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description="latencia del boton a la pantalla desde un .vcd de simavr")
+    parser.add_argument("vcd")
+    parser.add_argument("--sprite", type=int, default=32, help="SPRITE_SIZE de GameConfig.h")
+    for name in ("boton", "cs", "dc", "sck", "mosi"):
+        parser.add_argument("--" + name, default=name, help="nombre de la señal en el .vcd")
+    args = parser.parse_args()
+    names = {name: getattr(args, name) for name in ("boton", "cs", "dc", "sck", "mosi")}
+
+    sig = read_vcd(args.vcd, set(names.values()))
+    presses, last = [], 0
+    for t, v in sig[names["boton"]]:
+        if v and not last:
+            presses.append(t)
+        last = v
+    lat = latencies(presses, windows(spi_bytes(sig, names)), args.sprite)
+
+    print("toques %d, saltos medidos %d" % (len(presses), len(lat)))
+    if not lat:
+        return
+    for us in lat:
+        print("  %8.0f us" % us)
+    lat.sort()
+    # como InputLatency::report: el borde de arriba de la caja
+    def pct(p):
+        need = (len(lat) * p + 99) // 100
+        return min(int(lat[need - 1] // (BUCKET_MS * 1000)), BUCKETS - 1) + 1
+    print("latencia x%d p50 %d p99 %d ms peor %d us" % (len(lat), pct(50) * BUCKET_MS, pct(99) * BUCKET_MS, lat[-1]))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,318 @@
+// Verificador de niveles: busca la secuencia de saltos que gana el juego.
+//
+// Simula el juego tick por tick igual que Game::update() en main.cpp (entrada,
+// caida, avance, colisiones, cambio de nivel), con la misma fisica en punto
+// fijo de src/JumpPhysics.h, y recorre a lo ancho todos los
+// estados alcanzables. Cada estado se empaqueta en un entero de 64 bits y se
+// guarda en una tabla hash, asi un estado repetido no se vuelve a expandir.
+//
+// Como en cada tick el dino avanza, pierde una vida o sube de nivel, los
+// estados se pueden ordenar (vidas perdidas, nivel, x) y calcular hacia atras
+// lo que cuesta ganar desde cada uno: primero las vidas perdidas y despues
+// los saltos, asi el camino que se reporta nunca regala una vida.
+//
+// Uso (lo corre tools/check_levels.py antes de compilar):
+//   c++ -O2 -std=c++11 -Isrc tools/level_solver.cpp -o level_solver && ./level_solver
+// Sale con codigo 1 si algun nivel no se puede pasar o el juego no se puede ganar.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "GameConfig.h"
+#include "JumpPhysics.h"
+
+namespace {
+
+const int NO_WIN = 0xFFFF;
+const int LIFE_COST = 1024; // una vida vale mas que todos los saltos de una partida
+
+struct State {
+    int level;
+    DinoMotion m;
+    int lives;
+    int score;
+    uint16_t coins; // bit (nivel * MAX_OBJECTS + j) = moneda j recogida
+};
+
+enum Outcome { RUNNING, WON, LOST, STUCK };
+
+int floorTop(int level) {
+    return YMAX - FLOOR_OFFSETS[level] - SPRITE_SIZE;
+}
+
+bool overlaps(int ax, int ay, int bx, int by) {
+    return ax + SPRITE_SIZE > bx && ax < bx + SPRITE_SIZE &&
+           ay + SPRITE_SIZE > by && ay < by + SPRITE_SIZE;
+}
+
+// Un tick de loop(): handleInput() y luego update().
+Outcome step(State& s, bool press) {
+    const LevelLayout& layout = LEVEL_LAYOUTS[s.level];
+    int top = floorTop(s.level);
+
+    // DinoPlayer::jump(), update() y moveRight()
+    if (press) motionJump(s.m);
+    motionFall(s.m, toFixed(top));
+    motionAdvance(s.m);
+    int x = fixedToPx(s.m.x);
+    int y = fixedToPx(s.m.y);
+
+    // Game::checkCollisions()
+    for (int i = 0; i < layout.cactusCount; i++) {
+        if (overlaps(x, y, layout.cactusX[i], top)) {
+            s.lives--;
+            motionPlace(s.m, 0, top);
+            x = 0;
+            y = top;
+            break;
+        }
+    }
+    for (int i = 0; i < layout.coinCount; i++) {
+        uint16_t bit = 1u << (s.level * MAX_OBJECTS + i);
+        if (!(s.coins & bit) && overlaps(x, y, layout.coinX[i], top)) {
+            s.coins |= bit;
+            s.score += COIN_POINTS;
+        }
+    }
+    if (s.score >= WIN_SCORE) return WON;
+    if (s.lives <= 0) return LOST;
+
+    // Game::checkLevelProgression()
+    if (x >= XMAX - SPRITE_SIZE) {
+        if (s.level < NUM_LEVELS - 1) {
+            s.level++;
+            motionPlace(s.m, 0, floorTop(s.level));
+        } else if (x >= XMAX + SPRITE_SIZE) {
+            return STUCK; // ya salio de la pantalla y no queda nada que tocar
+        }
+    }
+    return RUNNING;
+}
+
+// Estado -> 64 bits. La velocidad vertical no se guarda: sale del tick del
+// salto (la tabla y luego la gravedad), asi que no agrega estados.
+// | vidas:2 | nivel:2 | x:18 | piso - y:16 | tick:6 | salto:1 | monedas:12 |
+uint64_t pack(const State& s) {
+    static_assert(NUM_LEVELS * MAX_OBJECTS <= 12 && NUM_LEVELS <= 4,
+                  "las monedas y el nivel ya no entran en la clave de 64 bits");
+    uint64_t k = (uint64_t)s.lives;
+    k = (k << 2) | (uint64_t)s.level;
+    k = (k << 18) | (uint64_t)s.m.x;
+    k = (k << 16) | (uint64_t)(toFixed(floorTop(s.level)) - s.m.y);
+    k = (k << 6) | (uint64_t)s.m.tick;
+    k = (k << 1) | (s.m.jumping ? 1u : 0u);
+    k = (k << 12) | s.coins;
+    return k;
+}
+
+State unpack(uint64_t k) {
+    State s;
+    s.coins = k & 0xFFF;                     k >>= 12;
+    s.m.jumping = k & 1;                     k >>= 1;
+    s.m.tick = (uint8_t)(k & 0x3F);          k >>= 6;
+    int32_t height = (int32_t)(k & 0xFFFF);  k >>= 16;
+    s.m.x = (int32_t)(k & 0x3FFFF);          k >>= 18;
+    s.level = (int)(k & 0x3);                k >>= 2;
+    s.lives = (int)k;
+    s.m.y = toFixed(floorTop(s.level)) - height;
+    s.m.vy = 0;
+    for (int t = 0; t < s.m.tick && t < JUMP_TICKS; t++) s.m.vy = JUMP_ARC[t];
+    for (int t = JUMP_TICKS; t < s.m.tick; t++) s.m.vy += GRAVITY_FX;
+    s.score = 0;
+    for (uint16_t c = s.coins; c; c &= c - 1) s.score += COIN_POINTS;
+    return s;
+}
+
+// orden topologico: cada tick sube esta clave (o se pierde una vida)
+uint64_t order(const State& s) {
+    return ((uint64_t)(START_LIVES - s.lives) << 24) | ((uint64_t)s.level << 20) | (uint64_t)s.m.x;
+}
+
+struct Node {
+    uint64_t next[2];  // sucesor sin saltar / saltando
+    Outcome outcome[2];
+    bool lostLife[2];  // ese tick choca con un cactus
+    uint16_t best;     // minimo costo para ganar desde aqui (vidas, saltos)
+};
+
+class Solver {
+public:
+    // Explora todo lo alcanzable desde `start`. Para el analisis por nivel,
+    // `goalLevel` marca como meta llegar al nivel siguiente sin perder vidas.
+    void solve(const State& start, int goalLevel) {
+        nodes.clear();
+        goal = goalLevel;
+        startLives = start.lives;
+        startKey = pack(start);
+
+        furthest = start;
+
+        std::vector<uint64_t> frontier(1, startKey);
+        std::vector<uint64_t> visited;
+        nodes[startKey] = Node();
+        while (!frontier.empty()) {
+            std::vector<uint64_t> nextFrontier;
+            for (size_t f = 0; f < frontier.size(); f++) {
+                uint64_t key = frontier[f];
+                visited.push_back(key);
+                State s = unpack(key);
+                if (s.lives == startLives && order(s) > order(furthest)) furthest = s;
+                Node node;
+                for (int press = 0; press < 2; press++) {
+                    // saltar en el aire no hace nada, no vale la pena expandirlo
+                    if (press && s.m.jumping) {
+                        node.outcome[1] = LOST;
+                        node.next[1] = 0;
+                        node.lostLife[1] = false;
+                        continue;
+                    }
+                    State t = s;
+                    node.outcome[press] = classify(t, step(t, press != 0));
+                    node.next[press] = pack(t);
+                    node.lostLife[press] = t.lives < s.lives;
+                    if (node.outcome[press] == RUNNING && nodes.find(node.next[press]) == nodes.end()) {
+                        nodes[node.next[press]] = Node();
+                        nextFrontier.push_back(node.next[press]);
+                    }
+                }
+                node.best = NO_WIN;
+                nodes[key] = node;
+            }
+            frontier.swap(nextFrontier);
+        }
+
+        // minimo costo, de los estados mas avanzados hacia atras
+        std::sort(visited.begin(), visited.end(), [](uint64_t a, uint64_t b) {
+            return order(unpack(a)) > order(unpack(b));
+        });
+        for (size_t i = 0; i < visited.size(); i++) {
+            Node& node = nodes[visited[i]];
+            for (int press = 0; press < 2; press++) {
+                int cost = costFrom(node, press);
+                if (cost < node.best) node.best = (uint16_t)cost;
+            }
+        }
+    }
+
+    int bestFromStart() const { return nodes.at(startKey).best; }
+
+    // Reproduce el camino optimo e imprime, por nivel, los saltos, la ventana
+    // de ticks en que cada salto todavia mantiene el minimo y las vidas que
+    // se pierden (si no hay otra forma de ganar).
+    void report(const char* title) const {
+        int best = bestFromStart();
+        if (best == NO_WIN) {
+            printf("%s: SIN SOLUCION (sin perder vidas llega hasta nivel %d, x = %d)\n",
+                   title, furthest.level + 1, fixedToPx(furthest.m.x));
+            return;
+        }
+        printf("%s: resoluble con %d salto(s)", title, best % LIFE_COST);
+        if (best >= LIFE_COST) printf(" perdiendo %d vida(s)", best / LIFE_COST);
+        printf("\n");
+
+        std::vector<int> xs; // x del dino (px) en cada tick del camino
+        uint64_t key = startKey;
+        int tick = 0;
+        int windowStart = -1;
+        int remaining = best;
+        while (true) {
+            const Node& node = nodes.at(key);
+            State s = unpack(key);
+            xs.push_back(fixedToPx(s.m.x));
+            bool jumpOk = costFrom(node, 1) == remaining;
+            bool waitOk = costFrom(node, 0) == remaining;
+
+            // una ventana es una racha de ticks en que saltar mantiene el
+            // minimo; se salta en el ultimo tick de la ventana
+            if (jumpOk && windowStart < 0) windowStart = tick;
+            bool press = jumpOk && !waitOk;
+            if (windowStart >= 0 && (!jumpOk || press)) {
+                int last = jumpOk ? tick : tick - 1;
+                printf("  nivel %d: %s en tick %d..%d (x = %d..%d)\n", s.level + 1,
+                       press ? "salto" : "ventana sin usar", windowStart, last,
+                       xs[windowStart], xs[last]);
+                windowStart = -1;
+            }
+            if (node.lostLife[press]) {
+                printf("  nivel %d: pierde una vida en el tick %d (x = %d)\n", s.level + 1, tick, xs.back());
+            }
+            remaining -= edgeCost(node, press);
+            if (node.outcome[press] != RUNNING) {
+                printf("  meta en el tick %d\n", tick + 1);
+                return;
+            }
+            key = node.next[press];
+            tick++;
+        }
+    }
+
+private:
+    std::unordered_map<uint64_t, Node> nodes;
+    uint64_t startKey;
+    State furthest;
+    int goal;
+    int startLives;
+
+    // Juego completo (goal < 0): solo WON es meta. Por nivel: la meta es
+    // pasar al nivel siguiente, o cruzar la pantalla en el ultimo, sin
+    // perder vidas.
+    Outcome classify(const State& t, Outcome o) const {
+        if (goal < 0) return o == STUCK ? LOST : o;
+        if (o == LOST || t.lives < startLives) return LOST;
+        if (o == WON || o == STUCK || t.level > goal) return WON;
+        return RUNNING;
+    }
+
+    int costFrom(const Node& node, int press) const {
+        int rest;
+        if (node.outcome[press] == WON) {
+            rest = 0;
+        } else if (node.outcome[press] == RUNNING) {
+            rest = nodes.at(node.next[press]).best;
+        } else {
+            return NO_WIN;
+        }
+        return rest == NO_WIN ? NO_WIN : rest + edgeCost(node, press);
+    }
+
+    static int edgeCost(const Node& node, int press) {
+        return press + (node.lostLife[press] ? LIFE_COST : 0);
+    }
+};
+
+State levelStart(int level) {
+    State s;
+    s.level = level;
+    motionPlace(s.m, 0, floorTop(level));
+    s.lives = START_LIVES;
+    s.score = 0;
+    s.coins = 0;
+    return s;
+}
+
+} // namespace
+
+int main() {
+    bool ok = true;
+    Solver solver;
+    char title[32];
+
+    // cada nivel por separado: llegar al siguiente (o salir de la pantalla en
+    // el ultimo) sin perder ninguna vida
+    for (int level = 0; level < NUM_LEVELS; level++) {
+        snprintf(title, sizeof(title), "Nivel %d", level + 1);
+        solver.solve(levelStart(level), level);
+        solver.report(title);
+        ok = ok && solver.bestFromStart() != NO_WIN;
+    }
+
+    // el juego completo: juntar WIN_SCORE puntos antes de perder las vidas
+    solver.solve(levelStart(0), -1);
+    solver.report("Juego completo");
+    ok = ok && solver.bestFromStart() != NO_WIN;
+
+    return ok ? 0 : 1;
+}
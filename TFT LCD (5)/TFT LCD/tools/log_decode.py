@@ -0,0 +1,105 @@
+# Arma el texto del log binario de src/Log.h. Por Serial sale la telemetria
+# de siempre (texto) mezclada con registros 0xFE id largo argumentos; el
+# texto pasa tal cual y cada registro se escribe como una linea con el
+# formato que tiene en src/LogFormats.h (el id es su lugar en la lista).
+# Los argumentos van en little endian y cada % dice su tamaño: %c %hhu %hhd
+# 1 byte, %u %d %x 2 y %lu %ld %lx 4. Si el id no esta o el largo no
+# coincide con el formato (un LogFormats.h distinto al del firmware) sale
+# el registro en hexa.
+#
+# Lee un archivo con lo capturado, la entrada estandar o el puerto (hace
+# falta pyserial).
+#
+# Uso: python tools/log_decode.py [captura.bin | --port /dev/ttyACM0 [--baud 9600]]
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+SYNC = 0xFE
+FORMATS = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "LogFormats.h")
+
+SPEC = re.compile(r"%(hh|h|l)?([cdiux])")
+SIZES = {"hh": 1, "h": 2, "": 2, "l": 4}   # int de avr-gcc es de 2 bytes
+LEVELS = {"LOG_ERROR": "E", "LOG_WARN": "W", "LOG_INFO": "I", "LOG_DEBUG": "D"}
+
+
+def load_formats(path):
+    """[(nombre, nivel, formato de python, [(bytes, con signo)])] por id."""
+    out = []
+    source = open(path).read()
+    body = source[source.index("#define LOG_FORMATS"):]  # el comentario de arriba tambien tiene un X(...)
+    for name, level, text in re.findall(r'X\(\s*(\w+)\s*,\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)', body):
+        args = []
+        for size, conv in SPEC.findall(text):
+            args.append((1 if conv == "c" else SIZES[size], conv in "di"))
+        # python no tiene %u ni los tamaños
+        text = SPEC.sub(lambda m: "%" + {"c": "c", "x": "x"}.get(m.group(2), "d"), text)
+        out.append((name, LEVELS.get(level, "?"), text, args))
+    return out
+
+
+def decode(formats, ident, payload):
+    if ident >= len(formats):
+        return "log: id %d desconocido: %s" % (ident, payload.hex())
+    name, level, text, args = formats[ident]
+    if sum(size for size, _ in args) != len(payload):
+        return "log: %s con %d bytes: %s" % (name, len(payload), payload.hex())
+    values, pos = [], 0
+    for size, signed in args:
+        values.append(int.from_bytes(payload[pos:pos + size], "little", signed=signed))
+        pos += size
+    return "[%s] %s" % (level, text % tuple(values))
+
+
+class Stream:
+    """Separa el texto de los registros; se le pasan los bytes como lleguen."""
+
+    def __init__(self, formats, out):
+        self.formats, self.out = formats, out
+        self.record = None  # los bytes del registro a medias, None si es texto
+        self.line = False   # hay texto sin terminar en la linea
+
+    def feed(self, data):
+        for b in data:
+            if self.record is None:
+                if b == SYNC:
+                    self.record = bytearray()
+                    continue
+                self.out.write(chr(b))
+                self.line = b != 0x0A
+                continue
+            self.record.append(b)
+            if len(self.record) >= 2 and len(self.record) == 2 + self.record[1]:
+                if self.line:
+                    self.out.write("\n")  # el registro salio en medio de una linea
+                self.out.write(decode(self.formats, self.record[0], bytes(self.record[2:])) + "\n")
+                self.record, self.line = None, False
+        self.out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="texto del log binario de src/Log.h")
+    parser.add_argument("file", nargs="?", help="lo capturado; sin esto, la entrada estandar")
+    parser.add_argument("--port", help="leer del puerto serie")
+    parser.add_argument("--baud", type=int, default=9600)
+    parser.add_argument("--formats", default=FORMATS, help="LogFormats.h del firmware")
+    args = parser.parse_args()
+
+    stream = Stream(load_formats(args.formats), sys.stdout)
+    if args.port:
+        import serial
+        port = serial.Serial(args.port, args.baud)
+        try:
+            while True:
+                stream.feed(port.read(port.in_waiting or 1))
+        except KeyboardInterrupt:
+            return
+    src = open(args.file, "rb") if args.file else sys.stdin.buffer
+    stream.feed(src.read())
+
+
+if __name__ == "__main__":
+    main()